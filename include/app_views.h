@@ -0,0 +1,42 @@
+/********************************************************************
+MIT License
+
+Copyright (c) 2025 loong22
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*********************************************************************/
+#ifndef APP_VIEWS_H
+#define APP_VIEWS_H
+
+#include "log_search.h"
+#include "log_source.h"
+#include "su2_history.h"
+
+// 主程序窗口中与平台无关的内容部分，只依赖 ImGui/ImPlot 和传入的数据，
+// 主程序和无界面运行程序（SU2GUI_Headless）绘制的是同一份界面。
+
+// 日志正文：行号、自动换行、搜索匹配高亮，onlyMatches 时只列出匹配行，
+// scrollToCursor 时滚动到 cursorLine 所在行
+void RenderLogContent(LogSource& source, const LogSearcher& searcher, bool showLineNumbers, bool wrapText, float wrapWidth,
+    bool onlyMatches, int cursorLine, bool scrollToCursor);
+
+// 收敛历史的残差曲线（对数坐标）和气动系数曲线，各占 plotHeight 的一半
+void ShowConvergencePlots(const Su2History& history, float plotHeight);
+
+#endif // APP_VIEWS_H
@@ -0,0 +1,109 @@
+/********************************************************************
+MIT License
+
+Copyright (c) 2025 loong22
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*********************************************************************/
+
+#ifndef DRAW_STATS_H
+#define DRAW_STATS_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct ImDrawData;
+
+// 渲染后端的顶点/索引缓冲状态，重分配次数为累计值
+struct DrawBackendStats {
+    int vertexCapacity = 0;
+    int indexCapacity = 0;
+    int vertexReallocs = 0;
+    int indexReallocs = 0;
+    int retainedLists = 0;               // 拥有独立缓冲的大绘制列表
+    int uploadedVertices = 0;            // 本帧上传的顶点
+    int reusedVertices = 0;              // 本帧内容未变、直接沿用 GPU 缓冲的顶点
+};
+
+// 一个 ImDrawList（通常对应一个窗口）在最近一帧的几何量
+struct DrawListStats {
+    std::string name;
+    int vtxCount = 0;
+    int idxCount = 0;
+    int cmdCount = 0;
+    int peakVtxCount = 0;                // 历史记录范围内的最大顶点数
+    std::vector<float> vtxHistory;       // 环形记录，与 DrawStats::GetHistoryOffset() 对齐
+    uint64_t lastFrame = 0;              // 最近一次出现的帧
+};
+
+// 一个 ImPlot/ImPlot3D 图表项在上一帧输出的几何量
+struct DrawItemStats {
+    std::string plot;
+    std::string label;
+    bool is3D = false;
+    int vtxCount = 0;
+    int idxCount = 0;
+    int cmdCount = 0;                    // 3D 图表项在深度排序后才生成绘制命令，此处为 0
+};
+
+// 绘制数据统计
+// 每帧在 ImGui::Render() 和后端 RenderDrawData() 之后调用 Update()，
+// 记录总量和每个绘制列表的顶点/索引/命令数，以及后端缓冲的重分配次数，保留最近 kHistoryLength 帧。
+// 图表项的统计来自 ImPlot/ImPlot3D，是上一帧的数据。
+class DrawStats {
+public:
+    static constexpr int kHistoryLength = 240;
+
+    DrawStats();
+
+    void Update(const ImDrawData* drawData, const DrawBackendStats& backend);
+
+    uint64_t GetFrameCount() const { return m_Frame; }
+    // 历史数组是环形的，最旧的一帧位于该下标
+    int GetHistoryOffset() const { return static_cast<int>(m_Frame % kHistoryLength); }
+    const std::vector<float>& GetVtxHistory() const { return m_VtxHistory; }
+    const std::vector<float>& GetIdxHistory() const { return m_IdxHistory; }
+    const std::vector<float>& GetCmdHistory() const { return m_CmdHistory; }
+    const std::vector<float>& GetReallocHistory() const { return m_ReallocHistory; }
+
+    int GetVtxCount() const { return m_VtxCount; }
+    int GetIdxCount() const { return m_IdxCount; }
+    int GetCmdCount() const { return m_CmdCount; }
+    const DrawBackendStats& GetBackend() const { return m_Backend; }
+
+    // 按顶点数从多到少排列；最近 kHistoryLength 帧都没有出现的绘制列表会被移除
+    const std::vector<DrawListStats>& GetDrawLists() const { return m_DrawLists; }
+    const std::vector<DrawItemStats>& GetItems() const { return m_Items; }
+
+private:
+    uint64_t m_Frame = 0;
+    int m_VtxCount = 0;
+    int m_IdxCount = 0;
+    int m_CmdCount = 0;
+    DrawBackendStats m_Backend;
+    std::vector<float> m_VtxHistory;
+    std::vector<float> m_IdxHistory;
+    std::vector<float> m_CmdHistory;
+    std::vector<float> m_ReallocHistory;   // 每帧新增的缓冲重分配次数
+    std::vector<DrawListStats> m_DrawLists;
+    std::vector<DrawItemStats> m_Items;
+};
+
+#endif // DRAW_STATS_H
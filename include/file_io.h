@@ -0,0 +1,57 @@
+/********************************************************************
+MIT License
+
+Copyright (c) 2025 loong22
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*********************************************************************/
+
+#ifndef FILE_IO_H
+#define FILE_IO_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+
+// 读写进度回调：processed 为已完成的字节数，total 为总字节数；返回 false 时取消操作
+using FileProgressCallback = std::function<bool(uint64_t processed, uint64_t total)>;
+
+// 按二进制整块读取文件：先按文件大小一次分配好 content，再分块直接读入，不做换行转换。
+// 失败或被取消时 content 为空并返回 false
+bool LoadFile(const std::string& filePath, std::string& content, const FileProgressCallback& onProgress = nullptr);
+
+// 先分块写入同目录下的临时文件并刷到磁盘，再用重命名替换目标文件，
+// 写入中途失败或被取消时原文件保持不变
+bool SaveFile(const std::string& filePath, const std::string& content, const FileProgressCallback& onProgress = nullptr);
+
+// 文本文件的换行符。LoadFile/SaveFile 按字节原样读写，编辑器中的内容只使用 \n（输入框插入的换行也是 \n），
+// 打开时用 NormalizeLineEndings 去掉 \r，保存时用 RestoreLineEndings 按原文件的换行符还原
+enum class LineEnding {
+    LF,
+    CRLF,
+};
+
+// 文件中的每个 \n 前都是 \r 时，原地去掉这些 \r 并返回 CRLF；否则（只用 \n、混用或二进制内容）
+// 不修改 content 并返回 LF。返回 CRLF 时 RestoreLineEndings 能逐字节还原原内容
+LineEnding NormalizeLineEndings(std::string& content);
+
+// 按 lineEnding 把 content 中的 \n 写回文件使用的换行符，结果放入 out
+void RestoreLineEndings(const std::string& content, LineEnding lineEnding, std::string& out);
+
+#endif // FILE_IO_H
@@ -0,0 +1,115 @@
+/********************************************************************
+MIT License
+
+Copyright (c) 2025 loong22
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*********************************************************************/
+
+#ifndef FRAME_PROFILER_H
+#define FRAME_PROFILER_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// 一个计时区段，时间为相对所在帧开始的纳秒数
+struct ProfileSample {
+    const char* name = nullptr;          // 必须是字符串常量，只保存指针
+    int64_t begin = 0;
+    int64_t end = 0;
+    int depth = 0;                       // 嵌套层数，最外层为 0
+};
+
+struct ProfileFrame {
+    uint64_t index = 0;                  // 从 0 开始的帧序号
+    int64_t begin = 0;                   // 相对分析器创建时刻的纳秒数
+    int64_t end = 0;
+    int sampleCount = 0;
+    int droppedCount = 0;                // 超出每帧容量而没有记录的区段数
+};
+
+// 帧耗时分析
+// 界面线程在帧的开始和结束调用 BeginFrame()/EndFrame()，中间用 PROFILE_SCOPE 标记各个阶段。
+// 数据写入预先分配好的环形缓冲：保留最近 kFrameCapacity 帧，每帧最多 kSampleCapacity 个区段，
+// 记录时不加锁也不分配内存。EndFrame() 以 release 语义发布帧计数，其他线程读取已完成的帧时无需加锁，
+// 但只能读取最近 kFrameCapacity - 1 帧（最旧的一格正在被下一帧覆盖）。
+// 只记录调用 BeginFrame() 的线程上的区段。
+class FrameProfiler {
+public:
+    static constexpr int kFrameCapacity = 240;
+    static constexpr int kSampleCapacity = 128;
+
+    FrameProfiler();
+    FrameProfiler(const FrameProfiler&) = delete;
+    FrameProfiler& operator=(const FrameProfiler&) = delete;
+
+    // 暂停后不再记录新帧，已有的数据保持不变，便于查看某次卡顿
+    void SetPaused(bool paused) { m_Paused = paused; }
+    bool IsPaused() const { return m_Paused; }
+
+    void BeginFrame();
+    void EndFrame();
+    // 返回区段所在的格子，未记录时返回 -1
+    int BeginSample(const char* name);
+    void EndSample(int slot);
+
+    // 可读取的已完成帧数；age 为 0 表示最近完成的一帧
+    int GetFrameCount() const;
+    const ProfileFrame& GetFrame(int age) const;
+    const ProfileSample* GetSamples(int age) const;
+
+    // 每个区段一行：frame,frame_begin_ms,frame_ms,name,depth,begin_ms,duration_ms
+    bool ExportCsv(const std::string& filePath, std::string& error) const;
+
+    int64_t Now() const;
+
+private:
+    int GetSlot(int age) const;
+
+    int64_t m_Origin = 0;
+    bool m_Paused = false;
+    bool m_InFrame = false;
+    uint64_t m_FrameIndex = 0;              // 正在记录的帧
+    std::atomic<uint64_t> m_Completed{0};   // 已完成的帧数
+    int m_Depth = 0;
+    std::vector<ProfileFrame> m_Frames;     // kFrameCapacity 格
+    std::vector<ProfileSample> m_Samples;   // kFrameCapacity * kSampleCapacity 格
+};
+
+FrameProfiler& GetFrameProfiler();
+
+// 在作用域内计时
+class ProfileScope {
+public:
+    explicit ProfileScope(const char* name) : m_Slot(GetFrameProfiler().BeginSample(name)) {}
+    ~ProfileScope() { GetFrameProfiler().EndSample(m_Slot); }
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    int m_Slot;
+};
+
+#define PROFILE_SCOPE_CONCAT_IMPL(a, b) a##b
+#define PROFILE_SCOPE_CONCAT(a, b) PROFILE_SCOPE_CONCAT_IMPL(a, b)
+#define PROFILE_SCOPE(name) ProfileScope PROFILE_SCOPE_CONCAT(profileScope_, __LINE__)(name)
+
+#endif // FRAME_PROFILER_H
@@ -30,6 +30,14 @@ SOFTWARE.
 #include <fstream>
 #include <d3d11.h>
 #include <windows.h>
+#include "app_views.h"
+#include "draw_stats.h"
+#include "file_io.h"
+#include "job_system.h"
+#include "log_search.h"
+#include "log_tailer.h"
+#include "su2_mesh.h"
+#include "worker_pool.h"
 
 // 程序状态数据结构
 struct AppState {
@@ -41,27 +49,72 @@ struct AppState {
     bool showUpdateWindow = false;
     bool showPlotWindow = false;
     bool show3DPlotWindow = false;
+    bool showProfilerWindow = false;
+    bool showDrawStatsWindow = false;
     bool wantToQuit = false;
 
     // 主题设置
     bool isDarkTheme = true;
 
+    // 没有输入、动画和新数据时暂停绘制，等待下一条消息
+    bool powerSaving = true;
+    // 本帧有窗口在播放动画，下一帧不能等待消息；每帧开始时清零，动画中的窗口每帧重新设置
+    bool animationRequested = false;
+
+    // 数据点很多的曲线由 plotWorkers 中的多个线程生成图元
+    bool parallelPlotting = true;
+
+    // 每帧的绘制数据统计
+    DrawStats drawStats;
+
     // 文件数据
     std::string currentFilePath;
-    std::string fileContent;
+    std::string fileContent;                        // 换行符统一为 \n
+    LineEnding fileLineEnding = LineEnding::LF;     // 保存时还原的换行符
 
     // 日志文件数据
     std::string logFilePath;
-    std::string logContent;
-    std::streampos lastReadPosition = 0;
+    LogSource logSource;
+    LogTailer logTailer;
+    Su2HistoryParser historyParser;       // 自动刷新时由后台跟踪线程使用
+    Su2History convergenceHistory;        // 从日志中解析出的收敛历史
     bool autoRefreshLog = true;
     float refreshInterval = 1.0f;
-    float lastRefreshTime = 0.0f;
     std::time_t logFileLastModified = 0;
     bool logContentCleared = false;
     bool showLineNumbers = true;
     bool wrapLogLines = true;
     float logLineWidth = 0.0f;
+
+    // 日志搜索
+    LogSearcher logSearcher;
+    char logSearchText[256] = "";
+    bool logSearchRegex = false;
+    bool logSearchCaseSensitive = false;
+    bool logShowOnlyMatches = false;
+    int logSearchCursor = -1;             // 上一次定位到的匹配行，-1 表示尚未定位
+    bool logSearchScrollPending = false;  // 下一帧把 logSearchCursor 所在行滚动到可见位置
+
+    // 网格和表面解数据
+    std::string meshFilePath;
+    Su2Mesh mesh;
+    Su2LoadStats meshStats;
+    std::string solutionFilePath;
+    Su2SurfaceSolution surfaceSolution;
+    Su2LoadStats solutionStats;
+    int solutionField = -1;               // 用于网格着色的表面解变量，-1 表示单色
+    std::vector<float> meshScalars;       // 该变量映射到网格顶点上的值
+    uint64_t meshVersion = 0;             // 网格、表面解或着色变量改变时递增，作为 ImPlot3D 几何缓存的数据版本
+    std::string meshError;
+    bool meshFitPending = false;          // 读入新网格后，下一帧把坐标轴范围设为网格包围盒
+
+    // 后台任务：文件打开/保存、日志读取和网格读取在工作线程中进行，结果在帧开始时交回
+    uint64_t fileJob = 0;                 // 进行中的任务编号，0 表示没有
+    uint64_t logRefreshJob = 0;
+    uint64_t meshJob = 0;
+    std::string jobMessage;               // 最近一次后台任务失败的提示
+    WorkerPool plotWorkers;
+    JobSystem jobs;                       // 放在最后，析构时最先停止工作线程
 };
 
 extern AppState g_AppState;
@@ -75,13 +128,17 @@ extern UINT g_ResizeWidth, g_ResizeHeight;
 extern ID3D11RenderTargetView* g_mainRenderTargetView;
 
 // === 应用程序核心功能 ===
-// 文件操作
-bool SaveFile(const std::string& filePath, const std::string& content);
-bool LoadFile(const std::string& filePath, std::string& content);
+// 文件操作（LoadFile/SaveFile 见 file_io.h）
 std::time_t GetFileLastModifiedTime(const std::string& filePath);
 
+void OpenFileAsync(const std::string& filePath);
+void SaveFileAsync(const std::string& filePath);
+
 // 窗口管理
 void ConstrainWindowsToMainViewport();
+void ShowJobProgressWindow();
+void ShowProfilerWindow(bool* p_open);
+void ShowDrawStatsWindow(bool* p_open);
 
 // Direct3D 初始化
 bool CreateDeviceD3D(HWND hWnd);
@@ -92,6 +149,7 @@ LRESULT WINAPI WndProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam);
 
 // ImPlot相关
 void InitializeImPlot();
+void ApplyParallelPlotting();
 void CleanupImPlot();
 
 // === GUI界面功能 ===
@@ -110,13 +168,20 @@ void ShowUpdateCheckWindow(bool* p_open);
 
 // === 日志功能 ===
 void ShowLogWindow(bool* p_open);
-bool LoadLogFileIncremental(const std::string& filePath, std::string& content, std::streampos& lastPos);
+void RefreshLogFileAsync();
 void OpenLogFile();
 void ClearLogContent();
-void RenderLogContent(const std::string& content, bool showLineNumbers, bool wrapText, float wrapWidth);
+void StartLogTailer();
+void PollLogTailer();
+void RestartLogSearch();
+void UpdateLogSearch();
+void JumpToLogMatch(bool forward);
 
 // === 图表功能 ===
 void ShowPlotWindow(bool* p_open);
 void DemoMeshPlots(bool* p_open);
+void OpenMeshFile();
+void OpenSurfaceSolutionFile();
+void SelectSurfaceField(int field);
 
 #endif // IMGUI_APP_H
\ No newline at end of file
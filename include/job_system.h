@@ -0,0 +1,127 @@
+/********************************************************************
+MIT License
+
+Copyright (c) 2025 loong22
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*********************************************************************/
+
+#ifndef JOB_SYSTEM_H
+#define JOB_SYSTEM_H
+
+#include "file_io.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// 后台任务在工作线程中使用的上下文：汇报进度、检查是否已被取消
+class JobContext {
+public:
+    bool IsCancelled() const { return m_Cancelled.load(std::memory_order_relaxed); }
+    // total 为 0 时界面显示为进度未知
+    void SetProgress(uint64_t processed, uint64_t total) {
+        m_Total.store(total, std::memory_order_relaxed);
+        m_Processed.store(processed, std::memory_order_relaxed);
+    }
+    // 直接传给 LoadFile()/SaveFile() 等函数：汇报进度，取消后让其提前返回
+    FileProgressCallback GetProgressCallback() {
+        return [this](uint64_t processed, uint64_t total) {
+            SetProgress(processed, total);
+            return !IsCancelled();
+        };
+    }
+
+private:
+    friend class JobSystem;
+    std::atomic<bool> m_Cancelled{false};
+    std::atomic<uint64_t> m_Processed{0};
+    std::atomic<uint64_t> m_Total{0};
+};
+
+// work 在工作线程中执行，只能访问自己捕获的数据，不能访问界面线程的状态。
+// finish 在界面线程调用 Poll() 时执行，completed 为 false 表示任务被取消或抛出了异常；
+// 结果只在 finish 中写回 g_AppState，界面代码因此不需要加锁
+using JobWork = std::function<void(JobContext& context)>;
+using JobFinish = std::function<void(bool completed)>;
+
+// 供界面显示的任务状态
+struct JobStatus {
+    uint64_t id = 0;
+    std::string name;
+    uint64_t processed = 0;
+    uint64_t total = 0;
+    bool running = false;               // false 表示仍在排队
+    bool cancelRequested = false;
+};
+
+// 后台任务系统
+// 少量常驻工作线程从队列中依次取出文件读写等耗时任务并发执行，任务的开始顺序与提交顺序一致，
+// 但可能同时执行、以任意顺序完成；访问同一资源的任务由调用方保证不同时提交（例如 g_AppState.fileJob
+// 让文件读写一次只有一个）。界面线程每帧调用一次 Poll()，在帧与帧之间执行已完成任务的 finish，
+// 渲染循环不会被 I/O 阻塞。
+class JobSystem {
+public:
+    JobSystem() = default;
+    ~JobSystem();
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    // 提交任务，返回任务编号（从 1 开始）。第一次提交时启动工作线程
+    uint64_t Submit(const std::string& name, JobWork work, JobFinish finish = nullptr);
+    // 请求取消；排队中的任务不再执行，正在执行的任务由 work 自行检查 IsCancelled()
+    void Cancel(uint64_t jobId);
+    // 取消全部任务并等待工作线程退出，未执行的 finish 不再调用
+    void Stop();
+    // 界面线程每帧调用一次，执行已完成任务的 finish
+    void Poll();
+
+    bool HasJobs() const;
+    void GetStatus(std::vector<JobStatus>& jobs) const;
+
+private:
+    struct Job {
+        uint64_t id = 0;
+        std::string name;
+        JobWork work;
+        JobFinish finish;
+        JobContext context;
+        bool running = false;
+        bool completed = false;
+    };
+
+    void ThreadMain();
+
+    mutable std::mutex m_Mutex;
+    std::condition_variable m_Condition;
+    std::vector<std::thread> m_Threads;
+    std::deque<std::shared_ptr<Job>> m_Queue;      // 等待执行
+    std::vector<std::shared_ptr<Job>> m_Jobs;      // 尚未在 Poll() 中收尾的全部任务，按提交顺序
+    std::vector<std::shared_ptr<Job>> m_Finished;  // 已执行完、等待调用 finish
+    uint64_t m_NextId = 1;
+    bool m_StopRequested = false;
+};
+
+#endif // JOB_SYSTEM_H
@@ -0,0 +1,121 @@
+/********************************************************************
+MIT License
+
+Copyright (c) 2025 loong22
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*********************************************************************/
+
+#ifndef LOG_SEARCH_H
+#define LOG_SEARCH_H
+
+#include "spsc_ring.h"
+#include "worker_pool.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct LogSearchOptions {
+    std::string pattern;
+    bool regex = false;                  // 按 ECMAScript 正则表达式逐行匹配，否则按子串查找
+    bool caseSensitive = false;          // 子串查找时只对 ASCII 字母忽略大小写
+};
+
+// 后台搜索线程交给界面线程的一批结果
+struct LogSearchBatch {
+    uint64_t generation = 0;             // 所属的搜索，界面线程据此丢弃已被取消的搜索的结果
+    uint64_t scannedEnd = 0;             // 已搜索到的文件偏移
+    int lineCount = 0;                   // 已搜索的完整行数
+    std::vector<int> matchLines;         // 本批新增的匹配行号，递增
+    bool tailMatch = false;              // 末尾尚未以换行结束的一行（行号 lineCount）是否匹配
+    std::string error;                   // 正则表达式无效时的错误信息
+};
+
+// 日志搜索
+// 后台线程把日志按块映射，每块在换行处切成若干段交给常驻的 WorkerPool 并行查找；
+// 子串查找用 SSE2 同时比较首尾字符筛选候选位置，再逐字节确认。
+// 结果以“匹配行位图 + 递增的匹配行号”保存在界面线程，日志追加后只搜索新增内容。
+// 行号的划分与 LogSource 一致：第 k 行从第 k 个换行符之后开始。
+class LogSearcher {
+public:
+    LogSearcher() = default;
+    ~LogSearcher();
+    LogSearcher(const LogSearcher&) = delete;
+    LogSearcher& operator=(const LogSearcher&) = delete;
+
+    // 取消当前搜索，从文件开头重新搜索 [0, endOffset)；pattern 为空时只清除结果
+    void Start(const std::string& filePath, const LogSearchOptions& options, uint64_t endOffset);
+    // 日志的已索引范围增长后调用，只搜索新增的字节
+    void Extend(uint64_t endOffset);
+    void Clear();
+    void Stop();
+    // 界面线程每帧调用，合并后台线程送来的结果
+    void Poll();
+
+    bool IsActive() const { return !m_Options.pattern.empty() && m_Error.empty(); }
+    bool IsSearching() const { return IsActive() && m_ScannedEnd < m_TargetEnd; }
+    const LogSearchOptions& GetOptions() const { return m_Options; }
+    const std::string& GetPath() const { return m_Path; }
+    const std::string& GetError() const { return m_Error; }
+    uint64_t GetScannedEnd() const { return m_ScannedEnd; }
+    uint64_t GetTargetEnd() const { return m_TargetEnd; }
+
+    int GetMatchCount() const { return static_cast<int>(m_MatchLines.size()) + (m_TailMatch ? 1 : 0); }
+    // matchIndex 在 [0, GetMatchCount()) 内，返回对应的行号
+    int GetMatchLine(int matchIndex) const;
+    bool IsMatch(int lineIndex) const;
+    // 返回行号不小于 lineIndex 的第一个匹配的序号，没有时返回 GetMatchCount()
+    int LowerBoundMatch(int lineIndex) const;
+    // lineIndex 之后（forward）或之前最近的匹配行，越过末尾时回绕；没有匹配时返回 -1
+    int FindNextMatch(int lineIndex, bool forward) const;
+
+private:
+    void ThreadMain();
+    bool PushBatch(LogSearchBatch& batch, uint64_t generation);
+
+    // 界面线程的状态
+    std::string m_Path;
+    LogSearchOptions m_Options;
+    std::string m_Error;
+    uint64_t m_Generation = 0;
+    uint64_t m_TargetEnd = 0;
+    uint64_t m_ScannedEnd = 0;
+    int m_LineCount = 0;                   // 位图覆盖的完整行数
+    std::vector<uint64_t> m_MatchBits;     // 每行一位
+    std::vector<int> m_MatchLines;
+    bool m_TailMatch = false;
+
+    // 交给后台线程的任务，受 m_Mutex 保护；m_JobGeneration 同时供后台线程检查是否已被取消
+    std::thread m_Thread;
+    std::mutex m_Mutex;
+    std::condition_variable m_Condition;
+    std::atomic<uint64_t> m_JobGeneration{0};
+    std::string m_JobPath;
+    LogSearchOptions m_JobOptions;
+    uint64_t m_JobEnd = 0;
+    bool m_StopRequested = false;
+    SpscRing<LogSearchBatch, 64> m_Batches;
+    WorkerPool m_Workers;                  // 分段并行搜索的线程，只由后台线程使用
+};
+
+#endif // LOG_SEARCH_H
@@ -0,0 +1,120 @@
+/********************************************************************
+MIT License
+
+Copyright (c) 2025 loong22
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*********************************************************************/
+
+#ifndef LOG_SOURCE_H
+#define LOG_SOURCE_H
+
+#include "su2_history.h"
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// 后台线程建立好的一批行索引，由 LogTailer 交给界面线程
+struct LogLineBatch {
+    uint64_t begin = 0;                  // 本批覆盖的字节范围 [begin, end)
+    uint64_t end = 0;
+    uint64_t fileSize = 0;
+    std::time_t lastModified = 0;
+    bool fileAvailable = false;
+    bool reset = false;                  // 文件被截断或要求重新读取，先丢弃已有索引
+    std::vector<uint64_t> lineOffsets;   // 本批中各行的起始偏移
+    Su2HistoryUpdate history;            // 本批内容中解析出的收敛历史
+};
+
+// 建立索引时依次收到的文件内容块（offset 为块在文件中的偏移），数据只在回调期间有效
+using LogChunkCallback = std::function<void(uint64_t offset, const char* data, size_t size)>;
+
+// 日志数据源
+// 日志文件按窗口做内存映射（Windows 使用 MapViewOfFile，其他平台使用 mmap），
+// 映射失败时回退为按窗口读取文件。整个文件只保留行偏移索引，
+// 行内容以 string_view 的形式直接指向当前驻留窗口，常驻内存与日志大小无关。
+class LogSource {
+public:
+    LogSource() = default;
+    ~LogSource();
+    LogSource(const LogSource&) = delete;
+    LogSource& operator=(const LogSource&) = delete;
+
+    bool Open(const std::string& filePath);
+    void Close();
+    // 清空行索引，下次 Refresh() 时从文件开头重新建立
+    void Reset();
+    // 检查文件大小并为新追加的字节建立行索引，文件变短时从头重建。
+    // onChunk 依次收到新追加的内容，可用于流式解析
+    bool Refresh(const LogChunkCallback& onChunk = nullptr);
+    // 接收后台线程建立的行索引；批次与当前索引不衔接时丢弃并返回 false
+    bool ApplyBatch(LogLineBatch& batch);
+
+    bool IsOpen() const { return !m_Path.empty(); }
+    const std::string& GetPath() const { return m_Path; }
+    uint64_t GetFileSize() const { return m_FileSize; }
+    uint64_t GetIndexedSize() const { return m_IndexedSize; }
+    std::time_t GetLastModified() const { return m_LastModified; }
+    bool IsFileAvailable() const { return m_FileAvailable; }
+    int GetLineCount() const;
+
+    // 确保 [firstLine, lastLine) 行位于驻留窗口内，之后才能调用 GetLine()
+    bool MapLines(int firstLine, int lastLine);
+    // 返回的视图在下一次 MapLines()/Reset() 之前有效，不含行尾的 \r\n
+    std::string_view GetLine(int lineIndex) const;
+
+    bool IsMemoryMapped() const { return m_Window.mapBase != nullptr; }
+    size_t GetResidentBytes() const { return static_cast<size_t>(m_Window.end - m_Window.begin); }
+
+    static bool QueryFileInfo(const std::string& filePath, uint64_t& fileSize, std::time_t& lastModified);
+    // 按块映射文件 [begin, end) 并依次交给 onChunk，返回实际读完的末尾偏移（文件被截断时提前结束）
+    static uint64_t ReadRange(const std::string& filePath, uint64_t begin, uint64_t end, const LogChunkCallback& onChunk);
+    // 扫描文件 [begin, end) 中的换行符，把新行的起始偏移追加到 lineOffsets（从文件开头扫描时先加入首行）。
+    // 返回实际完成扫描的末尾偏移
+    static uint64_t IndexRange(const std::string& filePath, uint64_t begin, uint64_t end, std::vector<uint64_t>& lineOffsets,
+        const LogChunkCallback& onChunk = nullptr);
+
+private:
+    // 文件中 [begin, end) 字节的一段映射或回退缓冲
+    struct Region {
+        const char* data = nullptr;   // 指向文件偏移 begin 处
+        uint64_t begin = 0;
+        uint64_t end = 0;
+        void* mapBase = nullptr;      // 按页/分配粒度对齐后的映射基址
+        size_t mapSize = 0;
+        std::vector<char> buffer;     // 映射失败时的读文件回退
+    };
+
+    static bool MapRegion(const std::string& filePath, uint64_t begin, uint64_t end, Region& region);
+    static void UnmapRegion(Region& region);
+    uint64_t GetLineEnd(int lineIndex) const;
+
+    std::string m_Path;
+    std::vector<uint64_t> m_LineOffsets;   // 每行的起始偏移
+    uint64_t m_IndexedSize = 0;
+    uint64_t m_FileSize = 0;
+    std::time_t m_LastModified = 0;
+    bool m_FileAvailable = false;
+    Region m_Window;                       // 供界面显示的驻留窗口
+};
+
+#endif // LOG_SOURCE_H
@@ -0,0 +1,91 @@
+/********************************************************************
+MIT License
+
+Copyright (c) 2025 loong22
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*********************************************************************/
+
+
+#ifndef LOG_TAILER_H
+#define LOG_TAILER_H
+
+#include "log_source.h"
+#include "spsc_ring.h"
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+// 后台日志跟踪线程
+// 监视日志所在目录（Linux 使用 inotify，Windows 使用目录变更通知），
+// 同时按刷新间隔用 stat 轮询，以兼顾不产生通知的网络文件系统。
+// 新追加的字节在后台线程中建立行索引，通过无锁队列交给界面线程，界面线程每帧只需 Poll()。
+class LogTailer {
+public:
+    LogTailer() = default;
+    ~LogTailer();
+    LogTailer(const LogTailer&) = delete;
+    LogTailer& operator=(const LogTailer&) = delete;
+
+    // 从 startOffset 处开始跟踪；必须与 LogSource 当前已索引的大小一致。
+    // 线程运行期间 historyParser 归后台线程使用，Stop() 之后才能在其他线程访问
+    void Start(const std::string& filePath, uint64_t startOffset, float intervalSeconds, Su2HistoryParser* historyParser);
+    void Stop();
+    bool IsRunning() const { return m_Thread.joinable(); }
+
+    void SetInterval(float intervalSeconds);
+    // 下一次检查时从文件开头重新建立索引
+    void RequestRescan() { m_RescanRequested.store(true); }
+    // 界面线程调用，取出一批已建立好的行索引
+    bool Poll(LogLineBatch& batch) { return m_Batches.Pop(batch); }
+    // 每交出一批后在后台线程中调用，用于唤醒空闲等待中的界面线程；需在 Start() 之前设置
+    void SetWakeCallback(std::function<void()> onBatch) { m_OnBatch = std::move(onBatch); }
+
+private:
+    void ThreadMain(uint64_t startOffset);
+    bool OpenWatcher();
+    void CloseWatcher();
+    void WaitForChange(int timeoutMs);
+    void Wake();
+
+    std::string m_Path;
+    Su2HistoryParser* m_HistoryParser = nullptr;
+    std::function<void()> m_OnBatch;
+    std::thread m_Thread;
+    std::atomic<bool> m_StopRequested{false};
+    std::atomic<bool> m_RescanRequested{false};
+    std::atomic<int> m_IntervalMs{1000};
+    SpscRing<LogLineBatch, 64> m_Batches;
+
+#if defined(_WIN32)
+    void* m_StopEvent = nullptr;
+    void* m_ChangeHandle = nullptr;
+#elif defined(__linux__)
+    int m_InotifyFd = -1;
+    int m_WakeFd = -1;
+#else
+    std::mutex m_WaitMutex;
+    std::condition_variable m_WaitCondition;
+#endif
+};
+
+#endif // LOG_TAILER_H
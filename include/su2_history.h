@@ -0,0 +1,91 @@
+/********************************************************************
+MIT License
+
+Copyright (c) 2025 loong22
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*********************************************************************/
+
+
+#ifndef SU2_HISTORY_H
+#define SU2_HISTORY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "implot.h"
+
+// 一次解析得到的收敛历史增量，由解析线程交给界面线程
+struct Su2HistoryUpdate {
+    bool reset = false;                    // 日志从头读取或出现新的表头，先丢弃已有数据
+    std::vector<std::string> columnNames;  // reset 时的新列名（可以为空）
+    std::vector<double> values;            // 按行存放，每行 columnCount 个数
+    int columnCount = 0;
+
+    void MarkReset();
+};
+
+// SU2 收敛历史的流式解析器
+// 识别屏幕输出表格（|  Inner_Iter|   rms[Rho]| ...）和 history.csv（"Inner_Iter","rms[Rho]",...）两种格式。
+// 数据可以按任意字节块输入，跨块的半行保留到下一次输入。
+class Su2HistoryParser {
+public:
+    void Reset();
+    // offset 为本块在日志文件中的偏移，从文件开头输入时自动重置
+    void FeedChunk(uint64_t offset, const char* data, size_t size, Su2HistoryUpdate& update);
+
+private:
+    void ParseLine(std::string_view line, Su2HistoryUpdate& update);
+
+    std::string m_PartialLine;
+    std::vector<std::string> m_ColumnNames;
+    std::vector<std::string_view> m_Cells;   // 复用的临时数组，避免每行分配
+    std::vector<double> m_RowValues;
+};
+
+// 按列存放的收敛历史，ImPlot 可以直接绘制各列
+class Su2History {
+public:
+    void Clear();
+    void Apply(const Su2HistoryUpdate& update);
+
+    int GetColumnCount() const { return static_cast<int>(m_Columns.size()); }
+    int GetRowCount() const { return m_Columns.empty() ? 0 : static_cast<int>(m_Columns[0].size()); }
+    const std::string& GetColumnName(int column) const { return m_ColumnNames[column]; }
+    const double* GetColumnData(int column) const { return m_Columns[column].data(); }
+    // 供 ImPlot 直接绘制的分块曲线：x 为迭代步（没有迭代步列时为行号），残差列已还原为 10^值
+    const ImPlotSeriesBuffer& GetColumnSeries(int column) const { return *m_Series[column]; }
+    // 优先返回 Inner_Iter 列，没有迭代步列时返回 -1
+    int FindIterationColumn() const;
+
+    static bool IsIterationName(const std::string& name);
+    static bool IsResidualName(const std::string& name);
+
+private:
+    std::vector<std::string> m_ColumnNames;
+    std::vector<std::vector<double>> m_Columns;
+    std::vector<std::unique_ptr<ImPlotSeriesBuffer>> m_Series;
+    std::vector<double> m_SeriesXs;   // 追加曲线时复用的临时数组
+    std::vector<double> m_SeriesYs;
+};
+
+#endif // SU2_HISTORY_H
@@ -0,0 +1,89 @@
+/********************************************************************
+MIT License
+
+Copyright (c) 2025 loong22
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*********************************************************************/
+
+#ifndef SU2_MESH_H
+#define SU2_MESH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "file_io.h"
+#include "implot3d.h"
+
+// 一个边界标记（MARKER_TAG）在三角形索引数组中的范围
+struct Su2Marker {
+    std::string tag;
+    size_t firstIndex = 0;   // 在 Su2Mesh::triangles 中的起始位置
+    size_t indexCount = 0;   // 索引个数，3 的倍数；二维网格的边界是线段，为 0
+};
+
+// 读入后可直接交给 ImPlot3D::PlotMesh 的网格。
+// 三维网格只保留边界标记上的面单元；二维网格保留全部单元，z 坐标为 0。四边形拆成两个三角形。
+struct Su2Mesh {
+    int dimension = 0;
+    uint64_t elementCount = 0;              // NELEM，包括没有显示的体单元
+    std::vector<ImPlot3DPoint> points;
+    std::vector<unsigned int> triangles;
+    std::vector<Su2Marker> markers;
+    ImPlot3DPoint boundsMin;
+    ImPlot3DPoint boundsMax;
+
+    void Clear();
+};
+
+// surface_flow.csv：边界上每个点的坐标和解变量，按列存放
+struct Su2SurfaceSolution {
+    std::vector<std::string> fieldNames;    // 除 PointID 和坐标以外的列
+    std::vector<unsigned int> pointIds;     // 每行对应的网格点编号，文件没有 PointID 列时为空
+    std::vector<ImPlot3DPoint> points;
+    std::vector<std::vector<float>> fields; // fields[列][行]
+
+    void Clear();
+    int GetRowCount() const { return static_cast<int>(points.size()); }
+    int FindField(const char* name) const;
+};
+
+// 解析统计，用于在界面上显示吞吐量
+struct Su2LoadStats {
+    uint64_t bytes = 0;
+    double seconds = 0.0;
+
+    double GetMegabytesPerSecond() const { return seconds > 0.0 ? bytes / (1024.0 * 1024.0) / seconds : 0.0; }
+};
+
+// 流式读取 SU2 原生网格（NDIME/NELEM/NPOIN/NMARK），多区域网格只读取第一个区域。失败时 error 给出原因。
+// onProgress 每读入一块调用一次，返回 false 时取消读取
+bool LoadSu2Mesh(const std::string& filePath, Su2Mesh& mesh, Su2LoadStats& stats, std::string& error,
+    const FileProgressCallback& onProgress = nullptr);
+
+// 流式读取 SU2 输出的 surface_flow.csv
+bool LoadSu2SurfaceSolution(const std::string& filePath, Su2SurfaceSolution& solution, Su2LoadStats& stats, std::string& error,
+    const FileProgressCallback& onProgress = nullptr);
+
+// 按 PointID 把表面解的一列映射到网格顶点上，得到逐顶点的标量，没有对应行的顶点为 NaN。
+// 文件没有 PointID 列时只在行数与点数相同的情况下按行号对应
+bool MapSurfaceField(const Su2Mesh& mesh, const Su2SurfaceSolution& solution, int field, std::vector<float>& values);
+
+#endif // SU2_MESH_H
@@ -0,0 +1,76 @@
+/********************************************************************
+MIT License
+
+Copyright (c) 2025 loong22
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*********************************************************************/
+
+#ifndef WORKER_POOL_H
+#define WORKER_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// 每帧都要执行的计算（如 ImPlot 大数据量曲线的图元生成）使用的常驻线程池
+// 与 JobSystem 不同，ParallelFor 是同步的：调用线程也参与执行，全部任务完成后才返回。
+// 同一时刻只能有一个线程调用 ParallelFor，任务中不能再次调用 ParallelFor。
+class WorkerPool {
+public:
+    using Task = void (*)(int index, void* taskData);
+
+    WorkerPool() = default;
+    ~WorkerPool();
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    // 启动工作线程，threadCount 包含调用线程，0 表示按 CPU 核数；已启动时先停止
+    void Start(int threadCount = 0);
+    void Stop();
+    // 参与执行的线程数（含调用线程），未启动时为 1
+    int GetThreadCount() const { return static_cast<int>(m_Threads.size()) + 1; }
+
+    // 对 [0, count) 中的每个 index 调用一次 task(index, taskData)
+    void ParallelFor(int count, Task task, void* taskData);
+    // 签名与 ImPlotParallelFor 一致，userData 为 WorkerPool*
+    static void ParallelForCallback(int count, Task task, void* taskData, void* userData);
+
+private:
+    void ThreadMain();
+    void RunTasks(Task task, void* taskData, int count);
+
+    std::vector<std::thread> m_Threads;
+    std::mutex m_Mutex;
+    std::condition_variable m_WakeCondition;
+    std::condition_variable m_DoneCondition;
+    // 以下受 m_Mutex 保护；m_Next 在 m_Active 不为 0 时由各线程原子地领取
+    uint64_t m_Generation = 0;              // 每次 ParallelFor 递增，唤醒工作线程
+    Task m_Task = nullptr;
+    void* m_TaskData = nullptr;
+    int m_Count = 0;
+    std::atomic<int> m_Next{0};
+    int m_Active = 0;                       // 正在领取任务的工作线程数
+    bool m_StopRequested = false;
+};
+
+#endif // WORKER_POOL_H
@@ -68,6 +68,10 @@
 #define IMPLOT_AUTO_COL ImVec4(0,0,0,-1)
 // Macro for templated plotting functions; keeps header clean.
 #define IMPLOT_TMP template <typename T> IMPLOT_API
+// Number of points per ImPlotSeriesBuffer chunk (must be a power of two).
+#ifndef IMPLOT_SERIES_CHUNK_SIZE
+#define IMPLOT_SERIES_CHUNK_SIZE 4096
+#endif
 
 //-----------------------------------------------------------------------------
 // [SECTION] Enums and Types
@@ -75,6 +79,7 @@
 
 // Forward declarations
 struct ImPlotContext;             // ImPlot context (opaque struct, see implot_internal.h)
+struct ImPlotSeriesChunk;         // Storage chunk of an ImPlotSeriesBuffer (opaque struct, see implot_internal.h)
 
 // Enums/Flags
 typedef int ImAxis;                   // -> enum ImAxis_
@@ -234,12 +239,14 @@ enum ImPlotLineFlags_ {
     ImPlotLineFlags_SkipNaN     = 1 << 12, // NaNs values will be skipped instead of rendered as missing data
     ImPlotLineFlags_NoClip      = 1 << 13, // markers (if displayed) on the edge of a plot will not be clipped
     ImPlotLineFlags_Shaded      = 1 << 14, // a filled region between the line and horizontal origin will be rendered; use PlotShaded for more advanced cases
+    ImPlotLineFlags_LOD         = 1 << 15, // the line will be decimated to min/max/first/last per pixel column using a cached pyramid (x values must be ascending; data is assumed append-only)
 };
 
 // Flags for PlotScatter
 enum ImPlotScatterFlags_ {
-    ImPlotScatterFlags_None   = 0,       // default
-    ImPlotScatterFlags_NoClip = 1 << 10, // markers on the edge of a plot will not be clipped
+    ImPlotScatterFlags_None    = 0,       // default
+    ImPlotScatterFlags_NoClip  = 1 << 10, // markers on the edge of a plot will not be clipped
+    ImPlotScatterFlags_Density = 1 << 11, // points are counted per pixel and drawn as an image of the counts, color mapped on a log scale, instead of as markers
 };
 
 // Flags for PlotStairs
@@ -297,6 +304,8 @@ enum ImPlotPieChartFlags_ {
 enum ImPlotHeatmapFlags_ {
     ImPlotHeatmapFlags_None     = 0,       // default
     ImPlotHeatmapFlags_ColMajor = 1 << 10, // data will be read in column major order
+    ImPlotHeatmapFlags_Min      = 1 << 11, // PlotHeatmapPyramid: coarse cells show the minimum of the cells they cover (default is the mean)
+    ImPlotHeatmapFlags_Max      = 1 << 12, // PlotHeatmapPyramid: coarse cells show the maximum of the cells they cover
 };
 
 // Flags for PlotHistogram and PlotHistogram2D
@@ -579,6 +588,53 @@ struct ImPlotInputMap {
     IMPLOT_API ImPlotInputMap();
 };
 
+// Growable, append-only series owned by ImPlot. Points are stored in fixed-size chunks that keep
+// running x/y bounds, so auto-fitting and culling a buffer passed to PlotLine/PlotScatter costs
+// O(chunks) instead of O(points). A non-zero capacity turns the buffer into a ring: once it holds
+// more than capacity points, whole chunks are dropped from the front.
+struct ImPlotSeriesBuffer {
+    ImVector<ImPlotSeriesChunk*> Chunks;   // chunk i holds points [i*IMPLOT_SERIES_CHUNK_SIZE, (i+1)*IMPLOT_SERIES_CHUNK_SIZE)
+    ImPlotRect                   Bounds;   // bounds of all finite x and y values; Min > Max while empty
+    int                          Size;     // number of points stored
+    int                          Capacity; // maximum number of points kept (rounded up to whole chunks), or 0 for unbounded
+    int                          Version;  // incremented on every modification; usable as a cache key
+    IMPLOT_API ImPlotSeriesBuffer(int capacity = 0);
+    IMPLOT_API ~ImPlotSeriesBuffer();
+    IMPLOT_API void        AddPoint(double x, double y);
+    IMPLOT_API void        AddPoints(const double* xs, const double* ys, int count);
+    IMPLOT_API void        Clear();
+    IMPLOT_API ImPlotPoint GetPoint(int idx) const;
+private:
+    ImPlotSeriesBuffer(const ImPlotSeriesBuffer&);
+    ImPlotSeriesBuffer& operator=(const ImPlotSeriesBuffer&);
+};
+
+// Geometry emitted into the plot draw list by one visible item in one frame. See GetItemDrawStats().
+struct ImPlotItemDrawStats {
+    ImGuiID     ID;         // item ID
+    const char* PlotTitle;  // title of the plot that owns the item (empty for "##" titles)
+    const char* Label;      // item label, without the "##" suffix
+    int         VtxCount;   // vertices added between BeginItem and EndItem
+    int         IdxCount;   // indices added between BeginItem and EndItem
+    int         CmdCount;   // draw commands added between BeginItem and EndItem
+};
+
+// Bins of a histogram computed by BinHistogram or BinHistogram2D. Counts holds YBins rows of XBins values, row 0 and
+// column 0 starting at Range.Y.Min and Range.X.Min, with the Cumulative, Density and NoOutliers flags already applied.
+struct ImPlotHistogramBins {
+    const double* Counts;   // bin counts or densities, owned by the ImPlot context
+    int           XBins;    // number of bins along x
+    int           YBins;    // number of bins along y (1 for BinHistogram)
+    ImPlotRect    Range;    // binned range (Range.Y is unused by BinHistogram)
+    double        Width;    // bin size along x
+    double        Height;   // bin size along y (0 for BinHistogram)
+    double        MaxCount; // largest entry of Counts
+    int           Count;    // number of samples
+    int           Counted;  // number of samples inside Range
+
+    ImPlotHistogramBins() { Counts = nullptr; XBins = YBins = 0; Width = Height = 0; MaxCount = 0; Count = Counted = 0; }
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Callbacks
 //-----------------------------------------------------------------------------
@@ -592,6 +648,19 @@ typedef ImPlotPoint (*ImPlotGetter)(int idx, void* user_data);
 // Callback signature for axis transform.
 typedef double (*ImPlotTransform)(double value, void* user_data);
 
+// Callback signature for one task of a parallel loop.
+typedef void (*ImPlotParallelTask)(int index, void* task_data);
+
+// Callback signature for a parallel loop. Must call task(i, task_data) once for every i in [0, count), possibly
+// from several threads at once, and return only after all calls have finished.
+typedef void (*ImPlotParallelFor)(int count, ImPlotParallelTask task, void* task_data, void* user_data);
+
+// Callback signatures for textures created through the renderer backend. Pixels are RGBA8 in IM_COL32 layout,
+// #width pixels per row. Update is only called with the size the texture was created with.
+typedef ImTextureID (*ImPlotCreateTexture)(const ImU32* pixels, int width, int height, void* user_data);
+typedef void (*ImPlotUpdateTexture)(ImTextureID tex_id, const ImU32* pixels, int width, int height, void* user_data);
+typedef void (*ImPlotDestroyTexture)(ImTextureID tex_id, void* user_data);
+
 namespace ImPlot {
 
 //-----------------------------------------------------------------------------
@@ -613,6 +682,21 @@ IMPLOT_API void SetCurrentContext(ImPlotContext* ctx);
 // See GImGui documentation in imgui.cpp for more details.
 IMPLOT_API void SetImGuiContext(ImGuiContext* ctx);
 
+// Opt-in multi-threaded primitive generation. Items with at least IMPLOT_PARALLEL_MIN_PRIMS primitives (line
+// segments, bars, markers, ...) are split into up to #max_tasks contiguous ranges that are run through #parallel_for,
+// e.g. on a worker pool. Each range is generated into its own staging buffers, which are then appended to the plot
+// draw list in order, so the output is the same as with a single thread. Getter callbacks (Plot*G) and custom axis
+// transforms must be safe to call from several threads while this is enabled. Pass nullptr to go back to serial.
+IMPLOT_API void SetParallelFor(ImPlotParallelFor parallel_for, void* user_data, int max_tasks);
+
+// Lets ImPlot draw into textures of the renderer backend. Heatmaps with at least IMPLOT_HEATMAP_TEXTURE_MIN_CELLS
+// cells are then color mapped on the CPU into an image with one texel per pixel of the plot area and drawn as a single
+// textured quad instead of one quad per cell. Markers of large series are likewise drawn as one quad per marker from a
+// sprite sheet rasterized once (see IMPLOT_MARKER_SPRITE_MAX_SIZE), and overlapping markers of very large series are
+// merged into one quad per pixel (see IMPLOT_MARKER_BIN_MIN). Textures still alive are destroyed by DestroyContext or the next call to
+// this function, so call it outside of a frame and keep the backend alive until then. Pass nullptr to go back to quads.
+IMPLOT_API void SetTextureBackend(ImPlotCreateTexture create, ImPlotUpdateTexture update, ImPlotDestroyTexture destroy, void* user_data);
+
 //-----------------------------------------------------------------------------
 // [SECTION] Begin/End Plot
 //-----------------------------------------------------------------------------
@@ -858,11 +942,16 @@ IMPLOT_API void SetNextAxesToFit();
 IMPLOT_TMP void PlotLine(const char* label_id, const T* values, int count, double xscale=1, double xstart=0, ImPlotLineFlags flags=0, int offset=0, int stride=sizeof(T));
 IMPLOT_TMP void PlotLine(const char* label_id, const T* xs, const T* ys, int count, ImPlotLineFlags flags=0, int offset=0, int stride=sizeof(T));
 IMPLOT_API void PlotLineG(const char* label_id, ImPlotGetter getter, void* data, int count, ImPlotLineFlags flags=0);
+IMPLOT_API void PlotLine(const char* label_id, const ImPlotSeriesBuffer& buffer, ImPlotLineFlags flags=0);
 
-// Plots a standard 2D scatter plot. Default marker is ImPlotMarker_Circle.
+// Plots a standard 2D scatter plot. Default marker is ImPlotMarker_Circle. With ImPlotScatterFlags_Density, the points are
+// counted on a grid of one cell per pixel of the plot area instead, on the parallel tasks of SetParallelFor, and the grid
+// is drawn as one texture of SetTextureBackend (as quads without one). Counting every point costs a full pass over the
+// data, so set a data version (SetNextItemDataVersion) to only count again when the data or the axis limits change.
 IMPLOT_TMP void PlotScatter(const char* label_id, const T* values, int count, double xscale=1, double xstart=0, ImPlotScatterFlags flags=0, int offset=0, int stride=sizeof(T));
 IMPLOT_TMP void PlotScatter(const char* label_id, const T* xs, const T* ys, int count, ImPlotScatterFlags flags=0, int offset=0, int stride=sizeof(T));
 IMPLOT_API void PlotScatterG(const char* label_id, ImPlotGetter getter, void* data, int count, ImPlotScatterFlags flags=0);
+IMPLOT_API void PlotScatter(const char* label_id, const ImPlotSeriesBuffer& buffer, ImPlotScatterFlags flags=0);
 
 // Plots a a stairstep graph. The y value is continued constantly to the right from every x position, i.e. the interval [x[i], x[i+1]) has the value y[i]
 IMPLOT_TMP void PlotStairs(const char* label_id, const T* values, int count, double xscale=1, double xstart=0, ImPlotStairsFlags flags=0, int offset=0, int stride=sizeof(T));
@@ -901,6 +990,14 @@ IMPLOT_TMP void PlotPieChart(const char* const label_ids[], const T* values, int
 // Plots a 2D heatmap chart. Values are expected to be in row-major order by default. Leave #scale_min and scale_max both at 0 for automatic color scaling, or set them to a predefined range. #label_fmt can be set to nullptr for no labels.
 IMPLOT_TMP void PlotHeatmap(const char* label_id, const T* values, int rows, int cols, double scale_min=0, double scale_max=0, const char* label_fmt="%.1f", const ImPlotPoint& bounds_min=ImPlotPoint(0,0), const ImPlotPoint& bounds_max=ImPlotPoint(1,1), ImPlotHeatmapFlags flags=0);
 
+// Plots a heatmap of a matrix too large to draw cell by cell. A mip pyramid of the values is built once, where coarse cells hold the mean of the
+// 2x2 cells below them (or their min/max, see ImPlotHeatmapFlags_Min/Max), and only the tiles intersecting the axis limits are drawn, from the
+// level closest to one cell per pixel. Tiles are color mapped into textures of SetTextureBackend, kept in an LRU cache of IMPLOT_HEATMAP_TILE_CACHE
+// tiles shared by all plots; without a texture backend the visible cells of that level are drawn as quads. With a data version (SetNextItemDataVersion)
+// the pyramid is rebuilt only when #values, the size, the flags or the version change; without one it is rebuilt on every call, so set a data
+// version and change it whenever the values change in place.
+IMPLOT_TMP void PlotHeatmapPyramid(const char* label_id, const T* values, int rows, int cols, double scale_min=0, double scale_max=0, const ImPlotPoint& bounds_min=ImPlotPoint(0,0), const ImPlotPoint& bounds_max=ImPlotPoint(1,1), ImPlotHeatmapFlags flags=0);
+
 // Plots a horizontal histogram. #bins can be a positive integer or an ImPlotBin_ method. If #range is left unspecified, the min/max of #values will be used as the range.
 // Otherwise, outlier values outside of the range are not binned. The largest bin count or density is returned.
 IMPLOT_TMP double PlotHistogram(const char* label_id, const T* values, int count, int bins=ImPlotBin_Sturges, double bar_scale=1.0, ImPlotRange range=ImPlotRange(), ImPlotHistogramFlags flags=0);
@@ -909,6 +1006,14 @@ IMPLOT_TMP double PlotHistogram(const char* label_id, const T* values, int count
 // #xs an #ys will be used as the ranges. Otherwise, outlier values outside of range are not binned. The largest bin count or density is returned.
 IMPLOT_TMP double PlotHistogram2D(const char* label_id, const T* xs, const T* ys, int count, int x_bins=ImPlotBin_Sturges, int y_bins=ImPlotBin_Sturges, ImPlotRect range=ImPlotRect(), ImPlotHistogramFlags flags=0);
 
+// Computes the bins PlotHistogram and PlotHistogram2D draw without plotting them. Min/max and bin counts are computed in one pass over the
+// data, split over the tasks of SetParallelFor for large arrays, and cached: while #values (#xs, #ys), #count, the bin settings and
+// #data_version are unchanged the previous result is returned, so change #data_version whenever the values change in place. PlotHistogram
+// and PlotHistogram2D share the cache when a data version was set with SetNextItemDataVersion, and bin again on every call otherwise.
+// Counts stays valid until the same histogram is binned again, or until the end of the next frame.
+IMPLOT_TMP ImPlotHistogramBins BinHistogram(const T* values, int count, ImU64 data_version, int bins=ImPlotBin_Sturges, ImPlotRange range=ImPlotRange(), ImPlotHistogramFlags flags=0);
+IMPLOT_TMP ImPlotHistogramBins BinHistogram2D(const T* xs, const T* ys, int count, ImU64 data_version, int x_bins=ImPlotBin_Sturges, int y_bins=ImPlotBin_Sturges, ImPlotRect range=ImPlotRect(), ImPlotHistogramFlags flags=0);
+
 // Plots digital data. Digital plots do not respond to y drag or zoom, and are always referenced to the bottom of the plot.
 IMPLOT_TMP void PlotDigital(const char* label_id, const T* xs, const T* ys, int count, ImPlotDigitalFlags flags=0, int offset=0, int stride=sizeof(T));
 IMPLOT_API void PlotDigitalG(const char* label_id, ImPlotGetter getter, void* data, int count, ImPlotDigitalFlags flags=0);
@@ -1000,10 +1105,20 @@ IMPLOT_API ImPlotRect GetPlotSelection(ImAxis x_axis = IMPLOT_AUTO, ImAxis y_axi
 // Cancels a the current plot box selection.
 IMPLOT_API void CancelPlotSelection();
 
+// Returns the per-item geometry of the last complete frame (the frame before the current one) and writes
+// the number of entries to count. The array and its strings stay valid until the next frame's stats are published.
+IMPLOT_API const ImPlotItemDrawStats* GetItemDrawStats(int* count);
+
 // Hides or shows the next plot item (i.e. as if it were toggled from the legend).
 // Use ImPlotCond_Always if you need to forcefully set this every frame.
 IMPLOT_API void HideNextItem(bool hidden = true, ImPlotCond cond = ImPlotCond_Once);
 
+// Declares that the data of the next plot item stays the same for as long as #version does. While the version,
+// the axes, the item flags and the item style all match the previous frame, the item replays the geometry it
+// generated then instead of rebuilding it. Change the version whenever the data or any other argument passed to
+// the PlotX function changes. Items plotted from an ImPlotSeriesBuffer use its Version automatically.
+IMPLOT_API void SetNextItemDataVersion(ImU64 version);
+
 // Use the following around calls to Begin/EndPlot to align l/r/t/b padding.
 // Consider using Begin/EndSubplots first. They are more feature rich and
 // accomplish the same behaviour by default. The functions below offer lower
@@ -59,6 +59,41 @@
 #define IMPLOT_LABEL_FORMAT "%g"
 // Max character size for tick labels
 #define IMPLOT_LABEL_MAX_SIZE 32
+// Number of levels in a line LOD pyramid (level k summarizes 8*4^k points)
+#define IMPLOT_LOD_MAX_LEVELS 12
+// Frames an unused line LOD pyramid is kept before it is freed
+#define IMPLOT_LOD_GC_FRAMES 120
+// Frames the cached geometry of an item that is no longer plotted is kept before it is freed
+#define IMPLOT_ITEM_GEOMETRY_GC_FRAMES 60
+// Items that emit more vertices than this are not cached
+#define IMPLOT_ITEM_GEOMETRY_MAX_VTX (1 << 21)
+// Items with at least this many primitives are generated in parallel once SetParallelFor was called
+#define IMPLOT_PARALLEL_MIN_PRIMS 65536
+// Smallest number of primitives handed to one parallel task
+#define IMPLOT_PARALLEL_MIN_CHUNK 16384
+// Lines and markers with at least this many points are converted to pixels in one batched pass before rendering
+#define IMPLOT_TRANSFORM_BATCH_MIN 1024
+// Number of points converted per block by the batched transform
+#define IMPLOT_TRANSFORM_BLOCK 256
+// Markers of batched series are drawn as one textured quad each once SetTextureBackend was called, for marker sizes up to
+// this many pixels (in steps of half a pixel) and outlines at most one pixel wide
+#define IMPLOT_MARKER_SPRITE_MAX_SIZE 16
+// Series with at least this many markers draw one sprite per pixel that markers land on, blended as if they were stacked
+#define IMPLOT_MARKER_BIN_MIN 16384
+// Heatmaps with at least this many cells are drawn as one texture once SetTextureBackend was called
+#define IMPLOT_HEATMAP_TEXTURE_MIN_CELLS 4096
+// Frames the texture or pyramid of a heatmap that is no longer plotted is kept before it is freed (longer than its cached geometry)
+#define IMPLOT_HEATMAP_TEXTURE_GC_FRAMES 120
+// Side of the square tiles PlotHeatmapPyramid color maps into textures
+#define IMPLOT_HEATMAP_TILE_SIZE 256
+// Number of tile textures in the LRU cache of PlotHeatmapPyramid, shared by all plots
+#define IMPLOT_HEATMAP_TILE_CACHE 256
+// Maximum number of levels in a heatmap pyramid, level 0 being the data itself
+#define IMPLOT_HEATMAP_MAX_LEVELS 16
+// Frames the bins of a histogram that is no longer computed are kept before they are freed
+#define IMPLOT_HISTOGRAM_GC_FRAMES 60
+// Bytes of the per task count grids of ImPlotScatterFlags_Density, large plot areas are counted by fewer tasks
+#define IMPLOT_DENSITY_GRID_BUDGET (64 << 20)
 
 //-----------------------------------------------------------------------------
 // [SECTION] Macros
@@ -229,6 +264,7 @@ static inline bool ImOverlaps(T min_a, T max_a, T min_b, T max_b) {
 typedef int ImPlotTimeUnit;    // -> enum ImPlotTimeUnit_
 typedef int ImPlotDateFmt;     // -> enum ImPlotDateFmt_
 typedef int ImPlotTimeFmt;     // -> enum ImPlotTimeFmt_
+typedef int ImPlotSimd;        // -> enum ImPlotSimd_
 
 enum ImPlotTimeUnit_ {
     ImPlotTimeUnit_Us,  // microsecond
@@ -264,6 +300,13 @@ enum ImPlotTimeFmt_ {              // default        [ 24 Hour Clock ]
     ImPlotTimeFmt_Hr               // 7pm            [ 19:00        ]
 };
 
+enum ImPlotSimd_ {                 // used by the batched point transform
+    ImPlotSimd_None = 0,           // scalar
+    ImPlotSimd_SSE2,               // 2 doubles per instruction
+    ImPlotSimd_AVX2,               // 4 doubles per instruction
+    ImPlotSimd_NEON                // 2 doubles per instruction (AArch64)
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Callbacks
 //-----------------------------------------------------------------------------
@@ -959,6 +1002,160 @@ struct ImPlotItem
     ~ImPlotItem() { ID = 0; }
 };
 
+// Storage chunk of an ImPlotSeriesBuffer
+struct ImPlotSeriesChunk
+{
+    double     Xs[IMPLOT_SERIES_CHUNK_SIZE];
+    double     Ys[IMPLOT_SERIES_CHUNK_SIZE];
+    ImPlotRect Bounds;    // bounds of the finite x and y values; Min > Max while empty
+    int        Count;
+    bool       AllFinite; // no NaN or infinite x/y values have been added
+};
+
+// Min/max summary of a contiguous run of points in a line LOD pyramid
+struct ImPlotLODNode
+{
+    double MinY, MaxY;
+    int    MinIdx, MaxIdx;
+};
+
+// Multi-resolution min/max pyramid cached per item for ImPlotLineFlags_LOD
+struct ImPlotLineLOD
+{
+    ImGuiID                 ID;
+    ImVector<ImPlotLODNode> Levels[IMPLOT_LOD_MAX_LEVELS]; // level k node i covers points [i*8*4^k, (i+1)*8*4^k)
+    int                     Count;                         // number of source points summarized
+    ImPlotPoint             First, Mid, Last;              // samples at 0, Count/2 and Count-1 used to detect data changes
+    bool                    Sorted;                        // source x values are ascending, required for decimation
+    int                     LastFrame;
+
+    ImPlotLineLOD() { ID = 0; Count = 0; Sorted = true; LastFrame = 0; }
+
+    void Reset() {
+        for (int k = 0; k < IMPLOT_LOD_MAX_LEVELS; ++k)
+            Levels[k].shrink(0);
+        Count  = 0;
+        Sorted = true;
+    }
+};
+
+// Geometry accounting of one item in the frame being recorded (see GetItemDrawStats)
+struct ImPlotItemDrawRecord
+{
+    ImGuiID ID;
+    int     PlotTitleOffset, LabelOffset;   // into ImPlotContext::ItemDrawNames
+    int     VtxCount, IdxCount, CmdCount;   // draw list sizes at BeginItem, replaced by the amount added at EndItem
+};
+
+// Everything besides the data that the geometry of an item depends on (see SetNextItemDataVersion).
+// Zero filled on construction so that keys can be compared with memcmp.
+struct ImPlotItemGeometryKey
+{
+    ImU64           DataVersion;
+    ImPlotItemFlags Flags;
+    ImPlotRange     Range[2];               // x and y axis of the item
+    float           PixelMin[2], PixelMax[2];
+    ImPlotTransform Transform[2];
+    void*           TransformData[2];
+    ImVec4          ClipRect;
+    ImVec4          Colors[5];
+    float           LineWeight, MarkerSize, MarkerWeight, ErrorBarSize, ErrorBarWeight;
+    ImPlotMarker    Marker;
+    ImPlotColormap  Colormap;
+    ImFont*         Font;
+    float           FontSize, Alpha;
+    ImDrawListFlags DrawListFlags;
+
+    ImPlotItemGeometryKey() { memset((void*)this, 0, sizeof(*this)); }
+};
+
+// Run of cached indices drawn with one clip rect and texture
+struct ImPlotItemGeometryCmd
+{
+    ImVec4      ClipRect;
+    ImTextureID TextureId;
+    int         IdxCount;
+};
+
+// Geometry an item emitted into the plot draw list, replayed while its key is unchanged
+struct ImPlotItemGeometry
+{
+    ImGuiID                         ID;
+    ImPlotItemGeometryKey           Key;
+    bool                            Valid;              // false until a recording completed
+    ImVector<ImDrawVert>            VtxBuffer;
+    ImVector<ImDrawIdx>             IdxBuffer;          // relative to the first vertex of VtxBuffer
+    ImVector<ImPlotItemGeometryCmd> Cmds;
+    int                             VtxStart, IdxStart; // draw list sizes when the recording started
+    int                             LastFrame;
+
+    ImPlotItemGeometry() { ID = 0; Valid = false; VtxStart = IdxStart = 0; LastFrame = 0; }
+};
+
+// Backend texture a large heatmap is color mapped into, one texel per pixel of the plot area
+struct ImPlotHeatmapTexture
+{
+    ImGuiID     ID;                 // same key as the item's ImPlotItemGeometry
+    ImTextureID TexID;
+    int         Width, Height;      // texture size, the image of the heatmap covers its top left part
+    int         LastFrame;          // last frame the texture was drawn, or the frame it was released
+
+    ImPlotHeatmapTexture() { ID = 0; TexID = 0; Width = Height = 0; LastFrame = 0; }
+};
+
+// Mip pyramid of a PlotHeatmapPyramid item. Level 0 is the user data, level k >= 1 holds ceil(Rows / 2^k) x
+// ceil(Cols / 2^k) values in row major order, each the mean, min or max of the 2x2 values below it.
+struct ImPlotHeatmapPyramid
+{
+    ImGuiID            ID;                 // plot and item ID
+    const void*        Values;             // data the pyramid was built from
+    int                Rows, Cols;
+    ImPlotHeatmapFlags Flags;              // ColMajor and the reduction
+    bool               HasDataVersion;
+    ImU64              DataVersion;
+    double             ValueMin, ValueMax; // range of the data, for automatic color scaling
+    ImU32              Generation;         // unique per build, part of the tile keys
+    int                LevelCount;
+    int                LevelRows[IMPLOT_HEATMAP_MAX_LEVELS];
+    int                LevelCols[IMPLOT_HEATMAP_MAX_LEVELS];
+    ImVector<float>    Levels[IMPLOT_HEATMAP_MAX_LEVELS]; // [0] is unused
+    int                LastFrame;
+
+    ImPlotHeatmapPyramid() { ID = 0; Values = nullptr; Rows = Cols = 0; Flags = 0; HasDataVersion = false; DataVersion = 0; ValueMin = ValueMax = 0; Generation = 0; LevelCount = 0; LastFrame = 0; }
+};
+
+// Color mapped tile of a heatmap pyramid level, kept in an LRU cache of backend textures
+struct ImPlotHeatmapTile
+{
+    ImGuiID     ID;                 // hash of the pyramid generation, level, tile position, colormap and scale
+    ImTextureID TexID;              // IMPLOT_HEATMAP_TILE_SIZE squared
+    ImGuiID     ItemID;             // pyramid and item geometry ID of the heatmap, replayed geometry still draws the tile
+    int         LastFrame;          // last frame the tile was drawn
+
+    ImPlotHeatmapTile() { ID = 0; TexID = 0; ItemID = 0; LastFrame = 0; }
+};
+
+// Min/max of the values of one histogram axis, and the sums its standard deviation is computed from
+struct ImPlotHistogramStats
+{
+    double Min, Max;        // NaN values are skipped; Min > Max if all values are NaN
+    double Sum, SumSq;      // of the values minus the shift of the axis
+};
+
+// Bins of a histogram, cached while its data and bin settings are unchanged (see BinHistogram)
+struct ImPlotHistogram
+{
+    ImGuiID             ID;             // hash of the data pointers, count, value type and bin settings
+    bool                Valid;          // false until the bins were computed once
+    bool                HasDataVersion;
+    ImU64               DataVersion;
+    ImVector<double>    Counts;
+    ImPlotHistogramBins Bins;           // Bins.Counts points into Counts
+    int                 LastFrame;
+
+    ImPlotHistogram() { ID = 0; Valid = false; HasDataVersion = false; DataVersion = 0; LastFrame = 0; }
+};
+
 // Holds Legend state
 struct ImPlotLegend
 {
@@ -1190,6 +1387,8 @@ struct ImPlotNextItemData {
     bool            HasHidden;
     bool            Hidden;
     ImPlotCond      HiddenCond;
+    bool            HasDataVersion;
+    ImU64           DataVersion;
     ImPlotNextItemData() { Reset(); }
     void Reset() {
         for (int i = 0; i < 5; ++i)
@@ -1197,6 +1396,8 @@ struct ImPlotNextItemData {
         LineWeight    = MarkerSize = MarkerWeight = FillAlpha = ErrorBarSize = ErrorBarWeight = DigitalBitHeight = DigitalBitGap = IMPLOT_AUTO;
         Marker        = IMPLOT_AUTO;
         HasHidden     = Hidden = false;
+        HasDataVersion = false;
+        DataVersion   = 0;
     }
 };
 
@@ -1231,6 +1432,65 @@ struct ImPlotContext {
     // Temp data for general use
     ImVector<double>   TempDouble1, TempDouble2;
     ImVector<int>      TempInt1;
+    ImVector<ImPlotPoint> TempPoint1;
+
+    // Line LOD pyramids, keyed by item ID
+    ImPool<ImPlotLineLOD> LineLODs;
+
+    // Last frame that freed the caches of items no longer plotted (see GcItemCaches)
+    int                   ItemCacheGcFrame;
+
+    // Per item geometry accounting (see GetItemDrawStats)
+    int                           ItemDrawFrame;      // frame that ItemDrawRecords belongs to
+    ImVector<ImPlotItemDrawRecord> ItemDrawRecords;   // items of ItemDrawFrame
+    ImVector<char>                ItemDrawNames;
+    ImVector<ImPlotItemDrawStats> ItemDrawStats;      // last complete frame, strings point into ItemDrawStatsNames
+    ImVector<char>                ItemDrawStatsNames;
+
+    // Item geometry cache, keyed by plot and item ID (see SetNextItemDataVersion)
+    ImPool<ImPlotItemGeometry>    ItemGeometries;
+    ImGuiID                       ItemGeometryRecordID; // entry recorded by the current item, or 0
+
+    // Parallel primitive generation (see SetParallelFor)
+    ImPlotParallelFor      ParallelFor;
+    void*                  ParallelForUserData;
+    int                    ParallelMaxTasks;
+    ImVector<ImDrawList*>  ParallelDrawLists;   // staging buffers, one per task
+    ImVector<unsigned int> ParallelOffsets;     // vertex and index offset of each task in the plot draw list
+
+    // Backend textures (see SetTextureBackend)
+    ImPlotCreateTexture   CreateTexture;
+    ImPlotUpdateTexture   UpdateTexture;
+    ImPlotDestroyTexture  DestroyTexture;
+    void*                 TextureUserData;
+    ImPool<ImPlotHeatmapTexture>   HeatmapTextures;     // keyed by plot and item ID
+    ImVector<ImPlotHeatmapTexture> ReleasedTextures;    // destroyed once the frame they may still be drawn in is over
+    ImVector<ImU32>       HeatmapPixels;                // scratch image, trimmed to what recent frames needed by GcItemCaches
+    int                   HeatmapPixelsPeak;            // largest size requested since HeatmapPixelsTrimFrame
+    int                   HeatmapPixelsTrimFrame;
+    ImVector<int>         HeatmapOffsets;               // value offset of each pixel column, then of each pixel row
+    ImPool<ImPlotHeatmapPyramid>   HeatmapPyramids;     // keyed by plot and item ID
+    ImPool<ImPlotHeatmapTile>      HeatmapTiles;        // tile textures of all pyramids, least recently drawn evicted first
+    ImU32                 HeatmapGeneration;
+    ImTextureID           MarkerTexture;                // sprite sheet of all marker shapes and sizes, created on first use
+    ImVector<int>         MarkerBinGrid;                // one past the bin of each pixel of the plot area, 0 if empty
+    ImVector<int>         MarkerBinCells;               // grid cell of each bin
+    ImVector<int>         MarkerBinCounts;              // markers in each bin
+    ImVector<ImVec2>      MarkerBinPoints;              // first marker of each bin
+    ImVector<ImU32>       MarkerBinColors;
+
+    // Histogram bins (see BinHistogram)
+    ImPool<ImPlotHistogram> Histograms;         // keyed by data and bin settings
+    ImVector<ImU32>         HistogramTaskCounts; // bin counts of each parallel task
+    ImVector<ImPlotHistogramStats> HistogramTaskStats; // min/max and sums of each parallel task and axis
+
+    // Scatter density images (see ImPlotScatterFlags_Density)
+    ImVector<ImU32>         DensityCounts;      // points per pixel of each parallel task
+    ImVector<ImU32>         DensityTaskMax;     // largest merged count of each parallel task
+
+    // Batched point transform (see PlotToPixelsBatch), also selects the SIMD kernels of texture heatmaps
+    ImPlotSimd         TransformSimd;
+    ImVector<ImVec2>   TransformedPoints;       // pixel positions of the item being rendered
 
     // Misc
     int                DigitalPlotItemCnt;
@@ -1311,21 +1571,35 @@ IMPLOT_API void ShowSubplotsContextMenu(ImPlotSubplot& subplot);
 // Begins a new item. Returns false if the item should not be plotted. Pushes PlotClipRect.
 IMPLOT_API bool BeginItem(const char* label_id, ImPlotItemFlags flags=0, ImPlotCol recolor_from=IMPLOT_AUTO);
 
-// Same as above but with fitting functionality.
+// Ends an item (call only if BeginItem returns true). Pops PlotClipRect.
+IMPLOT_API void EndItem();
+
+// Replays the cached geometry of the current item and returns true if the item has a data version (see
+// SetNextItemDataVersion) and nothing else it depends on changed. Otherwise starts recording what the item draws.
+IMPLOT_API bool BeginItemGeometry(ImPlotItemFlags flags);
+
+// Frees the cached geometry, line LODs, heatmap textures and pyramids of items that are no longer plotted and the bins of
+// histograms that are no longer computed, and trims the heatmap scratch image after a burst of large images. Does the work
+// once per frame, BeginPlot and BinHistogram call it.
+IMPLOT_API void GcItemCaches();
+
+// Same as above but with fitting and geometry caching functionality.
 template <typename _Fitter>
 bool BeginItemEx(const char* label_id, const _Fitter& fitter, ImPlotItemFlags flags=0, ImPlotCol recolor_from=IMPLOT_AUTO) {
     if (BeginItem(label_id, flags, recolor_from)) {
         ImPlotPlot& plot = *GetCurrentPlot();
         if (plot.FitThisFrame && !ImHasFlag(flags, ImPlotItemFlags_NoFit))
             fitter.Fit(plot.Axes[plot.CurrentX], plot.Axes[plot.CurrentY]);
+        // unchanged geometry was replayed from the cache, nothing is left to render
+        if (BeginItemGeometry(flags)) {
+            EndItem();
+            return false;
+        }
         return true;
     }
     return false;
 }
 
-// Ends an item (call only if BeginItem returns true). Pops PlotClipRect.
-IMPLOT_API void EndItem();
-
 // Register or get an existing item from the current plot.
 IMPLOT_API ImPlotItem* RegisterOrGetItem(const char* label_id, ImPlotItemFlags flags, bool* just_created = nullptr);
 // Get a plot item from the current plot.
@@ -1516,9 +1790,8 @@ void FillRange(ImVector<T>& buffer, int n, T vmin, T vmax) {
     }
 }
 
-// Calculate histogram bin counts and widths
-template <typename T>
-static inline void CalculateBins(const T* values, int count, ImPlotBin meth, const ImPlotRange& range, int& bins_out, double& width_out) {
+// Calculate histogram bin counts and widths, #std_dev being the standard deviation of the values (only used by ImPlotBin_Scott)
+static inline void CalculateBins(int count, double std_dev, ImPlotBin meth, const ImPlotRange& range, int& bins_out, double& width_out) {
     switch (meth) {
         case ImPlotBin_Sqrt:
             bins_out  = (int)ceil(sqrt(count));
@@ -1530,12 +1803,17 @@ static inline void CalculateBins(const T* values, int count, ImPlotBin meth, con
             bins_out  = (int)ceil(2 * cbrt(count));
             break;
         case ImPlotBin_Scott:
-            width_out = 3.49 * ImStdDev(values, count) / cbrt(count);
+            width_out = 3.49 * std_dev / cbrt(count);
             bins_out  = (int)round(range.Size() / width_out);
             break;
     }
     width_out = range.Size() / bins_out;
 }
+// Calculate histogram bin counts and widths
+template <typename T>
+static inline void CalculateBins(const T* values, int count, ImPlotBin meth, const ImPlotRange& range, int& bins_out, double& width_out) {
+    CalculateBins(count, meth == ImPlotBin_Scott ? ImStdDev(values, count) : 0.0, meth, range, bins_out, width_out);
+}
 
 //-----------------------------------------------------------------------------
 // Time Utils
@@ -1645,6 +1923,16 @@ static inline double TransformInverse_Logit(double v, void*) {
     return 1.0 / (1.0 + ImPow(10,-v));
 }
 
+// Returns the widest instruction set the batched point transform can use on this CPU.
+IMPLOT_API ImPlotSimd GetSimdSupport();
+// Selects the instruction set of the batched point transform, clamped to GetSimdSupport(), and returns the previous one.
+IMPLOT_API ImPlotSimd SetTransformSimd(ImPlotSimd simd);
+// Returns the name of an ImPlotSimd value.
+IMPLOT_API const char* GetSimdName(ImPlotSimd simd);
+// Converts #count points to pixels on the current plot's current axes, like PlotToPixels, but in blocks with SIMD
+// instructions. Log10 and SymLog axes use a vectorized logarithm on x86, custom transforms are called once per value.
+IMPLOT_API void PlotToPixelsBatch(const double* xs, const double* ys, int count, ImVec2* out);
+
 //-----------------------------------------------------------------------------
 // [SECTION] Formatters
 //-----------------------------------------------------------------------------
@@ -209,6 +209,102 @@ ImPlotStyle::ImPlotStyle() {
     UseISO8601       = false;
 }
 
+static inline void ResetSeriesBounds(ImPlotRect& bounds) {
+    bounds.X.Min = bounds.Y.Min = HUGE_VAL;
+    bounds.X.Max = bounds.Y.Max = -HUGE_VAL;
+}
+
+static inline void ExtendSeriesBounds(ImPlotRect& bounds, const ImPlotRect& other) {
+    bounds.X.Min = ImMin(bounds.X.Min, other.X.Min);
+    bounds.X.Max = ImMax(bounds.X.Max, other.X.Max);
+    bounds.Y.Min = ImMin(bounds.Y.Min, other.Y.Min);
+    bounds.Y.Max = ImMax(bounds.Y.Max, other.Y.Max);
+}
+
+ImPlotSeriesBuffer::ImPlotSeriesBuffer(int capacity) {
+    Size     = 0;
+    Capacity = capacity > 0 ? capacity : 0;
+    Version  = 0;
+    ResetSeriesBounds(Bounds);
+}
+
+ImPlotSeriesBuffer::~ImPlotSeriesBuffer() {
+    Clear();
+}
+
+void ImPlotSeriesBuffer::AddPoint(double x, double y) {
+    AddPoints(&x, &y, 1);
+}
+
+void ImPlotSeriesBuffer::AddPoints(const double* xs, const double* ys, int count) {
+    if (count <= 0)
+        return;
+    for (int i = 0; i < count; ) {
+        ImPlotSeriesChunk* chunk = Chunks.Size > 0 ? Chunks.back() : nullptr;
+        if (chunk == nullptr || chunk->Count == IMPLOT_SERIES_CHUNK_SIZE) {
+            chunk = (ImPlotSeriesChunk*)IM_ALLOC(sizeof(ImPlotSeriesChunk));
+            chunk->Count     = 0;
+            chunk->AllFinite = true;
+            ResetSeriesBounds(chunk->Bounds);
+            Chunks.push_back(chunk);
+        }
+        const int n = ImMin(count - i, IMPLOT_SERIES_CHUNK_SIZE - chunk->Count);
+        ImPlotRect& b = chunk->Bounds;
+        for (int k = chunk->Count, ke = k + n; k < ke; ++k, ++i) {
+            const double x = xs[i];
+            const double y = ys[i];
+            chunk->Xs[k] = x;
+            chunk->Ys[k] = y;
+            if (!ImNanOrInf(x)) {
+                b.X.Min = x < b.X.Min ? x : b.X.Min;
+                b.X.Max = x > b.X.Max ? x : b.X.Max;
+            }
+            else
+                chunk->AllFinite = false;
+            if (!ImNanOrInf(y)) {
+                b.Y.Min = y < b.Y.Min ? y : b.Y.Min;
+                b.Y.Max = y > b.Y.Max ? y : b.Y.Max;
+            }
+            else
+                chunk->AllFinite = false;
+        }
+        chunk->Count += n;
+        Size += n;
+        ExtendSeriesBounds(Bounds, b);
+    }
+    // drop whole chunks from the front while the remaining ones still hold Capacity points; only
+    // the last chunk can be partial, so chunk i keeps starting at point i*IMPLOT_SERIES_CHUNK_SIZE
+    if (Capacity > 0 && Size - Chunks[0]->Count >= Capacity) {
+        int drop = 0;
+        while (drop < Chunks.Size - 1 && Size - Chunks[drop]->Count >= Capacity) {
+            Size -= Chunks[drop]->Count;
+            IM_FREE(Chunks[drop]);
+            ++drop;
+        }
+        Chunks.erase(Chunks.Data, Chunks.Data + drop);
+        ResetSeriesBounds(Bounds);
+        for (int c = 0; c < Chunks.Size; ++c)
+            ExtendSeriesBounds(Bounds, Chunks[c]->Bounds);
+    }
+    ++Version;
+}
+
+void ImPlotSeriesBuffer::Clear() {
+    for (int c = 0; c < Chunks.Size; ++c)
+        IM_FREE(Chunks[c]);
+    Chunks.clear();
+    Size = 0;
+    ResetSeriesBounds(Bounds);
+    ++Version;
+}
+
+ImPlotPoint ImPlotSeriesBuffer::GetPoint(int idx) const {
+    IM_ASSERT(idx >= 0 && idx < Size);
+    const ImPlotSeriesChunk* chunk = Chunks[idx / IMPLOT_SERIES_CHUNK_SIZE];
+    const int i = idx % IMPLOT_SERIES_CHUNK_SIZE;
+    return ImPlotPoint(chunk->Xs[i], chunk->Ys[i]);
+}
+
 //-----------------------------------------------------------------------------
 // Style
 //-----------------------------------------------------------------------------
@@ -441,11 +537,53 @@ ImPlotContext* CreateContext() {
     return ctx;
 }
 
+// Hands the heatmap textures and pyramid tiles of #ctx back to the backend. Unless #now, textures that may already be referenced by
+// draw commands of the current frame are only destroyed by a later frame (see GcHeatmapTextures).
+static void ReleaseHeatmapTextures(ImPlotContext& ctx, bool now) {
+    const int frame = GImGui != nullptr ? ImGui::GetFrameCount() : 0;
+    for (int n = 0; n < ctx.HeatmapTextures.GetMapSize(); ++n) {
+        ImPlotHeatmapTexture* tex = ctx.HeatmapTextures.TryGetMapData(n);
+        if (tex == nullptr || tex->TexID == 0)
+            continue;
+        tex->LastFrame = frame;
+        ctx.ReleasedTextures.push_back(*tex);
+    }
+    ctx.HeatmapTextures.Clear();
+    for (int n = 0; n < ctx.HeatmapTiles.GetMapSize(); ++n) {
+        ImPlotHeatmapTile* tile = ctx.HeatmapTiles.TryGetMapData(n);
+        if (tile == nullptr || tile->TexID == 0)
+            continue;
+        ImPlotHeatmapTexture tex;
+        tex.TexID     = tile->TexID;
+        tex.LastFrame = frame;
+        ctx.ReleasedTextures.push_back(tex);
+    }
+    ctx.HeatmapTiles.Clear();
+    if (!now)
+        return;
+    if (ctx.DestroyTexture != nullptr) {
+        for (int i = 0; i < ctx.ReleasedTextures.Size; ++i)
+            ctx.DestroyTexture(ctx.ReleasedTextures[i].TexID, ctx.TextureUserData);
+    }
+    ctx.ReleasedTextures.clear();
+}
+
+// Hands the marker sprite sheet of #ctx back to the backend, it is rasterized again when markers are next drawn as sprites.
+static void ReleaseMarkerTexture(ImPlotContext& ctx) {
+    if (ctx.MarkerTexture != 0 && ctx.DestroyTexture != nullptr)
+        ctx.DestroyTexture(ctx.MarkerTexture, ctx.TextureUserData);
+    ctx.MarkerTexture = 0;
+}
+
 void DestroyContext(ImPlotContext* ctx) {
     if (ctx == nullptr)
         ctx = GImPlot;
     if (GImPlot == ctx)
         SetCurrentContext(nullptr);
+    ReleaseHeatmapTextures(*ctx, true);
+    ReleaseMarkerTexture(*ctx);
+    for (int i = 0; i < ctx->ParallelDrawLists.Size; ++i)
+        IM_DELETE(ctx->ParallelDrawLists[i]);
     IM_DELETE(ctx);
 }
 
@@ -457,10 +595,47 @@ void SetCurrentContext(ImPlotContext* ctx) {
     GImPlot = ctx;
 }
 
+void SetParallelFor(ImPlotParallelFor parallel_for, void* user_data, int max_tasks) {
+    IM_ASSERT_USER_ERROR(GImPlot != nullptr, "No current context. Did you call ImPlot::CreateContext() or ImPlot::SetCurrentContext()?");
+    ImPlotContext& gp = *GImPlot;
+    gp.ParallelFor         = max_tasks > 1 ? parallel_for : nullptr;
+    gp.ParallelForUserData = user_data;
+    gp.ParallelMaxTasks    = max_tasks;
+}
+
+void SetTextureBackend(ImPlotCreateTexture create, ImPlotUpdateTexture update, ImPlotDestroyTexture destroy, void* user_data) {
+    IM_ASSERT_USER_ERROR(GImPlot != nullptr, "No current context. Did you call ImPlot::CreateContext() or ImPlot::SetCurrentContext()?");
+    IM_ASSERT_USER_ERROR(create == nullptr || (update != nullptr && destroy != nullptr), "SetTextureBackend() needs all three callbacks!");
+    ImPlotContext& gp = *GImPlot;
+    ReleaseHeatmapTextures(gp, true);
+    ReleaseMarkerTexture(gp);
+    // cached geometry may draw textures that were just destroyed, or quads that should now be textures
+    gp.ItemGeometries.Clear();
+    gp.CreateTexture   = create;
+    gp.UpdateTexture   = update;
+    gp.DestroyTexture  = destroy;
+    gp.TextureUserData = user_data;
+}
+
 #define IMPLOT_APPEND_CMAP(name, qual) ctx->ColormapData.Append(#name, name, sizeof(name)/sizeof(ImU32), qual)
 #define IM_RGB(r,g,b) IM_COL32(r,g,b,255)
 
 void Initialize(ImPlotContext* ctx) {
+    ctx->ItemDrawFrame = -1;
+    ctx->ItemGeometryRecordID = 0;
+    ctx->ItemCacheGcFrame = -1;
+    ctx->ParallelFor = nullptr;
+    ctx->ParallelForUserData = nullptr;
+    ctx->ParallelMaxTasks = 0;
+    ctx->CreateTexture = nullptr;
+    ctx->UpdateTexture = nullptr;
+    ctx->DestroyTexture = nullptr;
+    ctx->TextureUserData = nullptr;
+    ctx->HeatmapPixelsPeak = 0;
+    ctx->HeatmapPixelsTrimFrame = 0;
+    ctx->HeatmapGeneration = 0;
+    ctx->MarkerTexture = 0;
+    ctx->TransformSimd = GetSimdSupport();
     ResetCtxForNextPlot(ctx);
     ResetCtxForNextAlignedPlots(ctx);
     ResetCtxForNextSubplot(ctx);
@@ -547,6 +722,11 @@ void BustPlotCache() {
     ImPlotContext& gp = *GImPlot;
     gp.Plots.Clear();
     gp.Subplots.Clear();
+    gp.LineLODs.Clear();
+    gp.ItemGeometries.Clear();
+    gp.HeatmapPyramids.Clear();
+    gp.Histograms.Clear();
+    ReleaseHeatmapTextures(gp, false);
 }
 
 //-----------------------------------------------------------------------------
@@ -2383,6 +2563,9 @@ bool BeginPlot(const char* title_id, const ImVec2& size, ImPlotFlags flags) {
     ImGuiContext &G          = *GImGui;
     ImGuiWindow* Window      = G.CurrentWindow;
 
+    // free the caches of items that stopped being plotted, the first plot of a frame does the work
+    GcItemCaches();
+
     // skip if needed
     if (Window->SkipItems && !gp.CurrentSubplot) {
         ResetCtxForNextPlot(GImPlot);
@@ -3800,6 +3983,12 @@ void HideNextItem(bool hidden, ImPlotCond cond) {
     gp.NextItemData.HiddenCond = cond;
 }
 
+void SetNextItemDataVersion(ImU64 version) {
+    ImPlotContext& gp = *GImPlot;
+    gp.NextItemData.HasDataVersion = true;
+    gp.NextItemData.DataVersion    = version;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Plot Tools
 //-----------------------------------------------------------------------------
@@ -309,6 +309,32 @@ void Demo_LinePlots() {
 
 //-----------------------------------------------------------------------------
 
+void Demo_LineLOD() {
+    static const int count = 2000000;
+    static ImVector<float> xs, ys;
+    if (xs.empty()) {
+        xs.resize(count);
+        ys.resize(count);
+        srand(0);
+        for (int i = 0; i < count; ++i) {
+            xs[i] = i * 0.001f;
+            ys[i] = sinf(xs[i] * 0.01f) + RandomRange(-0.2f, 0.2f) + (i % 250000 == 0 ? 1.5f : 0.0f);
+        }
+    }
+    static bool lod = true;
+    ImGui::BulletText("ImPlotLineFlags_LOD reduces each pixel column to its first/min/max/last points.");
+    ImGui::BulletText("The result looks the same, but the vertex count follows the plot width instead of the point count.");
+    ImGui::Checkbox("LOD", &lod);
+    if (ImPlot::BeginPlot("##LOD")) {
+        ImPlot::SetupAxes("x","y");
+        ImPlot::SetupAxesLimits(0, count * 0.001f, -2, 3);
+        ImPlot::PlotLine("2M points", xs.Data, ys.Data, count, lod ? ImPlotLineFlags_LOD : ImPlotLineFlags_None);
+        ImPlot::EndPlot();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 void Demo_FilledLinePlots() {
     static double xs1[101], ys1[101], ys2[101], ys3[101];
     srand(0);
@@ -926,6 +952,35 @@ void Demo_RealtimePlots() {
 
 //-----------------------------------------------------------------------------
 
+void Demo_SeriesBuffers() {
+    ImGui::BulletText("ImPlotSeriesBuffer stores appended points in chunks with cached bounds.");
+    ImGui::BulletText("Auto-fit and culling touch each chunk once instead of every point.");
+    static ImPlotSeriesBuffer buffer;
+    static ImPlotSeriesBuffer ring(100000);
+    static int rate = 1000;
+    static double t = 0;
+    ImGui::SliderInt("Points/Frame", &rate, 1, 20000);
+    for (int i = 0; i < rate; ++i, t += 0.001) {
+        const double y = sin(t) + RandomRange(-0.1, 0.1);
+        buffer.AddPoint(t, y);
+        ring.AddPoint(t, y + 2);
+    }
+    if (ImGui::Button("Clear")) {
+        buffer.Clear();
+        ring.Clear();
+    }
+    ImGui::SameLine();
+    ImGui::Text("%d points, %d chunks", buffer.Size, buffer.Chunks.Size);
+    if (ImPlot::BeginPlot("##SeriesBuffers")) {
+        ImPlot::SetupAxes(nullptr, nullptr, ImPlotAxisFlags_AutoFit, ImPlotAxisFlags_AutoFit);
+        ImPlot::PlotLine("Unbounded", buffer, ImPlotLineFlags_LOD);
+        ImPlot::PlotLine("Ring (100k)", ring, ImPlotLineFlags_LOD);
+        ImPlot::EndPlot();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 void Demo_MarkersAndText() {
     static float mk_size = ImPlot::GetStyle().MarkerSize;
     static float mk_weight = ImPlot::GetStyle().MarkerWeight;
@@ -2235,10 +2290,12 @@ void ShowDemoWindow(bool* p_open) {
     if (ImGui::BeginTabBar("ImPlotDemoTabs")) {
         if (ImGui::BeginTabItem("Plots")) {
             DemoHeader("Line Plots", Demo_LinePlots);
+            DemoHeader("Line LOD", Demo_LineLOD);
             DemoHeader("Filled Line Plots", Demo_FilledLinePlots);
             DemoHeader("Shaded Plots##", Demo_ShadedPlots);
             DemoHeader("Scatter Plots", Demo_ScatterPlots);
             DemoHeader("Realtime Plots", Demo_RealtimePlots);
+            DemoHeader("Series Buffers", Demo_SeriesBuffers);
             DemoHeader("Stairstep Plots", Demo_StairstepPlots);
             DemoHeader("Bar Plots", Demo_BarPlots);
             DemoHeader("Bar Groups", Demo_BarGroups);
@@ -63,6 +63,21 @@ static IMPLOT_INLINE float  ImInvSqrt(float x) { return _mm_cvtss_f32(_mm_rsqrt_
 static IMPLOT_INLINE float  ImInvSqrt(float x) { return 1.0f / sqrtf(x); }
 #endif
 
+// Kernels of the batched point transform, the widest one the CPU supports is picked at runtime (see GetSimdSupport)
+#if !defined(IMPLOT_DISABLE_SIMD) && (defined __SSE2__ || defined __x86_64__ || defined _M_X64 || (defined _M_IX86_FP && _M_IX86_FP >= 2))
+#define IMPLOT_ENABLE_SSE2
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>     // __cpuid, _xgetbv
+#define IMPLOT_TARGET_AVX2
+#else
+#define IMPLOT_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#elif !defined(IMPLOT_DISABLE_SIMD) && (defined __aarch64__ || defined _M_ARM64)
+#define IMPLOT_ENABLE_NEON
+#include <arm_neon.h>
+#endif
+
 #define IMPLOT_NORMALIZE2F_OVER_ZERO(VX,VY) do { float d2 = VX*VX + VY*VY; if (d2 > 0.0f) { float inv_len = ImInvSqrt(d2); VX *= inv_len; VY *= inv_len; } } while (0)
 
 // Support for pre-1.82 versions. Users on 1.82+ can use 0 (default) flags to mean "all corners" but in order to support older versions we are more explicit.
@@ -394,6 +409,225 @@ void BustColorCache(const char* plot_title_id) {
 static const float ITEM_HIGHLIGHT_LINE_SCALE = 2.0f;
 static const float ITEM_HIGHLIGHT_MARK_SCALE = 1.25f;
 
+// Moves the records of the previous frame to ItemDrawStats and starts recording the current frame.
+// Records older than the previous frame are dropped, so a frame without plots publishes no stats.
+static void UpdateItemDrawStats(ImPlotContext& gp) {
+    const int frame = ImGui::GetFrameCount();
+    if (gp.ItemDrawFrame == frame)
+        return;
+    gp.ItemDrawStats.shrink(0);
+    gp.ItemDrawStatsNames.swap(gp.ItemDrawNames);
+    if (gp.ItemDrawFrame == frame - 1) {
+        gp.ItemDrawStats.resize(gp.ItemDrawRecords.Size);
+        for (int i = 0; i < gp.ItemDrawRecords.Size; ++i) {
+            const ImPlotItemDrawRecord& record = gp.ItemDrawRecords[i];
+            ImPlotItemDrawStats& stats = gp.ItemDrawStats[i];
+            stats.ID        = record.ID;
+            stats.PlotTitle = gp.ItemDrawStatsNames.Data + record.PlotTitleOffset;
+            stats.Label     = gp.ItemDrawStatsNames.Data + record.LabelOffset;
+            stats.VtxCount  = record.VtxCount;
+            stats.IdxCount  = record.IdxCount;
+            stats.CmdCount  = record.CmdCount;
+        }
+    }
+    gp.ItemDrawRecords.shrink(0);
+    gp.ItemDrawNames.shrink(0);
+    gp.ItemDrawFrame = frame;
+}
+
+static int AppendItemDrawName(ImVector<char>& names, const char* text, const char* text_end) {
+    const int offset = names.Size;
+    const int len = (int)(text_end - text);
+    names.resize(offset + len + 1);
+    memcpy(names.Data + offset, text, (size_t)len);
+    names[offset + len] = 0;
+    return offset;
+}
+
+// Records the draw list sizes at the start of the current item
+static void BeginItemDrawRecord(ImPlotContext& gp, const char* label_id, ImGuiID id) {
+    UpdateItemDrawStats(gp);
+    const ImPlotPlot& plot = *gp.CurrentPlot;
+    const char* title = plot.TitleOffset != -1 ? plot.GetTitle() : "";
+    const ImDrawList& draw_list = *GetPlotDrawList();
+    ImPlotItemDrawRecord record;
+    record.ID              = id;
+    record.PlotTitleOffset = AppendItemDrawName(gp.ItemDrawNames, title, ImGui::FindRenderedTextEnd(title));
+    record.LabelOffset     = AppendItemDrawName(gp.ItemDrawNames, label_id, ImGui::FindRenderedTextEnd(label_id));
+    record.VtxCount        = draw_list.VtxBuffer.Size;
+    record.IdxCount        = draw_list.IdxBuffer.Size;
+    record.CmdCount        = draw_list.CmdBuffer.Size;
+    gp.ItemDrawRecords.push_back(record);
+}
+
+// Turns the sizes recorded by BeginItemDrawRecord into the amount of geometry the item added
+static void EndItemDrawRecord(ImPlotContext& gp) {
+    if (gp.ItemDrawFrame != ImGui::GetFrameCount() || gp.ItemDrawRecords.empty())
+        return;
+    const ImDrawList& draw_list = *GetPlotDrawList();
+    ImPlotItemDrawRecord& record = gp.ItemDrawRecords.back();
+    record.VtxCount = draw_list.VtxBuffer.Size - record.VtxCount;
+    record.IdxCount = draw_list.IdxBuffer.Size - record.IdxCount;
+    record.CmdCount = draw_list.CmdBuffer.Size - record.CmdCount;
+}
+
+const ImPlotItemDrawStats* GetItemDrawStats(int* count) {
+    IM_ASSERT_USER_ERROR(GImPlot != nullptr, "No current context. Did you call ImPlot::CreateContext() or ImPlot::SetCurrentContext()?");
+    ImPlotContext& gp = *GImPlot;
+    UpdateItemDrawStats(gp);
+    if (count != nullptr)
+        *count = gp.ItemDrawStats.Size;
+    return gp.ItemDrawStats.Data;
+}
+
+// Frees the cached geometry of items that are no longer plotted.
+static void GcItemGeometries(int frame) {
+    ImPlotContext& gp = *GImPlot;
+    for (int n = 0; n < gp.ItemGeometries.GetMapSize(); ++n) {
+        ImPlotItemGeometry* geom = gp.ItemGeometries.TryGetMapData(n);
+        if (geom != nullptr && frame - geom->LastFrame > IMPLOT_ITEM_GEOMETRY_GC_FRAMES)
+            gp.ItemGeometries.Remove(geom->ID, geom);
+    }
+}
+
+// Resizes the heatmap scratch image to #count pixels and remembers the largest size for GcItemCaches.
+static ImU32* GetHeatmapPixels(ImPlotContext& gp, int count) {
+    gp.HeatmapPixels.resize(count);
+    gp.HeatmapPixelsPeak = ImMax(gp.HeatmapPixelsPeak, count);
+    return gp.HeatmapPixels.Data;
+}
+
+// Fills key with the state of the current item, after BeginItem resolved its style.
+static void BuildItemGeometryKey(ImPlotContext& gp, ImPlotItemFlags flags, ImPlotItemGeometryKey& key) {
+    const ImPlotPlot& plot = *gp.CurrentPlot;
+    const ImPlotNextItemData& s = gp.NextItemData;
+    const ImDrawList& draw_list = *GetPlotDrawList();
+    key.DataVersion = s.DataVersion;
+    key.Flags       = flags;
+    for (int i = 0; i < 2; ++i) {
+        const ImPlotAxis& axis = plot.Axes[i == 0 ? plot.CurrentX : plot.CurrentY];
+        key.Range[i]         = axis.Range;
+        key.PixelMin[i]      = axis.PixelMin;
+        key.PixelMax[i]      = axis.PixelMax;
+        key.Transform[i]     = axis.TransformForward;
+        key.TransformData[i] = axis.TransformData;
+    }
+    key.ClipRect = draw_list._CmdHeader.ClipRect;
+    for (int i = 0; i < 5; ++i)
+        key.Colors[i] = s.Colors[i];
+    key.LineWeight     = s.LineWeight;
+    key.MarkerSize     = s.MarkerSize;
+    key.MarkerWeight   = s.MarkerWeight;
+    key.ErrorBarSize   = s.ErrorBarSize;
+    key.ErrorBarWeight = s.ErrorBarWeight;
+    key.Marker         = s.Marker;
+    key.Colormap       = gp.Style.Colormap;
+    key.Font           = ImGui::GetFont();
+    key.FontSize       = ImGui::GetFontSize();
+    key.Alpha          = ImGui::GetStyle().Alpha;
+    key.DrawListFlags  = draw_list.Flags;
+}
+
+// Appends cached geometry to the draw list, restoring the clip rects and textures it was drawn with.
+static void ReplayItemGeometry(const ImPlotItemGeometry& geom, ImDrawList& draw_list) {
+    const ImDrawIdx* idx_src = geom.IdxBuffer.Data;
+    unsigned int vtx_base = 0;
+    for (int i = 0; i < geom.Cmds.Size; ++i) {
+        const ImPlotItemGeometryCmd& cmd = geom.Cmds[i];
+        draw_list.PushClipRect(ImVec2(cmd.ClipRect.x, cmd.ClipRect.y), ImVec2(cmd.ClipRect.z, cmd.ClipRect.w));
+        draw_list.PushTextureID(cmd.TextureId);
+        // all vertices go with the first command, later commands only add indices
+        const int vtx_count = i == 0 ? geom.VtxBuffer.Size : 0;
+        draw_list.PrimReserve(cmd.IdxCount, vtx_count);
+        if (i == 0) {
+            vtx_base = draw_list._VtxCurrentIdx;
+            memcpy(draw_list._VtxWritePtr, geom.VtxBuffer.Data, (size_t)vtx_count * sizeof(ImDrawVert));
+            draw_list._VtxWritePtr   += vtx_count;
+            draw_list._VtxCurrentIdx += vtx_count;
+        }
+        for (int j = 0; j < cmd.IdxCount; ++j)
+            draw_list._IdxWritePtr[j] = (ImDrawIdx)(vtx_base + idx_src[j]);
+        draw_list._IdxWritePtr += cmd.IdxCount;
+        idx_src += cmd.IdxCount;
+        draw_list.PopTextureID();
+        draw_list.PopClipRect();
+    }
+}
+
+bool BeginItemGeometry(ImPlotItemFlags flags) {
+    ImPlotContext& gp = *GImPlot;
+    gp.ItemGeometryRecordID = 0;
+    if (!gp.NextItemData.HasDataVersion)
+        return false;
+    const int frame = ImGui::GetFrameCount();
+    const ImGuiID id = ImHashData(&gp.CurrentPlot->ID, sizeof(ImGuiID), gp.CurrentItem->ID);
+    ImPlotItemGeometry& geom = *gp.ItemGeometries.GetOrAddByKey(id);
+    geom.ID        = id;
+    geom.LastFrame = frame;
+    ImPlotItemGeometryKey key;
+    BuildItemGeometryKey(gp, flags, key);
+    ImDrawList& draw_list = *GetPlotDrawList();
+    if (geom.Valid && memcmp(&key, &geom.Key, sizeof(key)) == 0) {
+        ReplayItemGeometry(geom, draw_list);
+        return true;
+    }
+    memcpy((void*)&geom.Key, &key, sizeof(key));
+    geom.Valid    = false;
+    geom.VtxStart = draw_list.VtxBuffer.Size;
+    geom.IdxStart = draw_list.IdxBuffer.Size;
+    gp.ItemGeometryRecordID = id;
+    return false;
+}
+
+// Copies what the current item added to the draw list into its cache entry.
+static void EndItemGeometry(ImPlotContext& gp) {
+    if (gp.ItemGeometryRecordID == 0)
+        return;
+    ImPlotItemGeometry* geom = gp.ItemGeometries.GetByKey(gp.ItemGeometryRecordID);
+    gp.ItemGeometryRecordID = 0;
+    if (geom == nullptr)
+        return;
+    const ImDrawList& draw_list = *GetPlotDrawList();
+    const int vtx_count = draw_list.VtxBuffer.Size - geom->VtxStart;
+    const int idx_count = draw_list.IdxBuffer.Size - geom->IdxStart;
+    geom->Cmds.shrink(0);
+    if (vtx_count > IMPLOT_ITEM_GEOMETRY_MAX_VTX) {
+        geom->VtxBuffer.clear();
+        geom->IdxBuffer.clear();
+        return;
+    }
+    // walk back over the commands holding the item's indices; callbacks and large mesh offsets are not replayable
+    const unsigned int vtx_offset = draw_list._CmdHeader.VtxOffset;
+    if ((unsigned int)geom->VtxStart < vtx_offset)
+        return;
+    int cmd_idx_count = 0;
+    for (int c = draw_list.CmdBuffer.Size - 1; c >= 0 && cmd_idx_count < idx_count; --c) {
+        const ImDrawCmd& cmd = draw_list.CmdBuffer[c];
+        if (cmd.ElemCount == 0)
+            continue;
+        if (cmd.UserCallback != nullptr || cmd.VtxOffset != vtx_offset)
+            return;
+        const int cmd_end = (int)(cmd.IdxOffset + cmd.ElemCount);
+        ImPlotItemGeometryCmd out;
+        out.ClipRect  = cmd.ClipRect;
+        out.TextureId = cmd.TextureId;
+        out.IdxCount  = cmd_end - ImMax((int)cmd.IdxOffset, geom->IdxStart);
+        geom->Cmds.push_back(out);
+        cmd_idx_count += out.IdxCount;
+    }
+    if (cmd_idx_count != idx_count)
+        return;
+    for (int i = 0, j = geom->Cmds.Size - 1; i < j; ++i, --j)
+        ImSwap(geom->Cmds[i], geom->Cmds[j]);
+    geom->VtxBuffer.resize(vtx_count);
+    memcpy(geom->VtxBuffer.Data, draw_list.VtxBuffer.Data + geom->VtxStart, (size_t)vtx_count * sizeof(ImDrawVert));
+    geom->IdxBuffer.resize(idx_count);
+    const unsigned int vtx_first = (unsigned int)geom->VtxStart - vtx_offset;
+    for (int i = 0; i < idx_count; ++i)
+        geom->IdxBuffer[i] = (ImDrawIdx)(draw_list.IdxBuffer[geom->IdxStart + i] - vtx_first);
+    geom->Valid = true;
+}
+
 // Begins a new item. Returns false if the item should not be plotted.
 bool BeginItem(const char* label_id, ImPlotItemFlags flags, ImPlotCol recolor_from) {
     ImPlotContext& gp = *GImPlot;
@@ -471,6 +705,7 @@ bool BeginItem(const char* label_id, ImPlotItemFlags flags, ImPlotCol recolor_fr
         s.RenderMarkerLine = s.Colors[ImPlotCol_MarkerOutline].w > 0 && s.MarkerWeight > 0;
         // push rendering clip rect
         PushPlotClipRect();
+        BeginItemDrawRecord(gp, label_id, item->ID);
         return true;
     }
 }
@@ -478,6 +713,8 @@ bool BeginItem(const char* label_id, ImPlotItemFlags flags, ImPlotCol recolor_fr
 // Ends an item (call only if BeginItem returns true)
 void EndItem() {
     ImPlotContext& gp = *GImPlot;
+    EndItemGeometry(gp);
+    EndItemDrawRecord(gp);
     // pop rendering clip rect
     PopPlotClipRect();
     // reset next item data
@@ -776,7 +1013,7 @@ struct FitterRect {
 //-----------------------------------------------------------------------------
 
 struct Transformer1 {
-    Transformer1(double pixMin, double pltMin, double pltMax, double m, double scaMin, double scaMax, ImPlotTransform fwd, void* data) :
+    Transformer1(double pixMin, double pltMin, double pltMax, double m, double scaMin, double scaMax, ImPlotTransform fwd, void* data, ImPlotScale scale = ImPlotScale_Linear) :
         ScaMin(scaMin),
         ScaMax(scaMax),
         PltMin(pltMin),
@@ -784,7 +1021,8 @@ struct Transformer1 {
         PixMin(pixMin),
         M(m),
         TransformFwd(fwd),
-        TransformData(data)
+        TransformData(data),
+        Scale(scale)
     { }
 
     template <typename T> IMPLOT_INLINE float operator()(T p) const {
@@ -799,6 +1037,7 @@ struct Transformer1 {
     double ScaMin, ScaMax, PltMin, PltMax, PixMin, M;
     ImPlotTransform TransformFwd;
     void*           TransformData;
+    ImPlotScale     Scale;          // lets the batched transform recognize the built-in log scales
 };
 
 struct Transformer2 {
@@ -810,7 +1049,8 @@ struct Transformer2 {
            x_axis.ScaleMin,
            x_axis.ScaleMax,
            x_axis.TransformForward,
-           x_axis.TransformData),
+           x_axis.TransformData,
+           x_axis.Scale),
         Ty(y_axis.PixelMin,
            y_axis.Range.Min,
            y_axis.Range.Max,
@@ -818,7 +1058,8 @@ struct Transformer2 {
            y_axis.ScaleMin,
            y_axis.ScaleMax,
            y_axis.TransformForward,
-           y_axis.TransformData)
+           y_axis.TransformData,
+           y_axis.Scale)
     { }
 
     Transformer2(const ImPlotPlot& plot) :
@@ -847,6 +1088,405 @@ struct Transformer2 {
     Transformer1 Ty;
 };
 
+//-----------------------------------------------------------------------------
+// [SECTION] Batched Transform
+//-----------------------------------------------------------------------------
+
+// Linear part of a Transformer1. Every kernel evaluates the same expressions in the same order as
+// Transformer1::operator(), so on linear and time axes batched and per point results are bit for bit identical.
+struct TransformCoefs {
+    TransformCoefs(const Transformer1& t) :
+        ScaMin(t.ScaMin),
+        ScaRange(t.ScaMax - t.ScaMin),
+        PltMin(t.PltMin),
+        PltRange(t.PltMax - t.PltMin),
+        PixMin(t.PixMin),
+        M(t.M),
+        Scaled(t.TransformFwd != nullptr)
+    { }
+    double ScaMin, ScaRange, PltMin, PltRange, PixMin, M;
+    bool   Scaled;
+};
+
+static IMPLOT_INLINE float TransformValue(double v, const TransformCoefs& c) {
+    if (c.Scaled)
+        v = c.PltMin + c.PltRange * ((v - c.ScaMin) / c.ScaRange);
+    return (float)(c.PixMin + c.M * (v - c.PltMin));
+}
+
+static void TransformBlock_Scalar(const double* xs, const double* ys, int count, const TransformCoefs& cx, const TransformCoefs& cy, ImVec2* out) {
+    for (int i = 0; i < count; ++i) {
+        out[i].x = TransformValue(xs[i], cx);
+        out[i].y = TransformValue(ys[i], cy);
+    }
+}
+
+#ifdef IMPLOT_ENABLE_SSE2
+
+// There is no SSE2 kernel for the linear part: the compiler already vectorizes TransformBlock_Scalar with SSE2,
+// and hand written two lane code was slower because of the extra shuffles.
+
+static IMPLOT_TARGET_AVX2 IMPLOT_INLINE __m256d TransformValues_AVX2(__m256d v, const TransformCoefs& c) {
+    if (c.Scaled)
+        v = _mm256_add_pd(_mm256_set1_pd(c.PltMin), _mm256_mul_pd(_mm256_set1_pd(c.PltRange), _mm256_div_pd(_mm256_sub_pd(v, _mm256_set1_pd(c.ScaMin)), _mm256_set1_pd(c.ScaRange))));
+    return _mm256_add_pd(_mm256_set1_pd(c.PixMin), _mm256_mul_pd(_mm256_set1_pd(c.M), _mm256_sub_pd(v, _mm256_set1_pd(c.PltMin))));
+}
+
+static IMPLOT_TARGET_AVX2 void TransformBlock_AVX2(const double* xs, const double* ys, int count, const TransformCoefs& cx, const TransformCoefs& cy, ImVec2* out) {
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m128 fx = _mm256_cvtpd_ps(TransformValues_AVX2(_mm256_loadu_pd(xs + i), cx));
+        const __m128 fy = _mm256_cvtpd_ps(TransformValues_AVX2(_mm256_loadu_pd(ys + i), cy));
+        _mm_storeu_ps(&out[i].x,   _mm_unpacklo_ps(fx, fy));
+        _mm_storeu_ps(&out[i+2].x, _mm_unpackhi_ps(fx, fy));
+    }
+    TransformBlock_Scalar(xs + i, ys + i, count - i, cx, cy, out + i);
+}
+
+// Forward transforms of the built-in Log10 and SymLog scales. Logarithms use the argument reduction and polynomial of
+// fdlibm's __ieee754_log and agree with the C library to about an ulp, so batched pixels match the per point ones up to
+// float rounding. Lanes the polynomial does not cover (zero or negative on a log axis, subnormals, infinities, NaN,
+// huge SymLog values) go through the scalar transform together with the rest of their vector.
+
+static const double LogLg[7]  = { 6.666666666666735130e-01, 3.999999999940941908e-01, 2.857142874366239149e-01, 2.222219843214978396e-01,
+                                  1.818357216161805012e-01, 1.531383769920937332e-01, 1.479819860511658591e-01 };
+static const double Ln2Hi     = 6.93147180369123816490e-01, Ln2Lo     = 1.90821492927058770002e-10;
+static const double Log10_2Hi = 3.01029995663611771306e-01, Log10_2Lo = 3.69423907715893078616e-13;
+static const double InvLn10   = 4.34294481903251816668e-01;
+static const double SymLogMax = 1e150;  // larger values would overflow v^2 / 4 in SymLogValues
+
+// Splits positive normal doubles into 2^e * m with m in [sqrt(2)/2, sqrt(2)) and returns log(m).
+static IMPLOT_INLINE __m128d LogReduce_SSE2(__m128d v, __m128d* e) {
+    const __m128i bits = _mm_castpd_si128(v);
+    // the biased exponent becomes a double by placing it in the mantissa of 2^52
+    const __m128d biased = _mm_sub_pd(_mm_castsi128_pd(_mm_or_si128(_mm_srli_epi64(bits, 52), _mm_set1_epi64x(0x4330000000000000))), _mm_set1_pd(4503599627370496.0));
+    __m128d m = _mm_castsi128_pd(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi64x(0x000FFFFFFFFFFFFF)), _mm_set1_epi64x(0x3FF0000000000000)));
+    const __m128d high = _mm_cmpgt_pd(m, _mm_set1_pd(1.4142135623730951));
+    m  = _mm_or_pd(_mm_and_pd(high, _mm_mul_pd(m, _mm_set1_pd(0.5))), _mm_andnot_pd(high, m));
+    *e = _mm_add_pd(_mm_sub_pd(biased, _mm_set1_pd(1023.0)), _mm_and_pd(high, _mm_set1_pd(1.0)));
+    const __m128d f    = _mm_sub_pd(m, _mm_set1_pd(1.0));
+    const __m128d s    = _mm_div_pd(f, _mm_add_pd(_mm_set1_pd(2.0), f));
+    const __m128d z    = _mm_mul_pd(s, s);
+    const __m128d w    = _mm_mul_pd(z, z);
+    const __m128d t1   = _mm_mul_pd(w, _mm_add_pd(_mm_set1_pd(LogLg[1]), _mm_mul_pd(w, _mm_add_pd(_mm_set1_pd(LogLg[3]), _mm_mul_pd(w, _mm_set1_pd(LogLg[5]))))));
+    const __m128d t2   = _mm_mul_pd(z, _mm_add_pd(_mm_set1_pd(LogLg[0]), _mm_mul_pd(w, _mm_add_pd(_mm_set1_pd(LogLg[2]), _mm_mul_pd(w, _mm_add_pd(_mm_set1_pd(LogLg[4]), _mm_mul_pd(w, _mm_set1_pd(LogLg[6]))))))));
+    const __m128d hfsq = _mm_mul_pd(_mm_set1_pd(0.5), _mm_mul_pd(f, f));
+    return _mm_sub_pd(f, _mm_sub_pd(hfsq, _mm_mul_pd(s, _mm_add_pd(hfsq, _mm_add_pd(t1, t2)))));
+}
+
+static IMPLOT_INLINE __m128d Log10Values_SSE2(__m128d v) {
+    __m128d e;
+    const __m128d r = LogReduce_SSE2(v, &e);
+    return _mm_add_pd(_mm_mul_pd(e, _mm_set1_pd(Log10_2Hi)), _mm_add_pd(_mm_mul_pd(e, _mm_set1_pd(Log10_2Lo)), _mm_mul_pd(r, _mm_set1_pd(InvLn10))));
+}
+
+// 2 * asinh(v / 2), with asinh(a) = log1p(a + a^2 / (1 + sqrt(1 + a^2))) so that small values keep their precision
+static IMPLOT_INLINE __m128d SymLogValues_SSE2(__m128d v) {
+    const __m128d sign_mask = _mm_set1_pd(-0.0);
+    const __m128d one = _mm_set1_pd(1.0);
+    const __m128d a  = _mm_andnot_pd(sign_mask, _mm_mul_pd(v, _mm_set1_pd(0.5)));
+    const __m128d a2 = _mm_mul_pd(a, a);
+    const __m128d u  = _mm_add_pd(a, _mm_div_pd(a2, _mm_add_pd(one, _mm_sqrt_pd(_mm_add_pd(one, a2)))));
+    const __m128d w  = _mm_add_pd(one, u);
+    const __m128d c  = _mm_div_pd(_mm_sub_pd(u, _mm_sub_pd(w, one)), w);  // rounding error of 1 + u
+    __m128d e;
+    const __m128d r = LogReduce_SSE2(w, &e);
+    const __m128d asinh = _mm_add_pd(_mm_mul_pd(e, _mm_set1_pd(Ln2Hi)), _mm_add_pd(r, _mm_add_pd(_mm_mul_pd(e, _mm_set1_pd(Ln2Lo)), c)));
+    return _mm_or_pd(_mm_mul_pd(_mm_set1_pd(2.0), asinh), _mm_and_pd(v, sign_mask));
+}
+
+static void Log10Block_SSE2(double* vs, int count) {
+    int i = 0;
+    for (; i + 2 <= count; i += 2) {
+        const __m128d v = _mm_loadu_pd(vs + i);
+        if (_mm_movemask_pd(_mm_and_pd(_mm_cmpge_pd(v, _mm_set1_pd(DBL_MIN)), _mm_cmple_pd(v, _mm_set1_pd(DBL_MAX)))) == 3) {
+            _mm_storeu_pd(vs + i, Log10Values_SSE2(v));
+        } else {
+            vs[i]     = TransformForward_Log10(vs[i], nullptr);
+            vs[i + 1] = TransformForward_Log10(vs[i + 1], nullptr);
+        }
+    }
+    for (; i < count; ++i)
+        vs[i] = TransformForward_Log10(vs[i], nullptr);
+}
+
+static void SymLogBlock_SSE2(double* vs, int count) {
+    int i = 0;
+    for (; i + 2 <= count; i += 2) {
+        const __m128d v = _mm_loadu_pd(vs + i);
+        if (_mm_movemask_pd(_mm_cmple_pd(_mm_andnot_pd(_mm_set1_pd(-0.0), v), _mm_set1_pd(SymLogMax))) == 3) {
+            _mm_storeu_pd(vs + i, SymLogValues_SSE2(v));
+        } else {
+            vs[i]     = TransformForward_SymLog(vs[i], nullptr);
+            vs[i + 1] = TransformForward_SymLog(vs[i + 1], nullptr);
+        }
+    }
+    for (; i < count; ++i)
+        vs[i] = TransformForward_SymLog(vs[i], nullptr);
+}
+
+static IMPLOT_TARGET_AVX2 IMPLOT_INLINE __m256d LogReduce_AVX2(__m256d v, __m256d* e) {
+    const __m256i bits = _mm256_castpd_si256(v);
+    const __m256d biased = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(_mm256_srli_epi64(bits, 52), _mm256_set1_epi64x(0x4330000000000000))), _mm256_set1_pd(4503599627370496.0));
+    __m256d m = _mm256_castsi256_pd(_mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi64x(0x000FFFFFFFFFFFFF)), _mm256_set1_epi64x(0x3FF0000000000000)));
+    const __m256d high = _mm256_cmp_pd(m, _mm256_set1_pd(1.4142135623730951), _CMP_GT_OQ);
+    m  = _mm256_blendv_pd(m, _mm256_mul_pd(m, _mm256_set1_pd(0.5)), high);
+    *e = _mm256_add_pd(_mm256_sub_pd(biased, _mm256_set1_pd(1023.0)), _mm256_and_pd(high, _mm256_set1_pd(1.0)));
+    const __m256d f    = _mm256_sub_pd(m, _mm256_set1_pd(1.0));
+    const __m256d s    = _mm256_div_pd(f, _mm256_add_pd(_mm256_set1_pd(2.0), f));
+    const __m256d z    = _mm256_mul_pd(s, s);
+    const __m256d w    = _mm256_mul_pd(z, z);
+    const __m256d t1   = _mm256_mul_pd(w, _mm256_add_pd(_mm256_set1_pd(LogLg[1]), _mm256_mul_pd(w, _mm256_add_pd(_mm256_set1_pd(LogLg[3]), _mm256_mul_pd(w, _mm256_set1_pd(LogLg[5]))))));
+    const __m256d t2   = _mm256_mul_pd(z, _mm256_add_pd(_mm256_set1_pd(LogLg[0]), _mm256_mul_pd(w, _mm256_add_pd(_mm256_set1_pd(LogLg[2]), _mm256_mul_pd(w, _mm256_add_pd(_mm256_set1_pd(LogLg[4]), _mm256_mul_pd(w, _mm256_set1_pd(LogLg[6]))))))));
+    const __m256d hfsq = _mm256_mul_pd(_mm256_set1_pd(0.5), _mm256_mul_pd(f, f));
+    return _mm256_sub_pd(f, _mm256_sub_pd(hfsq, _mm256_mul_pd(s, _mm256_add_pd(hfsq, _mm256_add_pd(t1, t2)))));
+}
+
+static IMPLOT_TARGET_AVX2 IMPLOT_INLINE __m256d Log10Values_AVX2(__m256d v) {
+    __m256d e;
+    const __m256d r = LogReduce_AVX2(v, &e);
+    return _mm256_add_pd(_mm256_mul_pd(e, _mm256_set1_pd(Log10_2Hi)), _mm256_add_pd(_mm256_mul_pd(e, _mm256_set1_pd(Log10_2Lo)), _mm256_mul_pd(r, _mm256_set1_pd(InvLn10))));
+}
+
+static IMPLOT_TARGET_AVX2 IMPLOT_INLINE __m256d SymLogValues_AVX2(__m256d v) {
+    const __m256d sign_mask = _mm256_set1_pd(-0.0);
+    const __m256d one = _mm256_set1_pd(1.0);
+    const __m256d a  = _mm256_andnot_pd(sign_mask, _mm256_mul_pd(v, _mm256_set1_pd(0.5)));
+    const __m256d a2 = _mm256_mul_pd(a, a);
+    const __m256d u  = _mm256_add_pd(a, _mm256_div_pd(a2, _mm256_add_pd(one, _mm256_sqrt_pd(_mm256_add_pd(one, a2)))));
+    const __m256d w  = _mm256_add_pd(one, u);
+    const __m256d c  = _mm256_div_pd(_mm256_sub_pd(u, _mm256_sub_pd(w, one)), w);
+    __m256d e;
+    const __m256d r = LogReduce_AVX2(w, &e);
+    const __m256d asinh = _mm256_add_pd(_mm256_mul_pd(e, _mm256_set1_pd(Ln2Hi)), _mm256_add_pd(r, _mm256_add_pd(_mm256_mul_pd(e, _mm256_set1_pd(Ln2Lo)), c)));
+    return _mm256_or_pd(_mm256_mul_pd(_mm256_set1_pd(2.0), asinh), _mm256_and_pd(v, sign_mask));
+}
+
+static IMPLOT_TARGET_AVX2 void Log10Block_AVX2(double* vs, int count) {
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m256d v = _mm256_loadu_pd(vs + i);
+        const __m256d normal = _mm256_and_pd(_mm256_cmp_pd(v, _mm256_set1_pd(DBL_MIN), _CMP_GE_OQ), _mm256_cmp_pd(v, _mm256_set1_pd(DBL_MAX), _CMP_LE_OQ));
+        if (_mm256_movemask_pd(normal) == 15) {
+            _mm256_storeu_pd(vs + i, Log10Values_AVX2(v));
+        } else {
+            for (int k = 0; k < 4; ++k)
+                vs[i + k] = TransformForward_Log10(vs[i + k], nullptr);
+        }
+    }
+    Log10Block_SSE2(vs + i, count - i);
+}
+
+static IMPLOT_TARGET_AVX2 void SymLogBlock_AVX2(double* vs, int count) {
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m256d v = _mm256_loadu_pd(vs + i);
+        if (_mm256_movemask_pd(_mm256_cmp_pd(_mm256_andnot_pd(_mm256_set1_pd(-0.0), v), _mm256_set1_pd(SymLogMax), _CMP_LE_OQ)) == 15) {
+            _mm256_storeu_pd(vs + i, SymLogValues_AVX2(v));
+        } else {
+            for (int k = 0; k < 4; ++k)
+                vs[i + k] = TransformForward_SymLog(vs[i + k], nullptr);
+        }
+    }
+    SymLogBlock_SSE2(vs + i, count - i);
+}
+
+#endif // IMPLOT_ENABLE_SSE2
+
+#ifdef IMPLOT_ENABLE_NEON
+
+static IMPLOT_INLINE float64x2_t TransformValues_NEON(float64x2_t v, const TransformCoefs& c) {
+    // vmulq + vaddq rather than vfmaq, fused multiply-add would round differently from the scalar path
+    if (c.Scaled)
+        v = vaddq_f64(vdupq_n_f64(c.PltMin), vmulq_f64(vdupq_n_f64(c.PltRange), vdivq_f64(vsubq_f64(v, vdupq_n_f64(c.ScaMin)), vdupq_n_f64(c.ScaRange))));
+    return vaddq_f64(vdupq_n_f64(c.PixMin), vmulq_f64(vdupq_n_f64(c.M), vsubq_f64(v, vdupq_n_f64(c.PltMin))));
+}
+
+static void TransformBlock_NEON(const double* xs, const double* ys, int count, const TransformCoefs& cx, const TransformCoefs& cy, ImVec2* out) {
+    int i = 0;
+    for (; i + 2 <= count; i += 2) {
+        float32x2x2_t xy;
+        xy.val[0] = vcvt_f32_f64(TransformValues_NEON(vld1q_f64(xs + i), cx));
+        xy.val[1] = vcvt_f32_f64(TransformValues_NEON(vld1q_f64(ys + i), cy));
+        vst2_f32(&out[i].x, xy);
+    }
+    TransformBlock_Scalar(xs + i, ys + i, count - i, cx, cy, out + i);
+}
+
+#endif // IMPLOT_ENABLE_NEON
+
+typedef void (*TransformBlockFunc)(const double* xs, const double* ys, int count, const TransformCoefs& cx, const TransformCoefs& cy, ImVec2* out);
+typedef void (*TransformForwardBlockFunc)(double* vs, int count);
+
+static TransformBlockFunc GetTransformBlockFunc(ImPlotSimd simd) {
+    switch (simd) {
+#ifdef IMPLOT_ENABLE_SSE2
+        case ImPlotSimd_AVX2: return TransformBlock_AVX2;
+#endif
+#ifdef IMPLOT_ENABLE_NEON
+        case ImPlotSimd_NEON: return TransformBlock_NEON;
+#endif
+        default:              return TransformBlock_Scalar;
+    }
+}
+
+// Returns the vector kernel for the forward transform of a built-in scale, or nullptr to run it per value.
+static TransformForwardBlockFunc GetTransformForwardBlockFunc(ImPlotSimd simd, ImPlotScale scale) {
+#ifdef IMPLOT_ENABLE_SSE2
+    if (simd == ImPlotSimd_AVX2 || simd == ImPlotSimd_SSE2) {
+        const bool avx2 = simd == ImPlotSimd_AVX2;
+        if (scale == ImPlotScale_Log10)
+            return avx2 ? Log10Block_AVX2 : Log10Block_SSE2;
+        if (scale == ImPlotScale_SymLog)
+            return avx2 ? SymLogBlock_AVX2 : SymLogBlock_SSE2;
+    }
+#else
+    IM_UNUSED(simd); IM_UNUSED(scale);
+#endif
+    return nullptr;
+}
+
+ImPlotSimd GetSimdSupport() {
+#if defined(IMPLOT_ENABLE_SSE2) && defined(_MSC_VER) && !defined(__clang__)
+    static ImPlotSimd simd = -1;
+    if (simd == -1) {
+        int info[4];
+        __cpuid(info, 0);
+        const int max_leaf = info[0];
+        __cpuid(info, 1);
+        const bool os_avx = (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0 && (_xgetbv(0) & 6) == 6;
+        bool avx2 = false;
+        if (max_leaf >= 7 && os_avx) {
+            __cpuidex(info, 7, 0);
+            avx2 = (info[1] & (1 << 5)) != 0;
+        }
+        simd = avx2 ? ImPlotSimd_AVX2 : ImPlotSimd_SSE2;
+    }
+    return simd;
+#elif defined(IMPLOT_ENABLE_SSE2)
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") ? ImPlotSimd_AVX2 : ImPlotSimd_SSE2;
+#elif defined(IMPLOT_ENABLE_NEON)
+    return ImPlotSimd_NEON;
+#else
+    return ImPlotSimd_None;
+#endif
+}
+
+ImPlotSimd SetTransformSimd(ImPlotSimd simd) {
+    ImPlotContext& gp = *GImPlot;
+    const ImPlotSimd prev = gp.TransformSimd;
+    const ImPlotSimd best = GetSimdSupport();
+    // NEON and the x86 sets exclude each other, anything unsupported falls back to scalar
+    gp.TransformSimd = (simd == best || (best == ImPlotSimd_AVX2 && simd == ImPlotSimd_SSE2)) ? simd : ImPlotSimd_None;
+    return prev;
+}
+
+const char* GetSimdName(ImPlotSimd simd) {
+    switch (simd) {
+        case ImPlotSimd_SSE2: return "SSE2";
+        case ImPlotSimd_AVX2: return "AVX2";
+        case ImPlotSimd_NEON: return "NEON";
+        default:              return "Scalar";
+    }
+}
+
+// Applies the forward transform of a non-linear scale to #vs in place. Log10 and SymLog run vectorized,
+// custom transforms are called per value.
+static void TransformForwardBlock(const Transformer1& t, double* vs, int count) {
+    if (TransformForwardBlockFunc func = GetTransformForwardBlockFunc(GImPlot->TransformSimd, t.Scale)) {
+        func(vs, count);
+        return;
+    }
+    for (int i = 0; i < count; ++i)
+        vs[i] = t.TransformFwd(vs[i], t.TransformData);
+}
+
+// Converts one block of at most IMPLOT_TRANSFORM_BLOCK points in place of #xs and #ys.
+static void TransformBlock(const Transformer2& transformer, double* xs, double* ys, int count, ImVec2* out) {
+    const Transformer1& tx = transformer.Tx;
+    const Transformer1& ty = transformer.Ty;
+    if (tx.TransformFwd != nullptr)
+        TransformForwardBlock(tx, xs, count);
+    if (ty.TransformFwd != nullptr)
+        TransformForwardBlock(ty, ys, count);
+    GetTransformBlockFunc(GImPlot->TransformSimd)(xs, ys, count, TransformCoefs(tx), TransformCoefs(ty), out);
+}
+
+void PlotToPixelsBatch(const double* xs, const double* ys, int count, ImVec2* out) {
+    IM_ASSERT_USER_ERROR(GImPlot->CurrentPlot != nullptr, "PlotToPixelsBatch() needs to be called between BeginPlot() and EndPlot()!");
+    SetupLock();
+    const Transformer2 transformer;
+    double bx[IMPLOT_TRANSFORM_BLOCK], by[IMPLOT_TRANSFORM_BLOCK];
+    for (int i = 0; i < count; i += IMPLOT_TRANSFORM_BLOCK) {
+        const int n = ImMin(IMPLOT_TRANSFORM_BLOCK, count - i);
+        memcpy(bx, xs + i, n * sizeof(double));
+        memcpy(by, ys + i, n * sizeof(double));
+        TransformBlock(transformer, bx, by, n, out + i);
+    }
+}
+
+/// Converts the getter points [first, last) to pixels, one block at a time.
+template <typename _Getter>
+void TransformGetterRange(const _Getter& getter, const Transformer2& transformer, int first, int last, ImVec2* out) {
+    double xs[IMPLOT_TRANSFORM_BLOCK], ys[IMPLOT_TRANSFORM_BLOCK];
+    for (int i = first; i < last; i += IMPLOT_TRANSFORM_BLOCK) {
+        const int n = ImMin(IMPLOT_TRANSFORM_BLOCK, last - i);
+        for (int k = 0; k < n; ++k) {
+            const ImPlotPoint p = getter(i + k);
+            xs[k] = p.x;
+            ys[k] = p.y;
+        }
+        TransformBlock(transformer, xs, ys, n, out + i);
+    }
+}
+
+template <typename _Getter>
+struct TransformGetterTask {
+    const _Getter*      Getter;
+    const Transformer2* Transformer;
+    ImVec2*             Out;
+    int                 Tasks;
+
+    static void Run(int task, void* data) {
+        const TransformGetterTask& t = *(const TransformGetterTask*)data;
+        const int first = (int)((ImS64)t.Getter->Count * task / t.Tasks);
+        const int last  = (int)((ImS64)t.Getter->Count * (task + 1) / t.Tasks);
+        TransformGetterRange(*t.Getter, *t.Transformer, first, last, t.Out);
+    }
+};
+
+/// Points that were already converted to pixels by TransformGetter. Renderers read them as they are (see
+/// RendererBase::ToPixels); there is deliberately no operator() returning plot coordinates.
+struct GetterPixels {
+    GetterPixels(const ImVec2* points, int count) : Points(points), Count(count) { }
+    const ImVec2* const Points;
+    const int Count;
+};
+
+/// Converts all points of #getter to pixels of the current plot into the context scratch buffer, on the
+/// parallel tasks of SetParallelFor when the series is large enough.
+template <typename _Getter>
+GetterPixels TransformGetter(const _Getter& getter) {
+    ImPlotContext& gp = *GImPlot;
+    const Transformer2 transformer;
+    gp.TransformedPoints.resize(getter.Count);
+    ImVec2* out = gp.TransformedPoints.Data;
+    const int tasks = gp.ParallelFor != nullptr && getter.Count >= IMPLOT_PARALLEL_MIN_PRIMS ? ImMin(gp.ParallelMaxTasks, getter.Count / IMPLOT_PARALLEL_MIN_CHUNK) : 1;
+    if (tasks > 1) {
+        TransformGetterTask<_Getter> data;
+        data.Getter      = &getter;
+        data.Transformer = &transformer;
+        data.Out         = out;
+        data.Tasks       = tasks;
+        gp.ParallelFor(tasks, &TransformGetterTask<_Getter>::Run, &data, gp.ParallelForUserData);
+    }
+    else {
+        TransformGetterRange(getter, transformer, 0, getter.Count, out);
+    }
+    return GetterPixels(out, getter.Count);
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Renderers
 //-----------------------------------------------------------------------------
@@ -857,6 +1497,12 @@ struct RendererBase {
         IdxConsumed(idx_consumed),
         VtxConsumed(vtx_consumed)
     { }
+    // Restores the state carried from one primitive to the next (e.g. the previous point) as it is before #prim is
+    // rendered, so that a range of primitives can be generated on its own. Stateless renderers need nothing.
+    void Seek(int) const { }
+    // Pixel position of a getter point, points converted by TransformGetter are used as they are
+    template <class _Getter> IMPLOT_INLINE ImVec2 ToPixels(const _Getter& getter, int idx) const { return Transformer(getter(idx)); }
+    IMPLOT_INLINE ImVec2 ToPixels(const GetterPixels& getter, int idx) const { return getter.Points[idx]; }
     const int Prims;
     Transformer2 Transformer;
     const int IdxConsumed;
@@ -871,13 +1517,16 @@ struct RendererLineStrip : RendererBase {
         Col(col),
         HalfWeight(ImMax(1.0f,weight)*0.5f)
     {
-        P1 = this->Transformer(Getter(0));
+        P1 = this->ToPixels(Getter, 0);
     }
     void Init(ImDrawList& draw_list) const {
         GetLineRenderProps(draw_list, HalfWeight, UV0, UV1);
     }
+    void Seek(int prim) const {
+        P1 = this->ToPixels(Getter, prim);
+    }
     IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 P2 = this->Transformer(Getter(prim + 1));
+        ImVec2 P2 = this->ToPixels(Getter, prim + 1);
         if (!cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2)))) {
             P1 = P2;
             return false;
@@ -902,13 +1551,24 @@ struct RendererLineStripSkip : RendererBase {
         Col(col),
         HalfWeight(ImMax(1.0f,weight)*0.5f)
     {
-        P1 = this->Transformer(Getter(0));
+        P1 = this->ToPixels(Getter, 0);
     }
     void Init(ImDrawList& draw_list) const {
         GetLineRenderProps(draw_list, HalfWeight, UV0, UV1);
     }
+    void Seek(int prim) const {
+        // last point before #prim that is not NaN, or the first point
+        for (int i = prim; i > 0; --i) {
+            ImVec2 P = this->ToPixels(Getter, i);
+            if (!ImNan(P.x) && !ImNan(P.y)) {
+                P1 = P;
+                return;
+            }
+        }
+        P1 = this->ToPixels(Getter, 0);
+    }
     IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 P2 = this->Transformer(Getter(prim + 1));
+        ImVec2 P2 = this->ToPixels(Getter, prim + 1);
         if (!cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2)))) {
             if (!ImNan(P2.x) && !ImNan(P2.y))
                 P1 = P2;
@@ -939,8 +1599,8 @@ struct RendererLineSegments1 : RendererBase {
         GetLineRenderProps(draw_list, HalfWeight, UV0, UV1);
     }
     IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 P1 = this->Transformer(Getter(prim*2+0));
-        ImVec2 P2 = this->Transformer(Getter(prim*2+1));
+        ImVec2 P1 = this->ToPixels(Getter, prim*2+0);
+        ImVec2 P2 = this->ToPixels(Getter, prim*2+1);
         if (!cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2))))
             return false;
         PrimLine(draw_list,P1,P2,HalfWeight,Col,UV0,UV1);
@@ -966,8 +1626,8 @@ struct RendererLineSegments2 : RendererBase {
         GetLineRenderProps(draw_list, HalfWeight, UV0, UV1);
     }
     IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 P1 = this->Transformer(Getter1(prim));
-        ImVec2 P2 = this->Transformer(Getter2(prim));
+        ImVec2 P1 = this->ToPixels(Getter1, prim);
+        ImVec2 P2 = this->ToPixels(Getter2, prim);
         if (!cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2))))
             return false;
         PrimLine(draw_list,P1,P2,HalfWeight,Col,UV0,UV1);
@@ -1146,13 +1806,16 @@ struct RendererStairsPre : RendererBase {
         Col(col),
         HalfWeight(ImMax(1.0f,weight)*0.5f)
     {
-        P1 = this->Transformer(Getter(0));
+        P1 = this->ToPixels(Getter, 0);
     }
     void Init(ImDrawList& draw_list) const {
         UV = draw_list._Data->TexUvWhitePixel;
     }
+    void Seek(int prim) const {
+        P1 = this->ToPixels(Getter, prim);
+    }
     IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 P2 = this->Transformer(Getter(prim + 1));
+        ImVec2 P2 = this->ToPixels(Getter, prim + 1);
         if (!cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2)))) {
             P1 = P2;
             return false;
@@ -1177,13 +1840,16 @@ struct RendererStairsPost : RendererBase {
         Col(col),
         HalfWeight(ImMax(1.0f,weight) * 0.5f)
     {
-        P1 = this->Transformer(Getter(0));
+        P1 = this->ToPixels(Getter, 0);
     }
     void Init(ImDrawList& draw_list) const {
         UV = draw_list._Data->TexUvWhitePixel;
     }
+    void Seek(int prim) const {
+        P1 = this->ToPixels(Getter, prim);
+    }
     IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 P2 = this->Transformer(Getter(prim + 1));
+        ImVec2 P2 = this->ToPixels(Getter, prim + 1);
         if (!cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2)))) {
             P1 = P2;
             return false;
@@ -1207,14 +1873,17 @@ struct RendererStairsPreShaded : RendererBase {
         Getter(getter),
         Col(col)
     {
-        P1 = this->Transformer(Getter(0));
+        P1 = this->ToPixels(Getter, 0);
         Y0 = this->Transformer(ImPlotPoint(0,0)).y;
     }
     void Init(ImDrawList& draw_list) const {
         UV = draw_list._Data->TexUvWhitePixel;
     }
+    void Seek(int prim) const {
+        P1 = this->ToPixels(Getter, prim);
+    }
     IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 P2 = this->Transformer(Getter(prim + 1));
+        ImVec2 P2 = this->ToPixels(Getter, prim + 1);
         ImVec2 PMin(ImMin(P1.x, P2.x), ImMin(Y0, P2.y));
         ImVec2 PMax(ImMax(P1.x, P2.x), ImMax(Y0, P2.y));
         if (!cull_rect.Overlaps(ImRect(PMin, PMax))) {
@@ -1239,14 +1908,17 @@ struct RendererStairsPostShaded : RendererBase {
         Getter(getter),
         Col(col)
     {
-        P1 = this->Transformer(Getter(0));
+        P1 = this->ToPixels(Getter, 0);
         Y0 = this->Transformer(ImPlotPoint(0,0)).y;
     }
     void Init(ImDrawList& draw_list) const {
         UV = draw_list._Data->TexUvWhitePixel;
     }
+    void Seek(int prim) const {
+        P1 = this->ToPixels(Getter, prim);
+    }
     IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 P2 = this->Transformer(Getter(prim + 1));
+        ImVec2 P2 = this->ToPixels(Getter, prim + 1);
         ImVec2 PMin(ImMin(P1.x, P2.x), ImMin(P1.y, Y0));
         ImVec2 PMax(ImMax(P1.x, P2.x), ImMax(P1.y, Y0));
         if (!cull_rect.Overlaps(ImRect(PMin, PMax))) {
@@ -1274,15 +1946,19 @@ struct RendererShaded : RendererBase {
         Getter2(getter2),
         Col(col)
     {
-        P11 = this->Transformer(Getter1(0));
-        P12 = this->Transformer(Getter2(0));
+        P11 = this->ToPixels(Getter1, 0);
+        P12 = this->ToPixels(Getter2, 0);
     }
     void Init(ImDrawList& draw_list) const {
         UV = draw_list._Data->TexUvWhitePixel;
     }
+    void Seek(int prim) const {
+        P11 = this->ToPixels(Getter1, prim);
+        P12 = this->ToPixels(Getter2, prim);
+    }
     IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 P21 = this->Transformer(Getter1(prim+1));
-        ImVec2 P22 = this->Transformer(Getter2(prim+1));
+        ImVec2 P21 = this->ToPixels(Getter1, prim+1);
+        ImVec2 P22 = this->ToPixels(Getter2, prim+1);
         ImRect rect(ImMin(ImMin(ImMin(P11,P12),P21),P22), ImMax(ImMax(ImMax(P11,P12),P21),P22));
         if (!cull_rect.Overlaps(rect)) {
             P11 = P21;
@@ -1359,13 +2035,10 @@ struct RendererRectC : RendererBase {
 // [SECTION] RenderPrimitives
 //-----------------------------------------------------------------------------
 
-/// Renders primitive shapes in bulk as efficiently as possible.
+/// Renders the primitives [idx, idx + prims) of an initialized renderer.
 template <class _Renderer>
-void RenderPrimitivesEx(const _Renderer& renderer, ImDrawList& draw_list, const ImRect& cull_rect) {
-    unsigned int prims        = renderer.Prims;
+void RenderPrimitivesRange(const _Renderer& renderer, ImDrawList& draw_list, const ImRect& cull_rect, unsigned int idx, unsigned int prims) {
     unsigned int prims_culled = 0;
-    unsigned int idx          = 0;
-    renderer.Init(draw_list);
     while (prims) {
         // find how many can be reserved up to end of current draw command's limit
         unsigned int cnt = ImMin(prims, (MaxIdx<ImDrawIdx>::Value - draw_list._VtxCurrentIdx) / renderer.VtxConsumed);
@@ -1399,6 +2072,103 @@ void RenderPrimitivesEx(const _Renderer& renderer, ImDrawList& draw_list, const
         draw_list.PrimUnreserve(prims_culled * renderer.IdxConsumed, prims_culled * renderer.VtxConsumed);
 }
 
+/// Shared state of the tasks of RenderPrimitivesParallel. Task i renders its own range of primitives into
+/// ParallelDrawLists[i], then copies the result into the plot draw list at ParallelOffsets[2*i], ParallelOffsets[2*i+1].
+template <class _Renderer>
+struct RenderPrimitivesTask {
+    const _Renderer* Renderer;
+    ImDrawList*      DrawList;
+    ImRect           CullRect;
+    unsigned int     Prims;
+    int              Tasks;
+    ImDrawVert*      VtxDst;
+    ImDrawIdx*       IdxDst;
+    unsigned int     VtxBase;
+
+    static void Generate(int task, void* data) {
+        const RenderPrimitivesTask& t = *(const RenderPrimitivesTask*)data;
+        const unsigned int first = (unsigned int)((ImU64)t.Prims * task / t.Tasks);
+        const unsigned int last  = (unsigned int)((ImU64)t.Prims * (task + 1) / t.Tasks);
+        ImDrawList& staging = *GImPlot->ParallelDrawLists[task];
+        staging._Data = t.DrawList->_Data;
+        staging._ResetForNewFrame();
+        staging.Flags = t.DrawList->Flags;
+        // copied before Init, which may adjust line weights
+        _Renderer renderer(*t.Renderer);
+        renderer.Seek(first);
+        renderer.Init(staging);
+        RenderPrimitivesRange(renderer, staging, t.CullRect, first, last - first);
+    }
+
+    static void Copy(int task, void* data) {
+        const RenderPrimitivesTask& t = *(const RenderPrimitivesTask*)data;
+        const ImDrawList& staging = *GImPlot->ParallelDrawLists[task];
+        const unsigned int vtx_offset = GImPlot->ParallelOffsets[2*task];
+        const unsigned int idx_offset = GImPlot->ParallelOffsets[2*task+1];
+        if (staging.VtxBuffer.Size > 0)
+            memcpy(t.VtxDst + vtx_offset, staging.VtxBuffer.Data, (size_t)staging.VtxBuffer.Size * sizeof(ImDrawVert));
+        const ImDrawIdx base = (ImDrawIdx)(t.VtxBase + vtx_offset);
+        const ImDrawIdx* src = staging.IdxBuffer.Data;
+        ImDrawIdx* dst = t.IdxDst + idx_offset;
+        for (int i = 0; i < staging.IdxBuffer.Size; ++i)
+            dst[i] = (ImDrawIdx)(src[i] + base);
+    }
+};
+
+/// Renders the primitives of a large item on the tasks given to SetParallelFor. The staging buffers are appended
+/// in task order, so the draw list ends up exactly as if the primitives had been rendered one after the other.
+template <class _Renderer>
+void RenderPrimitivesParallel(const _Renderer& renderer, ImDrawList& draw_list, const ImRect& cull_rect, int tasks) {
+    ImPlotContext& gp = *GImPlot;
+    while (gp.ParallelDrawLists.Size < tasks)
+        gp.ParallelDrawLists.push_back(IM_NEW(ImDrawList)(draw_list._Data));
+    gp.ParallelOffsets.resize(2 * tasks);
+
+    RenderPrimitivesTask<_Renderer> data;
+    data.Renderer = &renderer;
+    data.DrawList = &draw_list;
+    data.CullRect = cull_rect;
+    data.Prims    = (unsigned int)renderer.Prims;
+    data.Tasks    = tasks;
+    gp.ParallelFor(tasks, &RenderPrimitivesTask<_Renderer>::Generate, &data, gp.ParallelForUserData);
+
+    unsigned int vtx_count = 0;
+    unsigned int idx_count = 0;
+    for (int i = 0; i < tasks; ++i) {
+        gp.ParallelOffsets[2*i]   = vtx_count;
+        gp.ParallelOffsets[2*i+1] = idx_count;
+        vtx_count += (unsigned int)gp.ParallelDrawLists[i]->VtxBuffer.Size;
+        idx_count += (unsigned int)gp.ParallelDrawLists[i]->IdxBuffer.Size;
+    }
+    if (idx_count == 0)
+        return;
+    data.VtxBase = draw_list._VtxCurrentIdx;
+    draw_list.PrimReserve((int)idx_count, (int)vtx_count);
+    data.VtxDst = draw_list._VtxWritePtr;
+    data.IdxDst = draw_list._IdxWritePtr;
+    gp.ParallelFor(tasks, &RenderPrimitivesTask<_Renderer>::Copy, &data, gp.ParallelForUserData);
+    draw_list._VtxWritePtr   += vtx_count;
+    draw_list._IdxWritePtr   += idx_count;
+    draw_list._VtxCurrentIdx += vtx_count;
+}
+
+/// Renders primitive shapes in bulk as efficiently as possible.
+template <class _Renderer>
+void RenderPrimitivesEx(const _Renderer& renderer, ImDrawList& draw_list, const ImRect& cull_rect) {
+    ImPlotContext& gp = *GImPlot;
+    // The parallel path appends all primitives under one draw command, which needs 32-bit indices
+    if (gp.ParallelFor != nullptr && sizeof(ImDrawIdx) == 4 && renderer.Prims >= IMPLOT_PARALLEL_MIN_PRIMS &&
+        (ImU64)draw_list._VtxCurrentIdx + (ImU64)renderer.Prims * renderer.VtxConsumed <= MaxIdx<ImDrawIdx>::Value) {
+        const int tasks = ImMin(gp.ParallelMaxTasks, renderer.Prims / IMPLOT_PARALLEL_MIN_CHUNK);
+        if (tasks > 1) {
+            RenderPrimitivesParallel(renderer, draw_list, cull_rect, tasks);
+            return;
+        }
+    }
+    renderer.Init(draw_list);
+    RenderPrimitivesRange(renderer, draw_list, cull_rect, 0, (unsigned int)renderer.Prims);
+}
+
 template <template <class> class _Renderer, class _Getter, typename ...Args>
 void RenderPrimitives1(const _Getter& getter, Args... args) {
     ImDrawList& draw_list = *GetPlotDrawList();
@@ -1413,6 +2183,15 @@ void RenderPrimitives2(const _Getter1& getter1, const _Getter2& getter2, Args...
     RenderPrimitivesEx(_Renderer<_Getter1,_Getter2>(getter1,getter2,args...), draw_list, cull_rect);
 }
 
+/// Same as RenderPrimitives1, but large series are first converted to pixels in one batched pass (see TransformGetter).
+template <template <class> class _Renderer, class _Getter, typename ...Args>
+void RenderPrimitivesBatched(const _Getter& getter, Args... args) {
+    if (getter.Count >= IMPLOT_TRANSFORM_BATCH_MIN)
+        RenderPrimitives1<_Renderer>(TransformGetter(getter), args...);
+    else
+        RenderPrimitives1<_Renderer>(getter, args...);
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Markers
 //-----------------------------------------------------------------------------
@@ -1431,7 +2210,7 @@ struct RendererMarkersFill : RendererBase {
         UV = draw_list._Data->TexUvWhitePixel;
     }
     IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 p = this->Transformer(Getter(prim));
+        ImVec2 p = this->ToPixels(Getter, prim);
         if (p.x >= cull_rect.Min.x && p.y >= cull_rect.Min.y && p.x <= cull_rect.Max.x && p.y <= cull_rect.Max.y) {
             for (int i = 0; i < Count; i++) {
                 draw_list._VtxWritePtr[0].pos.x = p.x + Marker[i].x * Size;
@@ -1475,7 +2254,7 @@ struct RendererMarkersLine : RendererBase {
         GetLineRenderProps(draw_list, HalfWeight, UV0, UV1);
     }
     IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 p = this->Transformer(Getter(prim));
+        ImVec2 p = this->ToPixels(Getter, prim);
         if (p.x >= cull_rect.Min.x && p.y >= cull_rect.Min.y && p.x <= cull_rect.Max.x && p.y <= cull_rect.Max.y) {
             for (int i = 0; i < Count; i = i + 2) {
                 ImVec2 p1(p.x + Marker[i].x * Size, p.y + Marker[i].y * Size);
@@ -1537,7 +2316,7 @@ static const ImVec2 MARKER_LINE_PLUS[4]     = {ImVec2(-1, 0), ImVec2(1, 0), ImVe
 static const ImVec2 MARKER_LINE_CROSS[4]    = {ImVec2(-SQRT_1_2,-SQRT_1_2),ImVec2(SQRT_1_2,SQRT_1_2),ImVec2(SQRT_1_2,-SQRT_1_2),ImVec2(-SQRT_1_2,SQRT_1_2)};
 
 template <typename _Getter>
-void RenderMarkers(const _Getter& getter, ImPlotMarker marker, float size, bool rend_fill, ImU32 col_fill, bool rend_line, ImU32 col_line, float weight) {
+void RenderMarkersEx(const _Getter& getter, ImPlotMarker marker, float size, bool rend_fill, ImU32 col_fill, bool rend_line, ImU32 col_line, float weight) {
     if (rend_fill) {
         switch (marker) {
             case ImPlotMarker_Circle  : RenderPrimitives1<RendererMarkersFill>(getter,MARKER_FILL_CIRCLE,10,size,col_fill); break;
@@ -1565,60 +2344,633 @@ void RenderMarkers(const _Getter& getter, ImPlotMarker marker, float size, bool
     }
 }
 
-//-----------------------------------------------------------------------------
-// [SECTION] PlotLine
-//-----------------------------------------------------------------------------
-
-template <typename _Getter>
-void PlotLineEx(const char* label_id, const _Getter& getter, ImPlotLineFlags flags) {
-    if (BeginItemEx(label_id, Fitter1<_Getter>(getter), flags, ImPlotCol_Line)) {
-        if (getter.Count <= 0) {
-            EndItem();
-            return;
-        }
-        const ImPlotNextItemData& s = GetItemData();
-        if (getter.Count > 1) {
-            if (ImHasFlag(flags, ImPlotLineFlags_Shaded) && s.RenderFill) {
-                const ImU32 col_fill = ImGui::GetColorU32(s.Colors[ImPlotCol_Fill]);
-                GetterOverrideY<_Getter> getter2(getter, 0);
-                RenderPrimitives2<RendererShaded>(getter,getter2,col_fill);
-            }
-            if (s.RenderLine) {
-                const ImU32 col_line = ImGui::GetColorU32(s.Colors[ImPlotCol_Line]);
-                if (ImHasFlag(flags,ImPlotLineFlags_Segments)) {
-                    RenderPrimitives1<RendererLineSegments1>(getter,col_line,s.LineWeight);
-                }
-                else if (ImHasFlag(flags, ImPlotLineFlags_Loop)) {
-                    if (ImHasFlag(flags, ImPlotLineFlags_SkipNaN))
-                        RenderPrimitives1<RendererLineStripSkip>(GetterLoop<_Getter>(getter),col_line,s.LineWeight);
-                    else
-                        RenderPrimitives1<RendererLineStrip>(GetterLoop<_Getter>(getter),col_line,s.LineWeight);
-                }
-                else {
-                    if (ImHasFlag(flags, ImPlotLineFlags_SkipNaN))
-                        RenderPrimitives1<RendererLineStripSkip>(getter,col_line,s.LineWeight);
-                    else
-                        RenderPrimitives1<RendererLineStrip>(getter,col_line,s.LineWeight);
-                }
-            }
-        }
-        // render markers
-        if (s.Marker != ImPlotMarker_None) {
-            if (ImHasFlag(flags, ImPlotLineFlags_NoClip)) {
-                PopPlotClipRect();
-                PushPlotClipRect(s.MarkerSize);
-            }
-            const ImU32 col_line = ImGui::GetColorU32(s.Colors[ImPlotCol_MarkerOutline]);
-            const ImU32 col_fill = ImGui::GetColorU32(s.Colors[ImPlotCol_MarkerFill]);
-            RenderMarkers<_Getter>(getter, s.Marker, s.MarkerSize, s.RenderMarkerFill, col_fill, s.RenderMarkerLine, col_line, s.MarkerWeight);
+/// Draws each marker as one quad of its sprite in the marker texture (see CreateMarkerTexture), snapped to whole pixels so
+/// that texels map to pixels one to one. #Cols, if not null, holds the color of each marker.
+template <class _Getter>
+struct RendererMarkersSprite : RendererBase {
+    RendererMarkersSprite(const _Getter& getter, const ImVec2& uv0, const ImVec2& uv1, int side, ImU32 col, const ImU32* cols) :
+        RendererBase(getter.Count, 6, 4),
+        Getter(getter),
+        UV0(uv0),
+        UV1(uv1),
+        HalfSide(side * 0.5f),
+        Col(col),
+        Cols(cols)
+    { }
+    void Init(ImDrawList&) const { }
+    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
+        ImVec2 p = this->ToPixels(Getter, prim);
+        if (p.x >= cull_rect.Min.x && p.y >= cull_rect.Min.y && p.x <= cull_rect.Max.x && p.y <= cull_rect.Max.y) {
+            const float cx = ImFloor(p.x + 0.5f), cy = ImFloor(p.y + 0.5f);
+            const ImU32 col = Cols != nullptr ? Cols[prim] : Col;
+            draw_list._VtxWritePtr[0].pos = ImVec2(cx - HalfSide, cy - HalfSide);
+            draw_list._VtxWritePtr[0].uv  = UV0;
+            draw_list._VtxWritePtr[0].col = col;
+            draw_list._VtxWritePtr[1].pos = ImVec2(cx + HalfSide, cy - HalfSide);
+            draw_list._VtxWritePtr[1].uv  = ImVec2(UV1.x, UV0.y);
+            draw_list._VtxWritePtr[1].col = col;
+            draw_list._VtxWritePtr[2].pos = ImVec2(cx + HalfSide, cy + HalfSide);
+            draw_list._VtxWritePtr[2].uv  = UV1;
+            draw_list._VtxWritePtr[2].col = col;
+            draw_list._VtxWritePtr[3].pos = ImVec2(cx - HalfSide, cy + HalfSide);
+            draw_list._VtxWritePtr[3].uv  = ImVec2(UV0.x, UV1.y);
+            draw_list._VtxWritePtr[3].col = col;
+            draw_list._VtxWritePtr += 4;
+            draw_list._IdxWritePtr[0] = (ImDrawIdx)(draw_list._VtxCurrentIdx);
+            draw_list._IdxWritePtr[1] = (ImDrawIdx)(draw_list._VtxCurrentIdx + 1);
+            draw_list._IdxWritePtr[2] = (ImDrawIdx)(draw_list._VtxCurrentIdx + 2);
+            draw_list._IdxWritePtr[3] = (ImDrawIdx)(draw_list._VtxCurrentIdx);
+            draw_list._IdxWritePtr[4] = (ImDrawIdx)(draw_list._VtxCurrentIdx + 2);
+            draw_list._IdxWritePtr[5] = (ImDrawIdx)(draw_list._VtxCurrentIdx + 3);
+            draw_list._IdxWritePtr += 6;
+            draw_list._VtxCurrentIdx += 4;
+            return true;
         }
-        EndItem();
+        return false;
     }
-}
+    const _Getter& Getter;
+    const ImVec2 UV0;
+    const ImVec2 UV1;
+    const float HalfSide;
+    const ImU32 Col;
+    const ImU32* Cols;
+};
 
-template <typename T>
-void PlotLine(const char* label_id, const T* values, int count, double xscale, double x0, ImPlotLineFlags flags, int offset, int stride) {
-    GetterXY<IndexerLin,IndexerIdx<T>> getter(IndexerLin(xscale,x0),IndexerIdx<T>(values,count,offset,stride),count);
+// Number of marker sizes in the sprite sheet, sprite k being drawn for a marker size of (k + 1) / 2 pixels
+static const int MARKER_SPRITE_SIZES  = IMPLOT_MARKER_SPRITE_MAX_SIZE * 2;
+// Rows of the sprite sheet: the fills of the fillable shapes, then the outlines of all shapes
+static const int MARKER_SPRITE_SHAPES = ImPlotMarker_Right + 1 + ImPlotMarker_COUNT;
+
+// Returns the fill polygon or outline segments of #marker, or nullptr if it has none.
+static const ImVec2* GetMarkerShape(ImPlotMarker marker, bool fill, int* count) {
+    if (fill) {
+        switch (marker) {
+            case ImPlotMarker_Circle  : *count = 10; return MARKER_FILL_CIRCLE;
+            case ImPlotMarker_Square  : *count = 4;  return MARKER_FILL_SQUARE;
+            case ImPlotMarker_Diamond : *count = 4;  return MARKER_FILL_DIAMOND;
+            case ImPlotMarker_Up      : *count = 3;  return MARKER_FILL_UP;
+            case ImPlotMarker_Down    : *count = 3;  return MARKER_FILL_DOWN;
+            case ImPlotMarker_Left    : *count = 3;  return MARKER_FILL_LEFT;
+            case ImPlotMarker_Right   : *count = 3;  return MARKER_FILL_RIGHT;
+        }
+    }
+    else {
+        switch (marker) {
+            case ImPlotMarker_Circle    : *count = 20; return MARKER_LINE_CIRCLE;
+            case ImPlotMarker_Square    : *count = 8;  return MARKER_LINE_SQUARE;
+            case ImPlotMarker_Diamond   : *count = 8;  return MARKER_LINE_DIAMOND;
+            case ImPlotMarker_Up        : *count = 6;  return MARKER_LINE_UP;
+            case ImPlotMarker_Down      : *count = 6;  return MARKER_LINE_DOWN;
+            case ImPlotMarker_Left      : *count = 6;  return MARKER_LINE_LEFT;
+            case ImPlotMarker_Right     : *count = 6;  return MARKER_LINE_RIGHT;
+            case ImPlotMarker_Asterisk  : *count = 6;  return MARKER_LINE_ASTERISK;
+            case ImPlotMarker_Plus      : *count = 4;  return MARKER_LINE_PLUS;
+            case ImPlotMarker_Cross     : *count = 4;  return MARKER_LINE_CROSS;
+        }
+    }
+    *count = 0;
+    return nullptr;
+}
+
+// Side in texels of the sprites of size #size_idx: room for the marker and its anti-aliased edge, even so that the
+// center of the sprite falls on a texel corner.
+static inline int GetMarkerSpriteSide(int size_idx) {
+    return 2 * (int)ImCeil((size_idx + 1) * 0.5f + 1.0f);
+}
+
+// Left edge in the sprite sheet of the sprites of size #size_idx, or the width of the sheet for MARKER_SPRITE_SIZES.
+static int GetMarkerSpriteX(int size_idx) {
+    int x = 0;
+    for (int k = 0; k < size_idx; ++k)
+        x += GetMarkerSpriteSide(k);
+    return x;
+}
+
+static bool InsideMarkerPolygon(const ImVec2* shape, int count, float size, const ImVec2& p) {
+    bool neg = false, pos = false;
+    for (int i = 0; i < count; ++i) {
+        const ImVec2 a = shape[i] * size, b = shape[(i + 1) % count] * size;
+        const float cross = (b.x - a.x) * (p.y - a.y) - (b.y - a.y) * (p.x - a.x);
+        neg |= cross < 0;
+        pos |= cross > 0;
+    }
+    return !(neg && pos);
+}
+
+static bool NearMarkerSegments(const ImVec2* shape, int count, float size, const ImVec2& p) {
+    for (int i = 0; i < count; i += 2) {
+        const ImVec2 a = shape[i] * size, ab = shape[i + 1] * size - a, ap = p - a;
+        const float t = ImSaturate(ImDot(ap, ab) / ImMax(ImDot(ab, ab), 1e-6f));
+        if (ImLengthSqr(ap - ab * t) <= 0.25f)
+            return true;
+    }
+    return false;
+}
+
+// Rasterizes every marker shape at every sprite size into one texture of the texture backend, white with the covered
+// fraction of 4x4 samples per texel in alpha. Fills are sampled against their polygon, outlines against segments one
+// pixel wide, like RendererMarkersFill and RendererMarkersLine draw them.
+static bool CreateMarkerTexture() {
+    ImPlotContext& gp = *GImPlot;
+    if (gp.MarkerTexture != 0)
+        return true;
+    const int row_h = GetMarkerSpriteSide(MARKER_SPRITE_SIZES - 1);
+    const int tex_w = GetMarkerSpriteX(MARKER_SPRITE_SIZES);
+    const int tex_h = MARKER_SPRITE_SHAPES * row_h;
+    ImVector<ImU32>& pixels = gp.HeatmapPixels;
+    GetHeatmapPixels(gp, tex_w * tex_h);
+    memset(pixels.Data, 0, (size_t)pixels.size_in_bytes());
+    for (int row = 0; row < MARKER_SPRITE_SHAPES; ++row) {
+        const bool fill = row <= ImPlotMarker_Right;
+        int count;
+        const ImVec2* shape = GetMarkerShape(fill ? row : row - (ImPlotMarker_Right + 1), fill, &count);
+        for (int k = 0, x0 = 0; k < MARKER_SPRITE_SIZES; x0 += GetMarkerSpriteSide(k++)) {
+            const int side = GetMarkerSpriteSide(k);
+            const float size = (k + 1) * 0.5f, center = side * 0.5f;
+            for (int ty = 0; ty < side; ++ty) {
+                for (int tx = 0; tx < side; ++tx) {
+                    int covered = 0;
+                    for (int s = 0; s < 16; ++s) {
+                        const ImVec2 p(tx + ((s & 3) + 0.5f) * 0.25f - center, ty + ((s >> 2) + 0.5f) * 0.25f - center);
+                        covered += fill ? InsideMarkerPolygon(shape, count, size, p) : NearMarkerSegments(shape, count, size, p);
+                    }
+                    pixels[(row * row_h + ty) * tex_w + x0 + tx] = IM_COL32(255, 255, 255, covered * 255 / 16);
+                }
+            }
+        }
+    }
+    gp.MarkerTexture = gp.CreateTexture(pixels.Data, tex_w, tex_h, gp.TextureUserData);
+    return gp.MarkerTexture != 0;
+}
+
+// Merges the markers of #getter that land on the same pixel of #cull_rect into bins, in the order of their first marker.
+static void BinMarkers(const GetterPixels& getter, const ImRect& cull_rect) {
+    ImPlotContext& gp = *GImPlot;
+    const int x0 = (int)ImFloor(cull_rect.Min.x);
+    const int y0 = (int)ImFloor(cull_rect.Min.y);
+    const int w  = (int)ImFloor(cull_rect.Max.x + 0.5f) - x0 + 1;
+    const int h  = (int)ImFloor(cull_rect.Max.y + 0.5f) - y0 + 1;
+    // the grid is all zeros between calls, only the cells of this call are cleared again
+    if (gp.MarkerBinGrid.Size < w * h)
+        gp.MarkerBinGrid.resize(w * h, 0);
+    int* grid = gp.MarkerBinGrid.Data;
+    gp.MarkerBinCells.resize(0);
+    gp.MarkerBinCounts.resize(0);
+    gp.MarkerBinPoints.resize(0);
+    for (int i = 0; i < getter.Count; ++i) {
+        const ImVec2 p = getter.Points[i];
+        if (!(p.x >= cull_rect.Min.x && p.y >= cull_rect.Min.y && p.x <= cull_rect.Max.x && p.y <= cull_rect.Max.y))
+            continue;
+        const int cell = ((int)ImFloor(p.y + 0.5f) - y0) * w + (int)ImFloor(p.x + 0.5f) - x0;
+        int& bin = grid[cell];
+        if (bin == 0) {
+            gp.MarkerBinCells.push_back(cell);
+            gp.MarkerBinCounts.push_back(0);
+            gp.MarkerBinPoints.push_back(p);
+            bin = gp.MarkerBinCells.Size;
+        }
+        gp.MarkerBinCounts[bin - 1]++;
+    }
+    for (int b = 0; b < gp.MarkerBinCells.Size; ++b)
+        grid[gp.MarkerBinCells[b]] = 0;
+}
+
+// Colors the bins of BinMarkers with #col at the opacity of as many markers stacked as each bin holds.
+static void ColorMarkerBins(ImU32 col) {
+    ImPlotContext& gp = *GImPlot;
+    const float a = ((col >> IM_COL32_A_SHIFT) & 0xFF) / 255.0f;
+    ImU32 stacked[256];
+    for (int n = 0; n < 256; ++n) {
+        const float alpha = 1.0f - ImPow(1.0f - a, (float)(n + 1));
+        stacked[n] = (col & ~IM_COL32_A_MASK) | ((ImU32)(alpha * 255.0f + 0.5f) << IM_COL32_A_SHIFT);
+    }
+    gp.MarkerBinColors.resize(gp.MarkerBinCounts.Size);
+    for (int b = 0; b < gp.MarkerBinCounts.Size; ++b)
+        gp.MarkerBinColors[b] = stacked[ImMin(gp.MarkerBinCounts[b], 256) - 1];
+}
+
+// Draws the markers of a batched series as sprites, one quad per marker instead of a polygon of up to 10 vertices and an
+// outline of up to 10 segments, and with at least IMPLOT_MARKER_BIN_MIN markers one quad per pixel that markers land on.
+// Returns false if the markers cannot be drawn this way: no texture backend, a marker too large or an outline too wide.
+static bool RenderMarkerSprites(const GetterPixels& getter, ImPlotMarker marker, float size, bool rend_fill, ImU32 col_fill, bool rend_line, ImU32 col_line, float weight) {
+    ImPlotContext& gp = *GImPlot;
+    const int size_idx = (int)(size * 2.0f + 0.5f) - 1;
+    if (gp.CreateTexture == nullptr || marker < 0 || marker >= ImPlotMarker_COUNT || !(size_idx >= 0 && size_idx < MARKER_SPRITE_SIZES) || (rend_line && weight > 1.0f))
+        return false;
+    if (!CreateMarkerTexture())
+        return false;
+    ImDrawList& draw_list = *GetPlotDrawList();
+    const ImRect& cull_rect = GetCurrentPlot()->PlotRect;
+    const bool binned = getter.Count >= IMPLOT_MARKER_BIN_MIN;
+    if (binned)
+        BinMarkers(getter, cull_rect);
+    const GetterPixels bins(gp.MarkerBinPoints.Data, gp.MarkerBinPoints.Size);
+    const int side = GetMarkerSpriteSide(size_idx);
+    const int row_h = GetMarkerSpriteSide(MARKER_SPRITE_SIZES - 1);
+    const float x0 = (float)GetMarkerSpriteX(size_idx);
+    const ImVec2 texel(1.0f / GetMarkerSpriteX(MARKER_SPRITE_SIZES), 1.0f / (MARKER_SPRITE_SHAPES * row_h));
+    draw_list.PushTextureID(gp.MarkerTexture);
+    for (int layer = 0; layer < 2; ++layer) {
+        const bool fill = layer == 0;
+        int count;
+        if (!(fill ? rend_fill : rend_line) || GetMarkerShape(marker, fill, &count) == nullptr)
+            continue;
+        const float y0 = (float)((fill ? marker : ImPlotMarker_Right + 1 + marker) * row_h);
+        const ImVec2 uv0(x0 * texel.x, y0 * texel.y), uv1((x0 + side) * texel.x, (y0 + side) * texel.y);
+        const ImU32 col = fill ? col_fill : col_line;
+        if (binned) {
+            ColorMarkerBins(col);
+            RenderPrimitivesEx(RendererMarkersSprite<GetterPixels>(bins, uv0, uv1, side, col, gp.MarkerBinColors.Data), draw_list, cull_rect);
+        }
+        else {
+            RenderPrimitivesEx(RendererMarkersSprite<GetterPixels>(getter, uv0, uv1, side, col, nullptr), draw_list, cull_rect);
+        }
+    }
+    draw_list.PopTextureID();
+    return true;
+}
+
+template <typename _Getter>
+void RenderMarkers(const _Getter& getter, ImPlotMarker marker, float size, bool rend_fill, ImU32 col_fill, bool rend_line, ImU32 col_line, float weight) {
+    // fill and outline share one batched conversion of large series, drawn as sprites when possible
+    if (getter.Count >= IMPLOT_TRANSFORM_BATCH_MIN && (rend_fill || rend_line)) {
+        const GetterPixels pixels = TransformGetter(getter);
+        if (!RenderMarkerSprites(pixels, marker, size, rend_fill, col_fill, rend_line, col_line, weight))
+            RenderMarkersEx(pixels, marker, size, rend_fill, col_fill, rend_line, col_line, weight);
+    }
+    else
+        RenderMarkersEx(getter, marker, size, rend_fill, col_fill, rend_line, col_line, weight);
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] Series Buffers
+//-----------------------------------------------------------------------------
+
+// Uses the Version of a series buffer as the data version of the next item, unless one was set explicitly.
+// The buffer address goes into the upper bits so that another buffer plotted under the same label never matches.
+static void SetNextItemSeriesVersion(const ImPlotSeriesBuffer& buffer) {
+    ImPlotContext& gp = *GImPlot;
+    if (gp.NextItemData.HasDataVersion)
+        return;
+    const ImPlotSeriesBuffer* ptr = &buffer;
+    SetNextItemDataVersion(((ImU64)ImHashData(&ptr, sizeof(ptr)) << 32) | (ImU32)buffer.Version);
+}
+
+/// Interprets a range of an ImPlotSeriesBuffer as ImPlotPoints
+struct GetterSeriesBuffer {
+    GetterSeriesBuffer(const ImPlotSeriesBuffer& buffer, int first, int count) :
+        Chunks(buffer.Chunks.Data),
+        First(first),
+        Count(count)
+    { }
+    template <typename I> IMPLOT_INLINE ImPlotPoint operator()(I idx) const {
+        const int i = First + (int)idx;
+        const ImPlotSeriesChunk* chunk = Chunks[i / IMPLOT_SERIES_CHUNK_SIZE];
+        const int j = i % IMPLOT_SERIES_CHUNK_SIZE;
+        return ImPlotPoint(chunk->Xs[j], chunk->Ys[j]);
+    }
+    ImPlotSeriesChunk* const* const Chunks;
+    const int First;
+    const int Count;
+};
+
+// Extends axis with a whole chunk whose values span v and alternate values span v_alt. Returns
+// false if the chunk must be walked point by point because RangeFit or the axis constraints only
+// partially apply to it.
+static inline bool FitSeriesChunk(ImPlotAxis& axis, const ImPlotAxis& alt, const ImPlotRange& v, const ImPlotRange& v_alt, bool all_finite) {
+    if (v.Min > v.Max)
+        return true;
+    if (ImHasFlag(axis.Flags, ImPlotAxisFlags_RangeFit)) {
+        if (v_alt.Min > v_alt.Max || v_alt.Max < alt.Range.Min || v_alt.Min > alt.Range.Max)
+            return true;
+        if (!all_finite || v_alt.Min < alt.Range.Min || v_alt.Max > alt.Range.Max)
+            return false;
+    }
+    if (v.Min < axis.ConstraintRange.Min || v.Max > axis.ConstraintRange.Max)
+        return false;
+    axis.ExtendFit(v.Min);
+    axis.ExtendFit(v.Max);
+    return true;
+}
+
+/// Fits an ImPlotSeriesBuffer from its chunk bounds, walking only chunks that straddle a RangeFit or constraint limit
+struct FitterSeriesBuffer {
+    FitterSeriesBuffer(const ImPlotSeriesBuffer& buffer) : Buffer(buffer) { }
+    void Fit(ImPlotAxis& x_axis, ImPlotAxis& y_axis) const {
+        for (int c = 0; c < Buffer.Chunks.Size; ++c) {
+            const ImPlotSeriesChunk& chunk = *Buffer.Chunks[c];
+            const bool fit_x = FitSeriesChunk(x_axis, y_axis, chunk.Bounds.X, chunk.Bounds.Y, chunk.AllFinite);
+            const bool fit_y = FitSeriesChunk(y_axis, x_axis, chunk.Bounds.Y, chunk.Bounds.X, chunk.AllFinite);
+            if (fit_x && fit_y)
+                continue;
+            for (int i = 0; i < chunk.Count; ++i) {
+                if (!fit_x)
+                    x_axis.ExtendFitWith(y_axis, chunk.Xs[i], chunk.Ys[i]);
+                if (!fit_y)
+                    y_axis.ExtendFitWith(x_axis, chunk.Ys[i], chunk.Xs[i]);
+            }
+        }
+    }
+    const ImPlotSeriesBuffer& Buffer;
+};
+
+static inline bool SeriesRectVisible(double x_min, double x_max, double y_min, double y_max, const ImPlotRect& view) {
+    return x_min <= view.X.Max && x_max >= view.X.Min && y_min <= view.Y.Max && y_max >= view.Y.Min;
+}
+
+// Computes the index range [first,last) of a series buffer that can touch the current plot area,
+// using chunk bounds only. With connect set, the segments joining adjacent chunks are considered too.
+// With to_zero set, bounds reach down (or up) to y = 0 for shaded lines. The plot area is grown by
+// pad pixels on every side so that markers centered just outside of it are kept.
+static void GetSeriesVisibleRange(const ImPlotSeriesBuffer& buffer, bool connect, bool to_zero, float pad, int* first, int* last) {
+    ImPlotPlot& plot = *GImPlot->CurrentPlot;
+    const ImPlotAxis& x_axis = plot.Axes[plot.CurrentX];
+    const ImPlotAxis& y_axis = plot.Axes[plot.CurrentY];
+    ImPlotRect view(x_axis.Range.Min, x_axis.Range.Max, y_axis.Range.Min, y_axis.Range.Max);
+    if (pad > 0) {
+        const double x0 = x_axis.PixelsToPlot(plot.PlotRect.Min.x - pad), x1 = x_axis.PixelsToPlot(plot.PlotRect.Max.x + pad);
+        const double y0 = y_axis.PixelsToPlot(plot.PlotRect.Min.y - pad), y1 = y_axis.PixelsToPlot(plot.PlotRect.Max.y + pad);
+        view = ImPlotRect(ImMin(x0, x1), ImMax(x0, x1), ImMin(y0, y1), ImMax(y0, y1));
+    }
+    const double zero_min = to_zero ? 0.0 : HUGE_VAL;
+    const double zero_max = to_zero ? 0.0 : -HUGE_VAL;
+    *first = buffer.Size;
+    *last  = 0;
+    for (int c = 0; c < buffer.Chunks.Size; ++c) {
+        const ImPlotSeriesChunk& chunk = *buffer.Chunks[c];
+        const int begin = c * IMPLOT_SERIES_CHUNK_SIZE;
+        const ImPlotRect& b = chunk.Bounds;
+        if (!chunk.AllFinite || SeriesRectVisible(b.X.Min, b.X.Max, ImMin(b.Y.Min, zero_min), ImMax(b.Y.Max, zero_max), view)) {
+            *first = ImMin(*first, begin);
+            *last  = ImMax(*last, begin + chunk.Count);
+        }
+        if (connect && c + 1 < buffer.Chunks.Size) {
+            const ImPlotSeriesChunk& next = *buffer.Chunks[c + 1];
+            const int n = chunk.Count - 1;
+            const double x0 = chunk.Xs[n], y0 = chunk.Ys[n], x1 = next.Xs[0], y1 = next.Ys[0];
+            if (ImNanOrInf(x0) || ImNanOrInf(y0) || ImNanOrInf(x1) || ImNanOrInf(y1) ||
+                SeriesRectVisible(ImMin(x0, x1), ImMax(x0, x1), ImMin(ImMin(y0, y1), zero_min), ImMax(ImMax(y0, y1), zero_max), view)) {
+                *first = ImMin(*first, begin + n);
+                *last  = ImMax(*last, begin + n + 2);
+            }
+        }
+    }
+    if (*first >= *last)
+        *first = *last = 0;
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] Line LOD
+//-----------------------------------------------------------------------------
+
+// Level k of the pyramid summarizes runs of 1 << (IMPLOT_LOD_BASE_SHIFT + k * IMPLOT_LOD_FANOUT_SHIFT) points.
+static const int IMPLOT_LOD_BASE_SHIFT   = 3;
+static const int IMPLOT_LOD_FANOUT_SHIFT = 2;
+
+// Bitwise point comparison, so that NaN samples compare equal to themselves.
+static inline bool LODSampleEqual(const ImPlotPoint& a, const ImPlotPoint& b) {
+    return memcmp(&a, &b, sizeof(ImPlotPoint)) == 0;
+}
+
+static inline void LODNodeReset(ImPlotLODNode& node) {
+    node.MinY   = HUGE_VAL;
+    node.MaxY   = -HUGE_VAL;
+    node.MinIdx = node.MaxIdx = -1;
+}
+
+// NaNs never compare less/greater, so they are ignored by the reduction.
+static inline void LODNodeAddPoint(ImPlotLODNode& node, double y, int idx) {
+    if (y < node.MinY) { node.MinY = y; node.MinIdx = idx; }
+    if (y > node.MaxY) { node.MaxY = y; node.MaxIdx = idx; }
+}
+
+static inline void LODNodeMerge(ImPlotLODNode& node, const ImPlotLODNode& other) {
+    if (other.MinY < node.MinY) { node.MinY = other.MinY; node.MinIdx = other.MinIdx; }
+    if (other.MaxY > node.MaxY) { node.MaxY = other.MaxY; node.MaxIdx = other.MaxIdx; }
+}
+
+// Brings the pyramid up to date with the getter. Appended points only extend the pyramid, anything else rebuilds it.
+template <typename _Getter>
+void UpdateLineLOD(ImPlotLineLOD& lod, const _Getter& getter) {
+    const int count = getter.Count;
+    const bool appended = lod.Count > 0 && count >= lod.Count
+                       && LODSampleEqual(getter(0), lod.First)
+                       && LODSampleEqual(getter(lod.Count / 2), lod.Mid)
+                       && LODSampleEqual(getter(lod.Count - 1), lod.Last);
+    if (appended && count == lod.Count)
+        return;
+    if (!appended)
+        lod.Reset();
+    // x must be ascending for the column search; NaN x values also disable decimation
+    if (lod.Sorted) {
+        double prev_x = lod.Count > 0 ? lod.Last.x : -HUGE_VAL;
+        for (int i = lod.Count; i < count; ++i) {
+            const double x = getter(i).x;
+            if (!(x >= prev_x)) {
+                lod.Sorted = false;
+                break;
+            }
+            prev_x = x;
+        }
+    }
+    // finest level straight from the source points, coarser levels from their children
+    ImVector<ImPlotLODNode>& base = lod.Levels[0];
+    const int base_size  = 1 << IMPLOT_LOD_BASE_SHIFT;
+    const int base_nodes = count >> IMPLOT_LOD_BASE_SHIFT;
+    for (int n = base.Size; n < base_nodes; ++n) {
+        ImPlotLODNode node;
+        LODNodeReset(node);
+        for (int i = n * base_size, ie = i + base_size; i < ie; ++i)
+            LODNodeAddPoint(node, getter(i).y, i);
+        base.push_back(node);
+    }
+    const int fanout = 1 << IMPLOT_LOD_FANOUT_SHIFT;
+    for (int k = 1; k < IMPLOT_LOD_MAX_LEVELS; ++k) {
+        const ImVector<ImPlotLODNode>& children = lod.Levels[k-1];
+        ImVector<ImPlotLODNode>& level = lod.Levels[k];
+        const int nodes = children.Size >> IMPLOT_LOD_FANOUT_SHIFT;
+        for (int n = level.Size; n < nodes; ++n) {
+            ImPlotLODNode node = children[n * fanout];
+            for (int c = 1; c < fanout; ++c)
+                LODNodeMerge(node, children[n * fanout + c]);
+            level.push_back(node);
+        }
+    }
+    lod.Count = count;
+    lod.First = getter(0);
+    lod.Mid   = getter(count / 2);
+    lod.Last  = getter(count - 1);
+}
+
+// Min/max of points [i0,i1) using the largest aligned pyramid nodes that fit, and source points at the ragged ends.
+template <typename _Getter>
+void QueryLineLOD(const ImPlotLineLOD& lod, const _Getter& getter, int i0, int i1, ImPlotLODNode& out) {
+    LODNodeReset(out);
+    while (i0 < i1) {
+        int level = -1, shift = 0;
+        for (int k = 0, s = IMPLOT_LOD_BASE_SHIFT; k < IMPLOT_LOD_MAX_LEVELS; ++k, s += IMPLOT_LOD_FANOUT_SHIFT) {
+            const int size = 1 << s;
+            if ((i0 & (size - 1)) != 0 || i1 - i0 < size || (i0 >> s) >= lod.Levels[k].Size)
+                break;
+            level = k;
+            shift = s;
+        }
+        if (level < 0) {
+            LODNodeAddPoint(out, getter(i0).y, i0);
+            ++i0;
+        }
+        else {
+            LODNodeMerge(out, lod.Levels[level][i0 >> shift]);
+            i0 += 1 << shift;
+        }
+    }
+}
+
+// First index in [lo,hi) whose x is >= x (or > x if upper is set); x must be ascending.
+template <typename _Getter>
+int BoundLineLOD(const _Getter& getter, int lo, int hi, double x, bool upper) {
+    while (lo < hi) {
+        const int mid = lo + (hi - lo) / 2;
+        const double mx = getter(mid).x;
+        if (upper ? (mx <= x) : (mx < x))
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+// Frees pyramids of items that stopped using ImPlotLineFlags_LOD.
+static void GcLineLODs(int frame) {
+    ImPlotContext& gp = *GImPlot;
+    for (int n = 0; n < gp.LineLODs.GetMapSize(); ++n) {
+        ImPlotLineLOD* lod = gp.LineLODs.TryGetMapData(n);
+        if (lod != nullptr && frame - lod->LastFrame > IMPLOT_LOD_GC_FRAMES)
+            gp.LineLODs.Remove(lod->ID, lod);
+    }
+}
+
+// Renders a line strip decimated to first/min/max/last per pixel column. The envelope of every
+// column is preserved, so the result is visually identical to the full strip while the number of
+// primitives stays proportional to the plot width. Returns false if the caller should draw the
+// full strip instead (too few points, or x values not ascending).
+template <typename _Getter>
+bool RenderLineLOD(const _Getter& getter, ImU32 col, float weight, bool skip_nan) {
+    ImPlotContext& gp = *GImPlot;
+    ImPlotPlot& plot = *gp.CurrentPlot;
+    const ImPlotAxis& x_axis = plot.Axes[plot.CurrentX];
+    const int count = getter.Count;
+    if (count < 4 * (int)plot.PlotRect.GetWidth())
+        return false;
+    const int frame = ImGui::GetFrameCount();
+    ImPlotLineLOD& lod = *gp.LineLODs.GetOrAddByKey(gp.CurrentItem->ID);
+    lod.ID        = gp.CurrentItem->ID;
+    lod.LastFrame = frame;
+    UpdateLineLOD(lod, getter);
+    if (!lod.Sorted)
+        return false;
+    // visible index range, padded by one point on each side so segments leaving the plot are still drawn
+    int begin = BoundLineLOD(getter, 0, count, x_axis.Range.Min, false);
+    int end   = BoundLineLOD(getter, begin, count, x_axis.Range.Max, true);
+    begin = ImMax(begin - 1, 0);
+    end   = ImMin(end + 1, count);
+    ImVector<ImPlotPoint>& pts = gp.TempPoint1;
+    pts.shrink(0);
+    const bool inverted = x_axis.IsInverted();
+    for (int i = begin; i < end; ) {
+        // [i,j) are the points whose x falls in the same pixel column as point i
+        const float col_pix = ImFloor(x_axis.PlotToPixels(getter(i).x));
+        int j = inverted ? BoundLineLOD(getter, i + 1, end, x_axis.PixelsToPlot(col_pix), true)
+                         : BoundLineLOD(getter, i + 1, end, x_axis.PixelsToPlot(col_pix + 1), false);
+        j = ImMax(j, i + 1);
+        if (j - i <= 4) {
+            for (int k = i; k < j; ++k)
+                pts.push_back(getter(k));
+        }
+        else {
+            ImPlotLODNode node;
+            QueryLineLOD(lod, getter, i + 1, j - 1, node);
+            int idx[4] = { i, node.MinIdx, node.MaxIdx, j - 1 };
+            if (idx[1] > idx[2])
+                ImSwap(idx[1], idx[2]);
+            for (int k = 0; k < 4; ++k) {
+                if (idx[k] >= 0 && (k == 0 || idx[k] != idx[k-1]))
+                    pts.push_back(getter(idx[k]));
+            }
+        }
+        i = j;
+    }
+    if (pts.Size > 1) {
+        IndexerIdx<double> xs(&pts.Data[0].x, pts.Size, 0, sizeof(ImPlotPoint));
+        IndexerIdx<double> ys(&pts.Data[0].y, pts.Size, 0, sizeof(ImPlotPoint));
+        GetterXY<IndexerIdx<double>,IndexerIdx<double>> getter_lod(xs, ys, pts.Size);
+        if (skip_nan)
+            RenderPrimitives1<RendererLineStripSkip>(getter_lod, col, weight);
+        else
+            RenderPrimitives1<RendererLineStrip>(getter_lod, col, weight);
+    }
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] PlotLine
+//-----------------------------------------------------------------------------
+
+template <typename _Getter, typename _Fitter>
+void PlotLineEx(const char* label_id, const _Getter& getter, const _Fitter& fitter, ImPlotLineFlags flags) {
+    if (BeginItemEx(label_id, fitter, flags, ImPlotCol_Line)) {
+        if (getter.Count <= 0) {
+            EndItem();
+            return;
+        }
+        const ImPlotNextItemData& s = GetItemData();
+        if (getter.Count > 1) {
+            if (ImHasFlag(flags, ImPlotLineFlags_Shaded) && s.RenderFill) {
+                const ImU32 col_fill = ImGui::GetColorU32(s.Colors[ImPlotCol_Fill]);
+                GetterOverrideY<_Getter> getter2(getter, 0);
+                RenderPrimitives2<RendererShaded>(getter,getter2,col_fill);
+            }
+            if (s.RenderLine) {
+                const ImU32 col_line = ImGui::GetColorU32(s.Colors[ImPlotCol_Line]);
+                if (ImHasFlag(flags,ImPlotLineFlags_Segments)) {
+                    RenderPrimitivesBatched<RendererLineSegments1>(getter,col_line,s.LineWeight);
+                }
+                else if (ImHasFlag(flags, ImPlotLineFlags_Loop)) {
+                    if (ImHasFlag(flags, ImPlotLineFlags_SkipNaN))
+                        RenderPrimitives1<RendererLineStripSkip>(GetterLoop<_Getter>(getter),col_line,s.LineWeight);
+                    else
+                        RenderPrimitives1<RendererLineStrip>(GetterLoop<_Getter>(getter),col_line,s.LineWeight);
+                }
+                else if (!ImHasFlag(flags, ImPlotLineFlags_LOD) || !RenderLineLOD(getter,col_line,s.LineWeight,ImHasFlag(flags, ImPlotLineFlags_SkipNaN))) {
+                    if (ImHasFlag(flags, ImPlotLineFlags_SkipNaN))
+                        RenderPrimitivesBatched<RendererLineStripSkip>(getter,col_line,s.LineWeight);
+                    else
+                        RenderPrimitivesBatched<RendererLineStrip>(getter,col_line,s.LineWeight);
+                }
+            }
+        }
+        // render markers
+        if (s.Marker != ImPlotMarker_None) {
+            if (ImHasFlag(flags, ImPlotLineFlags_NoClip)) {
+                PopPlotClipRect();
+                PushPlotClipRect(s.MarkerSize);
+            }
+            const ImU32 col_line = ImGui::GetColorU32(s.Colors[ImPlotCol_MarkerOutline]);
+            const ImU32 col_fill = ImGui::GetColorU32(s.Colors[ImPlotCol_MarkerFill]);
+            RenderMarkers<_Getter>(getter, s.Marker, s.MarkerSize, s.RenderMarkerFill, col_fill, s.RenderMarkerLine, col_line, s.MarkerWeight);
+        }
+        EndItem();
+    }
+}
+
+template <typename _Getter>
+void PlotLineEx(const char* label_id, const _Getter& getter, ImPlotLineFlags flags) {
+    PlotLineEx(label_id, getter, Fitter1<_Getter>(getter), flags);
+}
+
+template <typename T>
+void PlotLine(const char* label_id, const T* values, int count, double xscale, double x0, ImPlotLineFlags flags, int offset, int stride) {
+    GetterXY<IndexerLin,IndexerIdx<T>> getter(IndexerLin(xscale,x0),IndexerIdx<T>(values,count,offset,stride),count);
     PlotLineEx(label_id, getter, flags);
 }
 
@@ -1640,17 +2992,49 @@ void PlotLineG(const char* label_id, ImPlotGetter getter_func, void* data, int c
     PlotLineEx(label_id, getter, flags);
 }
 
+void PlotLine(const char* label_id, const ImPlotSeriesBuffer& buffer, ImPlotLineFlags flags) {
+    IM_ASSERT_USER_ERROR(GImPlot->CurrentPlot != nullptr, "PlotLine() needs to be called between BeginPlot() and EndPlot()!");
+    int first = 0, last = buffer.Size;
+    // LOD does its own culling against the whole series, and loops need every point
+    if (!ImHasFlag(flags, ImPlotLineFlags_LOD) && !ImHasFlag(flags, ImPlotLineFlags_Loop)) {
+        SetupLock();
+        // shading reaches down to y = 0, and markers reach around their point
+        const ImPlotNextItemData& next = GImPlot->NextItemData;
+        const ImPlotMarker marker = next.Marker == IMPLOT_AUTO ? GImPlot->Style.Marker : next.Marker;
+        const float marker_size = next.MarkerSize >= 0 ? next.MarkerSize : GImPlot->Style.MarkerSize;
+        const float pad = marker != ImPlotMarker_None ? marker_size + 1.0f : 0.0f;
+        GetSeriesVisibleRange(buffer, !ImHasFlag(flags, ImPlotLineFlags_Segments), ImHasFlag(flags, ImPlotLineFlags_Shaded), pad, &first, &last);
+        if (ImHasFlag(flags, ImPlotLineFlags_Segments)) {
+            first &= ~1;
+            if ((last - first) & 1)
+                last = ImMin(last + 1, buffer.Size);
+        }
+    }
+    GetterSeriesBuffer getter(buffer, first, last - first);
+    SetNextItemSeriesVersion(buffer);
+    PlotLineEx(label_id, getter, FitterSeriesBuffer(buffer), flags);
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] PlotScatter
 //-----------------------------------------------------------------------------
 
-template <typename Getter>
-void PlotScatterEx(const char* label_id, const Getter& getter, ImPlotScatterFlags flags) {
-    if (BeginItemEx(label_id, Fitter1<Getter>(getter), flags, ImPlotCol_MarkerOutline)) {
+// Draws ImPlotScatterFlags_Density, see [SECTION] Scatter Density
+template <typename _Getter>
+void RenderDensity(const _Getter& getter);
+
+template <typename Getter, typename Fitter>
+void PlotScatterEx(const char* label_id, const Getter& getter, const Fitter& fitter, ImPlotScatterFlags flags) {
+    if (BeginItemEx(label_id, fitter, flags, ImPlotCol_MarkerOutline)) {
         if (getter.Count <= 0) {
             EndItem();
             return;
         }
+        if (ImHasFlag(flags, ImPlotScatterFlags_Density)) {
+            RenderDensity(getter);
+            EndItem();
+            return;
+        }
         const ImPlotNextItemData& s = GetItemData();
         ImPlotMarker marker = s.Marker == ImPlotMarker_None ? ImPlotMarker_Circle: s.Marker;
         if (marker != ImPlotMarker_None) {
@@ -1666,6 +3050,11 @@ void PlotScatterEx(const char* label_id, const Getter& getter, ImPlotScatterFlag
     }
 }
 
+template <typename Getter>
+void PlotScatterEx(const char* label_id, const Getter& getter, ImPlotScatterFlags flags) {
+    PlotScatterEx(label_id, getter, Fitter1<Getter>(getter), flags);
+}
+
 template <typename T>
 void PlotScatter(const char* label_id, const T* values, int count, double xscale, double x0, ImPlotScatterFlags flags, int offset, int stride) {
     GetterXY<IndexerLin,IndexerIdx<T>> getter(IndexerLin(xscale,x0),IndexerIdx<T>(values,count,offset,stride),count);
@@ -1690,6 +3079,19 @@ void PlotScatterG(const char* label_id, ImPlotGetter getter_func, void* data, in
     return PlotScatterEx(label_id, getter, flags);
 }
 
+void PlotScatter(const char* label_id, const ImPlotSeriesBuffer& buffer, ImPlotScatterFlags flags) {
+    IM_ASSERT_USER_ERROR(GImPlot->CurrentPlot != nullptr, "PlotScatter() needs to be called between BeginPlot() and EndPlot()!");
+    int first = 0, last = 0;
+    SetupLock();
+    // markers are drawn around their point, keep the ones whose body reaches into the plot area
+    const ImPlotNextItemData& next = GImPlot->NextItemData;
+    const float marker_size = next.MarkerSize >= 0 ? next.MarkerSize : GImPlot->Style.MarkerSize;
+    GetSeriesVisibleRange(buffer, false, false, marker_size + 1.0f, &first, &last);
+    GetterSeriesBuffer getter(buffer, first, last - first);
+    SetNextItemSeriesVersion(buffer);
+    PlotScatterEx(label_id, getter, FitterSeriesBuffer(buffer), flags);
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] PlotStairs
 //-----------------------------------------------------------------------------
@@ -1706,16 +3108,16 @@ void PlotStairsEx(const char* label_id, const Getter& getter, ImPlotStairsFlags
             if (s.RenderFill && ImHasFlag(flags,ImPlotStairsFlags_Shaded)) {
                 const ImU32 col_fill = ImGui::GetColorU32(s.Colors[ImPlotCol_Fill]);
                 if (ImHasFlag(flags, ImPlotStairsFlags_PreStep))
-                    RenderPrimitives1<RendererStairsPreShaded>(getter,col_fill);
+                    RenderPrimitivesBatched<RendererStairsPreShaded>(getter,col_fill);
                 else
-                    RenderPrimitives1<RendererStairsPostShaded>(getter,col_fill);
+                    RenderPrimitivesBatched<RendererStairsPostShaded>(getter,col_fill);
             }
             if (s.RenderLine) {
                 const ImU32 col_line = ImGui::GetColorU32(s.Colors[ImPlotCol_Line]);
                 if (ImHasFlag(flags, ImPlotStairsFlags_PreStep))
-                    RenderPrimitives1<RendererStairsPre>(getter,col_line,s.LineWeight);
+                    RenderPrimitivesBatched<RendererStairsPre>(getter,col_line,s.LineWeight);
                 else
-                    RenderPrimitives1<RendererStairsPost>(getter,col_line,s.LineWeight);
+                    RenderPrimitivesBatched<RendererStairsPost>(getter,col_line,s.LineWeight);
             }
         }
         // render markers
@@ -2284,6 +3686,11 @@ void PlotPieChartEx(const char* const label_ids[], const T* values, int count, I
     const double sum         = PieChartSum(values, count, ignore_hidden);
     const bool normalize     = ImHasFlag(flags, ImPlotPieChartFlags_Normalize) || sum > 1.0;
 
+    // slices also depend on legend hover (exploding) and on which slices are shown (ignore hidden),
+    // neither of which is part of the item geometry key, so such charts are not cached
+    if (ImHasFlag(flags, ImPlotPieChartFlags_Exploding) || ignore_hidden)
+        GImPlot->NextItemData.HasDataVersion = false;
+
     double a0 = angle0 * 2 * IM_PI / 360.0;
     double a1 = angle0 * 2 * IM_PI / 360.0;
     ImPlotPoint Pmin = ImPlotPoint(center.x - radius, center.y - radius);
@@ -2446,82 +3853,364 @@ struct GetterHeatmapColMaj {
     const ImPlotPoint HalfSize;
 };
 
-template <typename T>
-void RenderHeatmap(ImDrawList& draw_list, const T* values, int rows, int cols, double scale_min, double scale_max, const char* fmt, const ImPlotPoint& bounds_min, const ImPlotPoint& bounds_max, bool reverse_y, bool col_maj) {
-    ImPlotContext& gp = *GImPlot;
-    Transformer2 transformer;
-    if (scale_min == 0 && scale_max == 0) {
-        T temp_min, temp_max;
-        ImMinMaxArray(values,rows*cols,&temp_min,&temp_max);
-        scale_min = (double)temp_min;
-        scale_max = (double)temp_max;
-    }
-    if (scale_min == scale_max) {
-        ImVec2 a = transformer(bounds_min);
-        ImVec2 b = transformer(bounds_max);
-        ImU32  col = GetColormapColorU32(0,gp.Style.Colormap);
-        draw_list.AddRectFilled(a, b, col);
-        return;
-    }
-    const double yref = reverse_y ? bounds_max.y : bounds_min.y;
-    const double ydir = reverse_y ? -1 : 1;
-    if (col_maj) {
-        GetterHeatmapColMaj<T> getter(values, rows, cols, scale_min, scale_max, (bounds_max.x - bounds_min.x) / cols, (bounds_max.y - bounds_min.y) / rows, bounds_min.x, yref, ydir);
-        RenderPrimitives1<RendererRectC>(getter);
-    }
-    else {
-        GetterHeatmapRowMaj<T> getter(values, rows, cols, scale_min, scale_max, (bounds_max.x - bounds_min.x) / cols, (bounds_max.y - bounds_min.y) / rows, bounds_min.x, yref, ydir);
-        RenderPrimitives1<RendererRectC>(getter);
-    }
-    // labels
-    if (fmt != nullptr) {
-        const double w = (bounds_max.x - bounds_min.x) / cols;
-        const double h = (bounds_max.y - bounds_min.y) / rows;
-        const ImPlotPoint half_size(w*0.5,h*0.5);
-        int i = 0;
-        if (col_maj) {
-            for (int c = 0; c < cols; ++c) {
-                for (int r = 0; r < rows; ++r) {
-                    ImPlotPoint p;
-                    p.x = bounds_min.x + 0.5*w + c*w;
-                    p.y = yref + ydir * (0.5*h + r*h);
-                    ImVec2 px = transformer(p);
-                    char buff[32];
-                    ImFormatString(buff, 32, fmt, values[i]);
-                    ImVec2 size = ImGui::CalcTextSize(buff);
-                    double t = ImClamp(ImRemap01((double)values[i], scale_min, scale_max),0.0,1.0);
-                    ImVec4 color = SampleColormap((float)t);
-                    ImU32 col = CalcTextColor(color);
-                    draw_list.AddText(px - size * 0.5f, col, buff);
-                    i++;
-                }
-            }
-        }
-        else {
-            for (int r = 0; r < rows; ++r) {
-                for (int c = 0; c < cols; ++c) {
-                    ImPlotPoint p;
-                    p.x = bounds_min.x + 0.5*w + c*w;
-                    p.y = yref + ydir * (0.5*h + r*h);
-                    ImVec2 px = transformer(p);
-                    char buff[32];
-                    ImFormatString(buff, 32, fmt, values[i]);
-                    ImVec2 size = ImGui::CalcTextSize(buff);
-                    double t = ImClamp(ImRemap01((double)values[i], scale_min, scale_max),0.0,1.0);
-                    ImVec4 color = SampleColormap((float)t);
-                    ImU32 col = CalcTextColor(color);
-                    draw_list.AddText(px - size * 0.5f, col, buff);
-                    i++;
-                }
-            }
-        }
+/// Colormap lookup of a heatmap, evaluated like GetterHeatmapRowMaj: t = ImRemap01 clamped to [0,1] in float,
+/// then an index into the colormap table of (siz - 1) * t + 0.5 (continuous) or siz * t (qualitative).
+struct HeatmapColormapCoefs {
+    HeatmapColormapCoefs(double scale_min, double scale_max, int table_size, bool qual) :
+        Min(scale_min),
+        Range(scale_max - scale_min),
+        Scale(qual ? (float)table_size : (float)(table_size - 1)),
+        Bias(qual ? 0.0f : 0.5f),
+        MaxIndex((float)(table_size - 1))
+    { }
+    double Min, Range;
+    float  Scale, Bias, MaxIndex;
+};
+
+// NaN values map to the first color
+static void HeatmapColormapBlock_Scalar(const double* vals, int count, const HeatmapColormapCoefs& c, int* out) {
+    for (int i = 0; i < count; ++i) {
+        float t = (float)((vals[i] - c.Min) / c.Range);
+        t = t > 0.0f ? (t < 1.0f ? t : 1.0f) : 0.0f;
+        out[i] = (int)ImMin(t * c.Scale + c.Bias, c.MaxIndex);
     }
 }
 
-template <typename T>
-void PlotHeatmap(const char* label_id, const T* values, int rows, int cols, double scale_min, double scale_max, const char* fmt, const ImPlotPoint& bounds_min, const ImPlotPoint& bounds_max, ImPlotHeatmapFlags flags) {
-    if (BeginItemEx(label_id, FitterRect(bounds_min, bounds_max))) {
-        if (rows <= 0 || cols <= 0) {
+#ifdef IMPLOT_ENABLE_SSE2
+
+static IMPLOT_INLINE __m128i HeatmapColormapIndices_SSE2(__m128 t, const HeatmapColormapCoefs& c) {
+    // _mm_max_ps returns its second operand if either one is NaN
+    t = _mm_min_ps(_mm_max_ps(t, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+    return _mm_cvttps_epi32(_mm_min_ps(_mm_add_ps(_mm_mul_ps(t, _mm_set1_ps(c.Scale)), _mm_set1_ps(c.Bias)), _mm_set1_ps(c.MaxIndex)));
+}
+
+static void HeatmapColormapBlock_SSE2(const double* vals, int count, const HeatmapColormapCoefs& c, int* out) {
+    const __m128d mn = _mm_set1_pd(c.Min);
+    const __m128d rg = _mm_set1_pd(c.Range);
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m128 lo = _mm_cvtpd_ps(_mm_div_pd(_mm_sub_pd(_mm_loadu_pd(vals + i), mn), rg));
+        const __m128 hi = _mm_cvtpd_ps(_mm_div_pd(_mm_sub_pd(_mm_loadu_pd(vals + i + 2), mn), rg));
+        _mm_storeu_si128((__m128i*)(out + i), HeatmapColormapIndices_SSE2(_mm_movelh_ps(lo, hi), c));
+    }
+    HeatmapColormapBlock_Scalar(vals + i, count - i, c, out + i);
+}
+
+static IMPLOT_TARGET_AVX2 void HeatmapColormapBlock_AVX2(const double* vals, int count, const HeatmapColormapCoefs& c, int* out) {
+    const __m256d mn = _mm256_set1_pd(c.Min);
+    const __m256d rg = _mm256_set1_pd(c.Range);
+    const __m256  zero = _mm256_setzero_ps();
+    const __m256  one = _mm256_set1_ps(1.0f);
+    const __m256  scale = _mm256_set1_ps(c.Scale);
+    const __m256  bias = _mm256_set1_ps(c.Bias);
+    const __m256  max_idx = _mm256_set1_ps(c.MaxIndex);
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m128 lo = _mm256_cvtpd_ps(_mm256_div_pd(_mm256_sub_pd(_mm256_loadu_pd(vals + i), mn), rg));
+        const __m128 hi = _mm256_cvtpd_ps(_mm256_div_pd(_mm256_sub_pd(_mm256_loadu_pd(vals + i + 4), mn), rg));
+        __m256 t = _mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1);
+        t = _mm256_min_ps(_mm256_max_ps(t, zero), one);
+        const __m256 f = _mm256_min_ps(_mm256_add_ps(_mm256_mul_ps(t, scale), bias), max_idx);
+        _mm256_storeu_si256((__m256i*)(out + i), _mm256_cvttps_epi32(f));
+    }
+    HeatmapColormapBlock_SSE2(vals + i, count - i, c, out + i);
+}
+
+#endif // IMPLOT_ENABLE_SSE2
+
+#ifdef IMPLOT_ENABLE_NEON
+
+static void HeatmapColormapBlock_NEON(const double* vals, int count, const HeatmapColormapCoefs& c, int* out) {
+    const float64x2_t mn = vdupq_n_f64(c.Min);
+    const float64x2_t rg = vdupq_n_f64(c.Range);
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const float32x2_t lo = vcvt_f32_f64(vdivq_f64(vsubq_f64(vld1q_f64(vals + i), mn), rg));
+        const float32x2_t hi = vcvt_f32_f64(vdivq_f64(vsubq_f64(vld1q_f64(vals + i + 2), mn), rg));
+        // vmaxnmq returns the number if one operand is NaN
+        float32x4_t t = vminq_f32(vmaxnmq_f32(vcombine_f32(lo, hi), vdupq_n_f32(0.0f)), vdupq_n_f32(1.0f));
+        t = vminq_f32(vaddq_f32(vmulq_f32(t, vdupq_n_f32(c.Scale)), vdupq_n_f32(c.Bias)), vdupq_n_f32(c.MaxIndex));
+        vst1q_s32(out + i, vcvtq_s32_f32(t));
+    }
+    HeatmapColormapBlock_Scalar(vals + i, count - i, c, out + i);
+}
+
+#endif // IMPLOT_ENABLE_NEON
+
+typedef void (*HeatmapColormapBlockFunc)(const double* vals, int count, const HeatmapColormapCoefs& c, int* out);
+
+static HeatmapColormapBlockFunc GetHeatmapColormapBlockFunc(ImPlotSimd simd) {
+    switch (simd) {
+#ifdef IMPLOT_ENABLE_SSE2
+        case ImPlotSimd_AVX2: return HeatmapColormapBlock_AVX2;
+        case ImPlotSimd_SSE2: return HeatmapColormapBlock_SSE2;
+#endif
+#ifdef IMPLOT_ENABLE_NEON
+        case ImPlotSimd_NEON: return HeatmapColormapBlock_NEON;
+#endif
+        default:              return HeatmapColormapBlock_Scalar;
+    }
+}
+
+/// Color maps the texture rows [first, last) of a heatmap image. Pixel (x, y) shows the value at
+/// RowOffsets[y] + ColOffsets[x].
+template <typename T>
+struct HeatmapTextureTask {
+    const T*                 Values;
+    const int*               ColOffsets;
+    const int*               RowOffsets;
+    const ImU32*             Table;
+    HeatmapColormapBlockFunc Colormap;
+    const HeatmapColormapCoefs* Coefs;
+    ImU32*                   Pixels;
+    int                      Width, Height, Pitch, Tasks;
+
+    void Render(int first, int last) const {
+        double vals[IMPLOT_TRANSFORM_BLOCK];
+        int    idx[IMPLOT_TRANSFORM_BLOCK];
+        for (int y = first; y < last; ++y) {
+            ImU32* out = Pixels + (size_t)y * Pitch;
+            // rows showing the same cells as the row above are copied
+            if (y > first && RowOffsets[y] == RowOffsets[y - 1]) {
+                memcpy(out, out - Pitch, (size_t)Width * sizeof(ImU32));
+                continue;
+            }
+            const T* row = Values + RowOffsets[y];
+            for (int x = 0; x < Width; x += IMPLOT_TRANSFORM_BLOCK) {
+                const int n = ImMin(IMPLOT_TRANSFORM_BLOCK, Width - x);
+                for (int k = 0; k < n; ++k)
+                    vals[k] = (double)row[ColOffsets[x + k]];
+                Colormap(vals, n, *Coefs, idx);
+                for (int k = 0; k < n; ++k)
+                    out[x + k] = Table[idx[k]];
+            }
+        }
+    }
+
+    static void Run(int task, void* data) {
+        const HeatmapTextureTask& t = *(const HeatmapTextureTask*)data;
+        t.Render(t.Height * task / t.Tasks, t.Height * (task + 1) / t.Tasks);
+    }
+};
+
+// Frees the textures of heatmaps that are no longer plotted, and those released during an earlier frame. A texture
+// is kept while the cached geometry of its item (see SetNextItemDataVersion) still replays it.
+static void GcHeatmapTextures(int frame) {
+    ImPlotContext& gp = *GImPlot;
+    for (int i = 0; i < gp.ReleasedTextures.Size; ) {
+        if (gp.ReleasedTextures[i].LastFrame < frame) {
+            gp.DestroyTexture(gp.ReleasedTextures[i].TexID, gp.TextureUserData);
+            gp.ReleasedTextures.erase(gp.ReleasedTextures.Data + i);
+        }
+        else {
+            ++i;
+        }
+    }
+    for (int n = 0; n < gp.HeatmapTextures.GetMapSize(); ++n) {
+        ImPlotHeatmapTexture* tex = gp.HeatmapTextures.TryGetMapData(n);
+        if (tex == nullptr)
+            continue;
+        int last_frame = tex->LastFrame;
+        const ImPlotItemGeometry* geom = gp.ItemGeometries.GetByKey(tex->ID);
+        if (geom != nullptr && geom->Valid)
+            last_frame = ImMax(last_frame, geom->LastFrame);
+        if (frame - last_frame > IMPLOT_HEATMAP_TEXTURE_GC_FRAMES) {
+            if (tex->TexID != 0)
+                gp.DestroyTexture(tex->TexID, gp.TextureUserData);
+            gp.HeatmapTextures.Remove(tex->ID, tex);
+        }
+    }
+}
+
+// Draws a heatmap as one textured quad covering the pixels whose centers lie inside both the heatmap and the plot
+// area. The texture has one texel per pixel, so each texel is sampled at its center and the result matches the quads
+// of RendererRectC for any filtering. Cell (r, c) spans [xref + c*width, +width] and [yref + r*height, +height], with
+// #height negative for rows drawn downwards. Returns false if the caller should draw quads instead.
+template <typename T>
+bool RenderHeatmapTexture(ImDrawList& draw_list, const T* values, int rows, int cols, double scale_min, double scale_max, double xref, double width, double yref, double height, bool col_maj) {
+    ImPlotContext& gp = *GImPlot;
+    if (gp.CreateTexture == nullptr || (ImS64)rows * cols < IMPLOT_HEATMAP_TEXTURE_MIN_CELLS)
+        return false;
+    ImPlotPlot& plot = *gp.CurrentPlot;
+    const ImPlotAxis& x_axis = plot.Axes[plot.CurrentX];
+    const ImPlotAxis& y_axis = plot.Axes[plot.CurrentY];
+    const int frame = ImGui::GetFrameCount();
+    const ImGuiID id = ImHashData(&plot.ID, sizeof(ImGuiID), gp.CurrentItem->ID);
+    ImPlotHeatmapTexture& tex = *gp.HeatmapTextures.GetOrAddByKey(id);
+    // textures are rewritten right away, a second heatmap with the same ID this frame would overwrite the first
+    if (tex.TexID != 0 && tex.LastFrame == frame)
+        return false;
+    tex.ID        = id;
+    tex.LastFrame = frame;
+
+    // the texture spans the plot area so that panning and zooming do not resize it
+    const ImRect& plot_rect = plot.PlotRect;
+    const int tex_w = (int)ImCeil(plot_rect.GetWidth());
+    const int tex_h = (int)ImCeil(plot_rect.GetHeight());
+    const float hx0 = x_axis.PlotToPixels(xref), hx1 = x_axis.PlotToPixels(xref + width * cols);
+    const float hy0 = y_axis.PlotToPixels(yref), hy1 = y_axis.PlotToPixels(yref + height * rows);
+    const float x0 = ImFloor(ImMax(ImMin(hx0, hx1), plot_rect.Min.x) + 0.5f);
+    const float y0 = ImFloor(ImMax(ImMin(hy0, hy1), plot_rect.Min.y) + 0.5f);
+    const int img_w = ImMin((int)(ImFloor(ImMin(ImMax(hx0, hx1), plot_rect.Max.x) + 0.5f) - x0), tex_w);
+    const int img_h = ImMin((int)(ImFloor(ImMin(ImMax(hy0, hy1), plot_rect.Max.y) + 0.5f) - y0), tex_h);
+    if (img_w <= 0 || img_h <= 0)
+        return true;
+
+    // value offset of the cell under the center of each pixel column and row
+    gp.HeatmapOffsets.resize(img_w + img_h);
+    int* col_offsets = gp.HeatmapOffsets.Data;
+    int* row_offsets = col_offsets + img_w;
+    const int col_stride = col_maj ? rows : 1;
+    const int row_stride = col_maj ? 1 : cols;
+    for (int x = 0; x < img_w; ++x) {
+        const double c = floor((x_axis.PixelsToPlot(x0 + x + 0.5f) - xref) / width);
+        col_offsets[x] = (int)ImClamp(c, 0.0, (double)(cols - 1)) * col_stride;
+    }
+    for (int y = 0; y < img_h; ++y) {
+        const double r = floor((y_axis.PixelsToPlot(y0 + y + 0.5f) - yref) / height);
+        row_offsets[y] = (int)ImClamp(r, 0.0, (double)(rows - 1)) * row_stride;
+    }
+
+    const ImPlotColormap cmap = gp.Style.Colormap;
+    const HeatmapColormapCoefs coefs(scale_min, scale_max, gp.ColormapData.TableSizes[cmap], gp.ColormapData.Quals[cmap]);
+    GetHeatmapPixels(gp, tex_w * tex_h);
+    HeatmapTextureTask<T> data;
+    data.Values     = values;
+    data.ColOffsets = col_offsets;
+    data.RowOffsets = row_offsets;
+    data.Table      = gp.ColormapData.Tables.Data + gp.ColormapData.TableOffsets[cmap];
+    data.Colormap   = GetHeatmapColormapBlockFunc(gp.TransformSimd);
+    data.Coefs      = &coefs;
+    data.Pixels     = gp.HeatmapPixels.Data;
+    data.Width      = img_w;
+    data.Height     = img_h;
+    data.Pitch      = tex_w;
+    const int pixels = img_w * img_h;
+    data.Tasks      = gp.ParallelFor != nullptr && pixels >= IMPLOT_PARALLEL_MIN_PRIMS ? ImMin(ImMin(gp.ParallelMaxTasks, pixels / IMPLOT_PARALLEL_MIN_CHUNK), img_h) : 1;
+    if (data.Tasks > 1)
+        gp.ParallelFor(data.Tasks, &HeatmapTextureTask<T>::Run, &data, gp.ParallelForUserData);
+    else
+        data.Render(0, img_h);
+
+    if (tex.TexID != 0 && (tex.Width != tex_w || tex.Height != tex_h)) {
+        gp.DestroyTexture(tex.TexID, gp.TextureUserData);
+        tex.TexID = 0;
+    }
+    if (tex.TexID == 0) {
+        tex.TexID  = gp.CreateTexture(gp.HeatmapPixels.Data, tex_w, tex_h, gp.TextureUserData);
+        tex.Width  = tex_w;
+        tex.Height = tex_h;
+        if (tex.TexID == 0)
+            return false;
+    }
+    else {
+        gp.UpdateTexture(tex.TexID, gp.HeatmapPixels.Data, tex_w, tex_h, gp.TextureUserData);
+    }
+    draw_list.AddImage(tex.TexID, ImVec2(x0, y0), ImVec2(x0 + img_w, y0 + img_h), ImVec2(0, 0), ImVec2((float)img_w / tex_w, (float)img_h / tex_h));
+    return true;
+}
+
+// Visible cells [first, last] of one heatmap axis, empty if last < first.
+static void GetHeatmapVisibleCells(const ImPlotAxis& axis, double ref, double size, int count, int* first, int* last) {
+    double a = (axis.Range.Min - ref) / size;
+    double b = (axis.Range.Max - ref) / size;
+    if (a > b)
+        ImSwap(a, b);
+    *first = (int)floor(ImClamp(a, -1.0, (double)count));
+    *last  = (int)floor(ImClamp(b, -1.0, (double)count));
+    *first = ImMax(*first, 0);
+    *last  = ImMin(*last, count - 1);
+}
+
+// Labels the visible cells that are large enough to hold their text. Cells narrower or shorter than one glyph are
+// skipped before anything is formatted, so heatmaps of many small cells cost no more than their readable part.
+template <typename T>
+void RenderHeatmapLabels(ImDrawList& draw_list, const T* values, int rows, int cols, double scale_min, double scale_max, const char* fmt, double xref, double width, double yref, double height, bool col_maj) {
+    ImPlotContext& gp = *GImPlot;
+    ImPlotPlot& plot = *gp.CurrentPlot;
+    const ImPlotAxis& x_axis = plot.Axes[plot.CurrentX];
+    const ImPlotAxis& y_axis = plot.Axes[plot.CurrentY];
+    const ImVec2 glyph = ImGui::CalcTextSize("0");
+    int c_first, c_last, r_first, r_last;
+    GetHeatmapVisibleCells(x_axis, xref, width, cols, &c_first, &c_last);
+    GetHeatmapVisibleCells(y_axis, yref, height, rows, &r_first, &r_last);
+    ImVector<int>& readable = gp.HeatmapOffsets;
+    readable.resize(0);
+    for (int c = c_first; c <= c_last; ++c) {
+        if (ImAbs(x_axis.PlotToPixels(xref + (c + 1) * width) - x_axis.PlotToPixels(xref + c * width)) >= glyph.x)
+            readable.push_back(c);
+    }
+    const int readable_cols = readable.Size;
+    for (int r = r_first; r <= r_last; ++r) {
+        if (ImAbs(y_axis.PlotToPixels(yref + (r + 1) * height) - y_axis.PlotToPixels(yref + r * height)) >= glyph.y)
+            readable.push_back(r);
+    }
+    const int readable_rows = readable.Size - readable_cols;
+    if (readable_cols == 0 || readable_rows == 0)
+        return;
+    const int outer_count = col_maj ? readable_cols : readable_rows;
+    const int inner_count = col_maj ? readable_rows : readable_cols;
+    for (int o = 0; o < outer_count; ++o) {
+        for (int in = 0; in < inner_count; ++in) {
+            const int r = readable[readable_cols + (col_maj ? in : o)];
+            const int c = readable[col_maj ? o : in];
+            const int i = col_maj ? c * rows + r : r * cols + c;
+            char buff[32];
+            ImFormatString(buff, 32, fmt, values[i]);
+            const ImVec2 size = ImGui::CalcTextSize(buff);
+            const float cell_w = ImAbs(x_axis.PlotToPixels(xref + (c + 1) * width) - x_axis.PlotToPixels(xref + c * width));
+            const float cell_h = ImAbs(y_axis.PlotToPixels(yref + (r + 1) * height) - y_axis.PlotToPixels(yref + r * height));
+            if (size.x > cell_w || size.y > cell_h)
+                continue;
+            const ImVec2 px(x_axis.PlotToPixels(xref + (c + 0.5) * width), y_axis.PlotToPixels(yref + (r + 0.5) * height));
+            const double t = ImClamp(ImRemap01((double)values[i], scale_min, scale_max),0.0,1.0);
+            ImVec4 color = SampleColormap((float)t);
+            ImU32 col = CalcTextColor(color);
+            draw_list.AddText(px - size * 0.5f, col, buff);
+        }
+    }
+}
+
+template <typename T>
+void RenderHeatmap(ImDrawList& draw_list, const T* values, int rows, int cols, double scale_min, double scale_max, const char* fmt, const ImPlotPoint& bounds_min, const ImPlotPoint& bounds_max, bool reverse_y, bool col_maj) {
+    ImPlotContext& gp = *GImPlot;
+    Transformer2 transformer;
+    if (scale_min == 0 && scale_max == 0) {
+        T temp_min, temp_max;
+        ImMinMaxArray(values,rows*cols,&temp_min,&temp_max);
+        scale_min = (double)temp_min;
+        scale_max = (double)temp_max;
+    }
+    if (scale_min == scale_max) {
+        ImVec2 a = transformer(bounds_min);
+        ImVec2 b = transformer(bounds_max);
+        ImU32  col = GetColormapColorU32(0,gp.Style.Colormap);
+        draw_list.AddRectFilled(a, b, col);
+        return;
+    }
+    const double yref = reverse_y ? bounds_max.y : bounds_min.y;
+    const double ydir = reverse_y ? -1 : 1;
+    const double w = (bounds_max.x - bounds_min.x) / cols;
+    const double h = (bounds_max.y - bounds_min.y) / rows;
+    if (!RenderHeatmapTexture(draw_list, values, rows, cols, scale_min, scale_max, bounds_min.x, w, yref, ydir * h, col_maj)) {
+        if (col_maj) {
+            GetterHeatmapColMaj<T> getter(values, rows, cols, scale_min, scale_max, w, h, bounds_min.x, yref, ydir);
+            RenderPrimitives1<RendererRectC>(getter);
+        }
+        else {
+            GetterHeatmapRowMaj<T> getter(values, rows, cols, scale_min, scale_max, w, h, bounds_min.x, yref, ydir);
+            RenderPrimitives1<RendererRectC>(getter);
+        }
+    }
+    // labels
+    if (fmt != nullptr)
+        RenderHeatmapLabels(draw_list, values, rows, cols, scale_min, scale_max, fmt, bounds_min.x, w, yref, ydir * h, col_maj);
+}
+
+template <typename T>
+void PlotHeatmap(const char* label_id, const T* values, int rows, int cols, double scale_min, double scale_max, const char* fmt, const ImPlotPoint& bounds_min, const ImPlotPoint& bounds_max, ImPlotHeatmapFlags flags) {
+    if (BeginItemEx(label_id, FitterRect(bounds_min, bounds_max))) {
+        if (rows <= 0 || cols <= 0) {
             EndItem();
             return;
         }
@@ -2536,86 +4225,1176 @@ CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 #undef INSTANTIATE_MACRO
 
 //-----------------------------------------------------------------------------
-// [SECTION] PlotHistogram
+// [SECTION] PlotHeatmapPyramid
 //-----------------------------------------------------------------------------
 
-template <typename T>
-double PlotHistogram(const char* label_id, const T* values, int count, int bins, double bar_scale, ImPlotRange range, ImPlotHistogramFlags flags) {
+/// Reduces rows [first, last) of a pyramid level from the 2x2 blocks of the level below. On the last row or column
+/// of an odd sized level a block repeats its values, which leaves the mean, min and max of the others unchanged.
+template <typename S>
+struct HeatmapReduceTask {
+    const S*           Src;
+    size_t             RowStride, ColStride;
+    int                SrcRows, SrcCols;
+    float*             Dst;
+    int                DstRows, DstCols;
+    ImPlotHeatmapFlags Flags;
+    int                Tasks;
+
+    void Reduce(int first, int last) const {
+        for (int r = first; r < last; ++r) {
+            const S* row0 = Src + (size_t)(2 * r) * RowStride;
+            const S* row1 = Src + (size_t)ImMin(2 * r + 1, SrcRows - 1) * RowStride;
+            float* out = Dst + (size_t)r * DstCols;
+            for (int c = 0; c < DstCols; ++c) {
+                const size_t c0 = (size_t)(2 * c) * ColStride;
+                const size_t c1 = (size_t)ImMin(2 * c + 1, SrcCols - 1) * ColStride;
+                const double a = (double)row0[c0], b = (double)row0[c1], d = (double)row1[c0], e = (double)row1[c1];
+                if (ImHasFlag(Flags, ImPlotHeatmapFlags_Min))
+                    out[c] = (float)ImMin(ImMin(a, b), ImMin(d, e));
+                else if (ImHasFlag(Flags, ImPlotHeatmapFlags_Max))
+                    out[c] = (float)ImMax(ImMax(a, b), ImMax(d, e));
+                else
+                    out[c] = (float)((a + b + d + e) * 0.25);
+            }
+        }
+    }
 
-    const bool cumulative = ImHasFlag(flags, ImPlotHistogramFlags_Cumulative);
-    const bool density    = ImHasFlag(flags, ImPlotHistogramFlags_Density);
-    const bool outliers   = !ImHasFlag(flags, ImPlotHistogramFlags_NoOutliers);
+    static void Run(int task, void* data) {
+        const HeatmapReduceTask& t = *(const HeatmapReduceTask*)data;
+        t.Reduce(t.DstRows * task / t.Tasks, t.DstRows * (task + 1) / t.Tasks);
+    }
+};
 
-    if (count <= 0 || bins == 0)
-        return 0;
+template <typename S>
+static void ReduceHeatmapLevel(const S* src, size_t row_stride, size_t col_stride, int src_rows, int src_cols, float* dst, int dst_rows, int dst_cols, ImPlotHeatmapFlags flags) {
+    ImPlotContext& gp = *GImPlot;
+    HeatmapReduceTask<S> data;
+    data.Src       = src;
+    data.RowStride = row_stride;
+    data.ColStride = col_stride;
+    data.SrcRows   = src_rows;
+    data.SrcCols   = src_cols;
+    data.Dst       = dst;
+    data.DstRows   = dst_rows;
+    data.DstCols   = dst_cols;
+    data.Flags     = flags;
+    const ImS64 cells = (ImS64)dst_rows * dst_cols;
+    data.Tasks     = gp.ParallelFor != nullptr && cells >= IMPLOT_PARALLEL_MIN_PRIMS ? (int)ImMin((ImS64)ImMin(gp.ParallelMaxTasks, dst_rows), cells / IMPLOT_PARALLEL_MIN_CHUNK) : 1;
+    if (data.Tasks > 1)
+        gp.ParallelFor(data.Tasks, &HeatmapReduceTask<S>::Run, &data, gp.ParallelForUserData);
+    else
+        data.Reduce(0, dst_rows);
+}
 
-    if (range.Min == 0 && range.Max == 0) {
-        T Min, Max;
-        ImMinMaxArray(values, count, &Min, &Max);
-        range.Min = (double)Min;
-        range.Max = (double)Max;
+// Builds the levels of #pyr above the data until one tile covers the whole level.
+template <typename T>
+static void BuildHeatmapPyramid(ImPlotHeatmapPyramid& pyr, const T* values, int rows, int cols, ImPlotHeatmapFlags flags) {
+    ImPlotContext& gp = *GImPlot;
+    const ImPlotNextItemData& s = gp.NextItemData;
+    pyr.Values         = values;
+    pyr.Rows           = rows;
+    pyr.Cols           = cols;
+    pyr.Flags          = flags;
+    pyr.HasDataVersion = s.HasDataVersion;
+    pyr.DataVersion    = s.DataVersion;
+    pyr.Generation     = ++gp.HeatmapGeneration;
+    T value_min, value_max;
+    ImMinMaxArray(values, rows * cols, &value_min, &value_max);
+    pyr.ValueMin = (double)value_min;
+    pyr.ValueMax = (double)value_max;
+    pyr.LevelRows[0] = rows;
+    pyr.LevelCols[0] = cols;
+    const bool col_maj = ImHasFlag(flags, ImPlotHeatmapFlags_ColMajor);
+    int level = 1;
+    for (; level < IMPLOT_HEATMAP_MAX_LEVELS && ImMax(pyr.LevelRows[level - 1], pyr.LevelCols[level - 1]) > IMPLOT_HEATMAP_TILE_SIZE; ++level) {
+        const int src_rows = pyr.LevelRows[level - 1];
+        const int src_cols = pyr.LevelCols[level - 1];
+        const int dst_rows = (src_rows + 1) / 2;
+        const int dst_cols = (src_cols + 1) / 2;
+        pyr.LevelRows[level] = dst_rows;
+        pyr.LevelCols[level] = dst_cols;
+        pyr.Levels[level].resize(dst_rows * dst_cols);
+        if (level == 1)
+            ReduceHeatmapLevel(values, col_maj ? 1 : cols, col_maj ? rows : 1, src_rows, src_cols, pyr.Levels[1].Data, dst_rows, dst_cols, flags);
+        else
+            ReduceHeatmapLevel(pyr.Levels[level - 1].Data, src_cols, 1, src_rows, src_cols, pyr.Levels[level].Data, dst_rows, dst_cols, flags);
+    }
+    pyr.LevelCount = level;
+    for (; level < IMPLOT_HEATMAP_MAX_LEVELS; ++level)
+        pyr.Levels[level].clear();
+}
+
+/// Color maps the tiles [first, last) of one pyramid level. Tile t sits at row Tiles[2t] and column Tiles[2t+1] in
+/// tile units, and its pixels start at Pixels + t * IMPLOT_HEATMAP_TILE_SIZE^2. Texels past the last row or column
+/// of the level repeat it, so filtering along the visible edge of a partial tile picks up no foreign color.
+template <typename S>
+struct HeatmapTileTask {
+    const S*                    Src;
+    size_t                      RowStride, ColStride;
+    int                         Rows, Cols;
+    const int*                  Tiles;
+    int                         Count;
+    const ImU32*                Table;
+    HeatmapColormapBlockFunc    Colormap;
+    const HeatmapColormapCoefs* Coefs;
+    ImU32*                      Pixels;
+    int                         Tasks;
+
+    void Render(int first, int last) const {
+        const int ts = IMPLOT_HEATMAP_TILE_SIZE;
+        double vals[IMPLOT_HEATMAP_TILE_SIZE];
+        int    idx[IMPLOT_HEATMAP_TILE_SIZE];
+        size_t col_offsets[IMPLOT_HEATMAP_TILE_SIZE];
+        for (int t = first; t < last; ++t) {
+            const int r0 = Tiles[2 * t] * ts;
+            const int c0 = Tiles[2 * t + 1] * ts;
+            for (int x = 0; x < ts; ++x)
+                col_offsets[x] = (size_t)ImMin(c0 + x, Cols - 1) * ColStride;
+            ImU32* out = Pixels + (size_t)t * ts * ts;
+            for (int y = 0; y < ts; ++y, out += ts) {
+                if (y > 0 && r0 + y >= Rows) {
+                    memcpy(out, out - ts, ts * sizeof(ImU32));
+                    continue;
+                }
+                const S* row = Src + (size_t)(r0 + y) * RowStride;
+                for (int x = 0; x < ts; ++x)
+                    vals[x] = (double)row[col_offsets[x]];
+                Colormap(vals, ts, *Coefs, idx);
+                for (int x = 0; x < ts; ++x)
+                    out[x] = Table[idx[x]];
+            }
+        }
+    }
+
+    static void Run(int task, void* data) {
+        const HeatmapTileTask& t = *(const HeatmapTileTask*)data;
+        t.Render(t.Count * task / t.Tasks, t.Count * (task + 1) / t.Tasks);
     }
+};
 
-    double width;
-    if (bins < 0)
-        CalculateBins(values, count, bins, range, bins, width);
+template <typename S>
+static void ColormapHeatmapTiles(const S* src, size_t row_stride, size_t col_stride, int rows, int cols, const int* tiles, int count, const HeatmapColormapCoefs& coefs, ImU32* pixels) {
+    ImPlotContext& gp = *GImPlot;
+    const ImPlotColormap cmap = gp.Style.Colormap;
+    HeatmapTileTask<S> data;
+    data.Src       = src;
+    data.RowStride = row_stride;
+    data.ColStride = col_stride;
+    data.Rows      = rows;
+    data.Cols      = cols;
+    data.Tiles     = tiles;
+    data.Count     = count;
+    data.Table     = gp.ColormapData.Tables.Data + gp.ColormapData.TableOffsets[cmap];
+    data.Colormap  = GetHeatmapColormapBlockFunc(gp.TransformSimd);
+    data.Coefs     = &coefs;
+    data.Pixels    = pixels;
+    data.Tasks     = gp.ParallelFor != nullptr ? ImMin(gp.ParallelMaxTasks, count) : 1;
+    if (data.Tasks > 1)
+        gp.ParallelFor(data.Tasks, &HeatmapTileTask<S>::Run, &data, gp.ParallelForUserData);
     else
-        width = range.Size() / bins;
+        data.Render(0, count);
+}
+
+// Hands a tile texture back to the backend once the current frame is over.
+static void ReleaseHeatmapTile(ImPlotContext& gp, ImPlotHeatmapTile* tile, int frame) {
+    ImPlotHeatmapTexture released;
+    released.TexID     = tile->TexID;
+    released.LastFrame = frame;
+    gp.ReleasedTextures.push_back(released);
+    gp.HeatmapTiles.Remove(tile->ID, tile);
+}
+
+// Releases the tiles of previous builds of a pyramid, their keys hold an old generation and are never looked up again.
+static void ReleaseHeatmapPyramidTiles(ImPlotContext& gp, ImGuiID pyr_id, int frame) {
+    for (int n = 0; n < gp.HeatmapTiles.GetMapSize(); ++n) {
+        ImPlotHeatmapTile* tile = gp.HeatmapTiles.TryGetMapData(n);
+        if (tile != nullptr && tile->ItemID == pyr_id)
+            ReleaseHeatmapTile(gp, tile, frame);
+    }
+}
+
+// Returns the last frame a tile was drawn, either directly or by the cached geometry of its heatmap.
+static int GetHeatmapTileLastFrame(ImPlotContext& gp, const ImPlotHeatmapTile& tile) {
+    const ImPlotItemGeometry* geom = gp.ItemGeometries.GetByKey(tile.ItemID);
+    return geom != nullptr && geom->Valid ? ImMax(tile.LastFrame, geom->LastFrame) : tile.LastFrame;
+}
+
+// Returns the least recently drawn tile that was not drawn this frame, or nullptr.
+static ImPlotHeatmapTile* FindHeatmapTileLRU(ImPlotContext& gp, int frame) {
+    ImPlotHeatmapTile* lru = nullptr;
+    int lru_frame = frame;
+    for (int n = 0; n < gp.HeatmapTiles.GetMapSize(); ++n) {
+        ImPlotHeatmapTile* tile = gp.HeatmapTiles.TryGetMapData(n);
+        if (tile == nullptr)
+            continue;
+        const int last_frame = GetHeatmapTileLastFrame(gp, *tile);
+        if (last_frame < lru_frame) {
+            lru       = tile;
+            lru_frame = last_frame;
+        }
+    }
+    return lru;
+}
 
+// Frees the pyramids of heatmaps that are no longer plotted, tiles that were not drawn for as long, and tiles beyond
+// the cache size that a frame with more visible tiles than IMPLOT_HEATMAP_TILE_CACHE left behind.
+static void GcHeatmapPyramids(int frame) {
     ImPlotContext& gp = *GImPlot;
-    ImVector<double>& bin_centers = gp.TempDouble1;
-    ImVector<double>& bin_counts  = gp.TempDouble2;
-    bin_centers.resize(bins);
-    bin_counts.resize(bins);
-    int below = 0;
+    for (int n = 0; n < gp.HeatmapPyramids.GetMapSize(); ++n) {
+        ImPlotHeatmapPyramid* pyr = gp.HeatmapPyramids.TryGetMapData(n);
+        if (pyr != nullptr && frame - pyr->LastFrame > IMPLOT_HEATMAP_TEXTURE_GC_FRAMES)
+            gp.HeatmapPyramids.Remove(pyr->ID, pyr);
+    }
+    for (int n = 0; n < gp.HeatmapTiles.GetMapSize(); ++n) {
+        ImPlotHeatmapTile* tile = gp.HeatmapTiles.TryGetMapData(n);
+        if (tile != nullptr && frame - GetHeatmapTileLastFrame(gp, *tile) > IMPLOT_HEATMAP_TEXTURE_GC_FRAMES)
+            ReleaseHeatmapTile(gp, tile, frame);
+    }
+    while (gp.HeatmapTiles.GetAliveCount() > IMPLOT_HEATMAP_TILE_CACHE) {
+        ImPlotHeatmapTile* lru = FindHeatmapTileLRU(gp, frame);
+        if (lru == nullptr)
+            break;
+        ReleaseHeatmapTile(gp, lru, frame);
+    }
+}
 
-    for (int b = 0; b < bins; ++b) {
-        bin_centers[b] = range.Min + b * width + width * 0.5;
-        bin_counts[b] = 0;
+// Frees the bins of histograms that are no longer computed.
+static void GcHistograms(int frame) {
+    ImPlotContext& gp = *GImPlot;
+    for (int n = 0; n < gp.Histograms.GetMapSize(); ++n) {
+        ImPlotHistogram* hist = gp.Histograms.TryGetMapData(n);
+        if (hist != nullptr && frame - hist->LastFrame > IMPLOT_HISTOGRAM_GC_FRAMES)
+            gp.Histograms.Remove(hist->ID, hist);
     }
-    int counted = 0;
-    double max_count = 0;
+}
+
+void GcItemCaches() {
+    ImPlotContext& gp = *GImPlot;
+    const int frame = ImGui::GetFrameCount();
+    if (gp.ItemCacheGcFrame == frame)
+        return;
+    gp.ItemCacheGcFrame = frame;
+    GcItemGeometries(frame);
+    GcLineLODs(frame);
+    GcHeatmapTextures(frame);
+    GcHeatmapPyramids(frame);
+    GcHistograms(frame);
+    // give back scratch pixels that no frame of the last GC period needed, e.g. after one very large image
+    if (frame - gp.HeatmapPixelsTrimFrame > IMPLOT_HEATMAP_TEXTURE_GC_FRAMES) {
+        if (gp.HeatmapPixels.Capacity > gp.HeatmapPixelsPeak) {
+            ImVector<ImU32> trimmed;
+            trimmed.reserve(gp.HeatmapPixelsPeak);
+            gp.HeatmapPixels.swap(trimmed);
+        }
+        gp.HeatmapPixelsPeak      = 0;
+        gp.HeatmapPixelsTrimFrame = frame;
+    }
+}
+
+static ImGuiID GetHeatmapTileID(const ImPlotHeatmapPyramid& pyr, int level, int tile_row, int tile_col, ImPlotColormap cmap, double scale_min, double scale_max) {
+    const int    key[5]   = { (int)pyr.Generation, level, tile_row, tile_col, cmap };
+    const double scale[2] = { scale_min, scale_max };
+    return ImHashData(key, sizeof(key), ImHashData(scale, sizeof(scale)));
+}
+
+// Draws the visible cells of a pyramid level as quads through RenderHeatmap when there is no texture backend.
+template <typename T>
+void RenderHeatmapPyramidQuads(ImDrawList& draw_list, const ImPlotHeatmapPyramid& pyr, const T* values, int level, int lr_first, int lr_last, int lc_first, int lc_last, double scale_min, double scale_max, const ImPlotPoint& bounds_min, const ImPlotPoint& bounds_max) {
+    ImPlotContext& gp = *GImPlot;
+    const int rows = lr_last - lr_first + 1;
+    const int cols = lc_last - lc_first + 1;
+    ImVector<double>& crop = gp.TempDouble1;
+    crop.resize(rows * cols);
+    const bool col_maj = ImHasFlag(pyr.Flags, ImPlotHeatmapFlags_ColMajor);
+    for (int r = 0; r < rows; ++r) {
+        for (int c = 0; c < cols; ++c) {
+            const int lr = lr_first + r, lc = lc_first + c;
+            if (level == 0)
+                crop[r * cols + c] = (double)values[col_maj ? (size_t)lc * pyr.Rows + lr : (size_t)lr * pyr.Cols + lc];
+            else
+                crop[r * cols + c] = (double)pyr.Levels[level][(size_t)lr * pyr.LevelCols[level] + lc];
+        }
+    }
+    const double w = (bounds_max.x - bounds_min.x) / pyr.Cols;
+    const double h = (bounds_max.y - bounds_min.y) / pyr.Rows;
+    const ImPlotPoint crop_min(bounds_min.x + (lc_first << level) * w, bounds_max.y - ImMin((lr_last + 1) << level, pyr.Rows) * h);
+    const ImPlotPoint crop_max(bounds_min.x + ImMin((lc_last + 1) << level, pyr.Cols) * w, bounds_max.y - (lr_first << level) * h);
+    RenderHeatmap(draw_list, crop.Data, rows, cols, scale_min, scale_max, nullptr, crop_min, crop_max, true, false);
+}
+
+template <typename T>
+void RenderHeatmapPyramid(ImDrawList& draw_list, const T* values, int rows, int cols, double scale_min, double scale_max, const ImPlotPoint& bounds_min, const ImPlotPoint& bounds_max, ImPlotHeatmapFlags flags) {
+    ImPlotContext& gp = *GImPlot;
+    ImPlotPlot& plot = *gp.CurrentPlot;
+    const ImPlotAxis& x_axis = plot.Axes[plot.CurrentX];
+    const ImPlotAxis& y_axis = plot.Axes[plot.CurrentY];
+    const int frame = ImGui::GetFrameCount();
+    const ImGuiID id = ImHashData(&plot.ID, sizeof(ImGuiID), gp.CurrentItem->ID);
+    ImPlotHeatmapPyramid& pyr = *gp.HeatmapPyramids.GetOrAddByKey(id);
+    pyr.ID        = id;
+    pyr.LastFrame = frame;
+    const ImPlotHeatmapFlags pyr_flags = flags & (ImPlotHeatmapFlags_ColMajor | ImPlotHeatmapFlags_Min | ImPlotHeatmapFlags_Max);
+    const ImPlotNextItemData& s = gp.NextItemData;
+    // without a data version the values may have changed in place, so the pyramid is rebuilt on every call
+    if (pyr.LevelCount == 0 || !s.HasDataVersion || pyr.Values != values || pyr.Rows != rows || pyr.Cols != cols || pyr.Flags != pyr_flags || pyr.HasDataVersion != s.HasDataVersion || pyr.DataVersion != s.DataVersion) {
+        ReleaseHeatmapPyramidTiles(gp, pyr.ID, frame);
+        BuildHeatmapPyramid(pyr, values, rows, cols, pyr_flags);
+    }
+    if (scale_min == 0 && scale_max == 0) {
+        scale_min = pyr.ValueMin;
+        scale_max = pyr.ValueMax;
+    }
+    Transformer2 transformer;
+    if (scale_min == scale_max) {
+        draw_list.AddRectFilled(transformer(bounds_min), transformer(bounds_max), GetColormapColorU32(0, gp.Style.Colormap));
+        return;
+    }
+
+    // visible cells of the data, rows counted downwards from bounds_max.y like PlotHeatmap
+    const double w = (bounds_max.x - bounds_min.x) / cols;
+    const double h = (bounds_max.y - bounds_min.y) / rows;
+    int c_first, c_last, r_first, r_last;
+    GetHeatmapVisibleCells(x_axis, bounds_min.x, w, cols, &c_first, &c_last);
+    GetHeatmapVisibleCells(y_axis, bounds_max.y, -h, rows, &r_first, &r_last);
+    if (c_last < c_first || r_last < r_first)
+        return;
+
+    // coarsest level that still has at most one cell per pixel along both axes, so min/max extremes stay visible
+    const float px_w = ImMin(ImAbs(x_axis.PlotToPixels(bounds_min.x + (c_last + 1) * w) - x_axis.PlotToPixels(bounds_min.x + c_first * w)), plot.PlotRect.GetWidth());
+    const float px_h = ImMin(ImAbs(y_axis.PlotToPixels(bounds_max.y - (r_last + 1) * h) - y_axis.PlotToPixels(bounds_max.y - r_first * h)), plot.PlotRect.GetHeight());
+    const double density = ImMax((c_last - c_first + 1) / (double)ImMax(px_w, 1.0f), (r_last - r_first + 1) / (double)ImMax(px_h, 1.0f));
+    int level = 0;
+    while (level + 1 < pyr.LevelCount && (double)(1 << level) < density)
+        level++;
+    const int lc_first = c_first >> level, lc_last = c_last >> level;
+    const int lr_first = r_first >> level, lr_last = r_last >> level;
+    if (gp.CreateTexture == nullptr) {
+        RenderHeatmapPyramidQuads(draw_list, pyr, values, level, lr_first, lr_last, lc_first, lc_last, scale_min, scale_max, bounds_min, bounds_max);
+        return;
+    }
+
+    // color map the visible tiles that are not cached yet
+    const int ts = IMPLOT_HEATMAP_TILE_SIZE;
+    const ImPlotColormap cmap = gp.Style.Colormap;
+    const int tc_first = lc_first / ts, tc_last = lc_last / ts;
+    const int tr_first = lr_first / ts, tr_last = lr_last / ts;
+    ImVector<int>& missing = gp.HeatmapOffsets;
+    missing.resize(0);
+    for (int tr = tr_first; tr <= tr_last; ++tr) {
+        for (int tc = tc_first; tc <= tc_last; ++tc) {
+            ImPlotHeatmapTile* tile = gp.HeatmapTiles.GetByKey(GetHeatmapTileID(pyr, level, tr, tc, cmap, scale_min, scale_max));
+            if (tile != nullptr) {
+                tile->LastFrame = frame;
+            }
+            else {
+                missing.push_back(tr);
+                missing.push_back(tc);
+            }
+        }
+    }
+    const int missing_count = missing.Size / 2;
+    if (missing_count > 0) {
+        const HeatmapColormapCoefs coefs(scale_min, scale_max, gp.ColormapData.TableSizes[cmap], gp.ColormapData.Quals[cmap]);
+        GetHeatmapPixels(gp, missing_count * ts * ts);
+        if (level == 0) {
+            const bool col_maj = ImHasFlag(pyr.Flags, ImPlotHeatmapFlags_ColMajor);
+            ColormapHeatmapTiles(values, col_maj ? 1 : cols, col_maj ? rows : 1, rows, cols, missing.Data, missing_count, coefs, gp.HeatmapPixels.Data);
+        }
+        else {
+            ColormapHeatmapTiles(pyr.Levels[level].Data, pyr.LevelCols[level], 1, pyr.LevelRows[level], pyr.LevelCols[level], missing.Data, missing_count, coefs, gp.HeatmapPixels.Data);
+        }
+        for (int i = 0; i < missing_count; ++i) {
+            const ImU32* pixels = gp.HeatmapPixels.Data + (size_t)i * ts * ts;
+            // a full cache recycles the texture of the least recently drawn tile
+            ImTextureID tex_id = 0;
+            ImPlotHeatmapTile* lru = gp.HeatmapTiles.GetAliveCount() >= IMPLOT_HEATMAP_TILE_CACHE ? FindHeatmapTileLRU(gp, frame) : nullptr;
+            if (lru != nullptr) {
+                tex_id = lru->TexID;
+                gp.HeatmapTiles.Remove(lru->ID, lru);
+                gp.UpdateTexture(tex_id, pixels, ts, ts, gp.TextureUserData);
+            }
+            else {
+                tex_id = gp.CreateTexture(pixels, ts, ts, gp.TextureUserData);
+                if (tex_id == 0)
+                    continue;
+            }
+            const ImGuiID tile_id = GetHeatmapTileID(pyr, level, missing[2 * i], missing[2 * i + 1], cmap, scale_min, scale_max);
+            ImPlotHeatmapTile& tile = *gp.HeatmapTiles.GetOrAddByKey(tile_id);
+            tile.ID        = tile_id;
+            tile.TexID     = tex_id;
+            tile.ItemID    = pyr.ID;
+            tile.LastFrame = frame;
+        }
+    }
+
+    // one quad per tile, split into strips along non-linear axes so that cells follow the axis transform
+    const int x_steps = x_axis.TransformForward == nullptr ? 1 : ts / 16;
+    const int y_steps = y_axis.TransformForward == nullptr ? 1 : ts / 16;
+    for (int tr = tr_first; tr <= tr_last; ++tr) {
+        for (int tc = tc_first; tc <= tc_last; ++tc) {
+            const ImPlotHeatmapTile* tile = gp.HeatmapTiles.GetByKey(GetHeatmapTileID(pyr, level, tr, tc, cmap, scale_min, scale_max));
+            if (tile == nullptr)
+                continue;
+            // cells of the data under the tile, the last cell of a level may cover fewer than 2^level of them
+            const int dc0 = (tc * ts) << level, dc1 = ImMin((tc * ts + ts) << level, cols);
+            const int dr0 = (tr * ts) << level, dr1 = ImMin((tr * ts + ts) << level, rows);
+            const float u_max = (float)(((double)dc1 / (1 << level) - tc * ts) / ts);
+            const float v_max = (float)(((double)dr1 / (1 << level) - tr * ts) / ts);
+            for (int sy = 0; sy < y_steps; ++sy) {
+                const double fy0 = (double)sy / y_steps, fy1 = (double)(sy + 1) / y_steps;
+                const double py0 = bounds_max.y - (dr0 + (dr1 - dr0) * fy0) * h;
+                const double py1 = bounds_max.y - (dr0 + (dr1 - dr0) * fy1) * h;
+                for (int sx = 0; sx < x_steps; ++sx) {
+                    const double fx0 = (double)sx / x_steps, fx1 = (double)(sx + 1) / x_steps;
+                    const double px0 = bounds_min.x + (dc0 + (dc1 - dc0) * fx0) * w;
+                    const double px1 = bounds_min.x + (dc0 + (dc1 - dc0) * fx1) * w;
+                    draw_list.AddImage(tile->TexID, transformer(px0, py0), transformer(px1, py1), ImVec2(u_max * (float)fx0, v_max * (float)fy0), ImVec2(u_max * (float)fx1, v_max * (float)fy1));
+                }
+            }
+        }
+    }
+}
+
+template <typename T>
+void PlotHeatmapPyramid(const char* label_id, const T* values, int rows, int cols, double scale_min, double scale_max, const ImPlotPoint& bounds_min, const ImPlotPoint& bounds_max, ImPlotHeatmapFlags flags) {
+    // no geometry caching (BeginItemEx): tiles stay in the LRU cache only while they are drawn
+    if (BeginItem(label_id, flags)) {
+        ImPlotPlot& plot = *GetCurrentPlot();
+        if (plot.FitThisFrame && !ImHasFlag(flags, ImPlotItemFlags_NoFit))
+            FitterRect(bounds_min, bounds_max).Fit(plot.Axes[plot.CurrentX], plot.Axes[plot.CurrentY]);
+        if (rows > 0 && cols > 0)
+            RenderHeatmapPyramid(*GetPlotDrawList(), values, rows, cols, scale_min, scale_max, bounds_min, bounds_max, flags);
+        EndItem();
+    }
+}
+#define INSTANTIATE_MACRO(T) template IMPLOT_API void PlotHeatmapPyramid<T>(const char* label_id, const T* values, int rows, int cols, double scale_min, double scale_max, const ImPlotPoint& bounds_min, const ImPlotPoint& bounds_max, ImPlotHeatmapFlags flags);
+CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
+#undef INSTANTIATE_MACRO
+
+//-----------------------------------------------------------------------------
+// [SECTION] Scatter Density
+//-----------------------------------------------------------------------------
+
+/// Counts the points [first, last) of a getter on the pixels of a density image, converting them to pixels one block
+/// at a time like TransformGetter. Pixel (x, y) covers [X0 + x, X0 + x + 1) and [Y0 + y, Y0 + y + 1), and each task
+/// counts into its own grid of Width * Height counts.
+template <typename _Getter>
+struct DensityCountTask {
+    const _Getter*      Getter;
+    const Transformer2* Transformer;
+    ImU32*              Counts;
+    float               X0, Y0;
+    int                 Width, Height, Tasks;
+
+    void Count(int first, int last, ImU32* counts) const {
+        double xs[IMPLOT_TRANSFORM_BLOCK], ys[IMPLOT_TRANSFORM_BLOCK];
+        ImVec2 px[IMPLOT_TRANSFORM_BLOCK];
+        const float x1 = X0 + Width, y1 = Y0 + Height;
+        for (int i = first; i < last; i += IMPLOT_TRANSFORM_BLOCK) {
+            const int n = ImMin(IMPLOT_TRANSFORM_BLOCK, last - i);
+            for (int k = 0; k < n; ++k) {
+                const ImPlotPoint p = (*Getter)(i + k);
+                xs[k] = p.x;
+                ys[k] = p.y;
+            }
+            TransformBlock(*Transformer, xs, ys, n, px);
+            // NaN fails every comparison
+            for (int k = 0; k < n; ++k) {
+                if (px[k].x >= X0 && px[k].y >= Y0 && px[k].x < x1 && px[k].y < y1)
+                    counts[(int)(px[k].y - Y0) * Width + (int)(px[k].x - X0)]++;
+            }
+        }
+    }
+
+    static void Run(int task, void* data) {
+        const DensityCountTask& t = *(const DensityCountTask*)data;
+        const int first = (int)((ImS64)t.Getter->Count * task / t.Tasks);
+        const int last  = (int)((ImS64)t.Getter->Count * (task + 1) / t.Tasks);
+        t.Count(first, last, t.Counts + (size_t)task * t.Width * t.Height);
+    }
+};
+
+/// Adds the grids of all count tasks into the first one for the rows [first, last), and finds their largest count.
+struct DensityMergeTask {
+    ImU32* Counts;
+    ImU32* MaxCounts;
+    int    Width, Height, Grids, Tasks;
+
+    static void Run(int task, void* data) {
+        const DensityMergeTask& t = *(const DensityMergeTask*)data;
+        const size_t pixels = (size_t)t.Width * t.Height;
+        const size_t first = (size_t)(t.Height * task / t.Tasks) * t.Width;
+        const size_t last  = (size_t)(t.Height * (task + 1) / t.Tasks) * t.Width;
+        ImU32 max_count = 0;
+        for (size_t i = first; i < last; ++i) {
+            ImU32 count = t.Counts[i];
+            for (int g = 1; g < t.Grids; ++g)
+                count += t.Counts[g * pixels + i];
+            t.Counts[i] = count;
+            max_count = ImMax(max_count, count);
+        }
+        t.MaxCounts[task] = max_count;
+    }
+};
+
+/// Color maps the rows [first, last) of a density image, log(count) spanning the colormap from 0 to log(MaxCount).
+/// Empty pixels stay transparent.
+struct DensityImageTask {
+    const ImU32*                Counts;
+    const ImU32*                Table;
+    HeatmapColormapBlockFunc    Colormap;
+    const HeatmapColormapCoefs* Coefs;
+    const double*               Logs;       // log of the counts below IMPLOT_TRANSFORM_BLOCK
+    ImU32*                      Pixels;
+    int                         Width, Height, Tasks;
+
+    static void Run(int task, void* data) {
+        const DensityImageTask& t = *(const DensityImageTask*)data;
+        double vals[IMPLOT_TRANSFORM_BLOCK];
+        int    idx[IMPLOT_TRANSFORM_BLOCK];
+        const size_t first = (size_t)(t.Height * task / t.Tasks) * t.Width;
+        const size_t last  = (size_t)(t.Height * (task + 1) / t.Tasks) * t.Width;
+        for (size_t i = first; i < last; i += IMPLOT_TRANSFORM_BLOCK) {
+            const int n = (int)ImMin((size_t)IMPLOT_TRANSFORM_BLOCK, last - i);
+            for (int k = 0; k < n; ++k) {
+                const ImU32 count = t.Counts[i + k];
+                vals[k] = count < IMPLOT_TRANSFORM_BLOCK ? t.Logs[count] : log((double)count);
+            }
+            t.Colormap(vals, n, *t.Coefs, idx);
+            for (int k = 0; k < n; ++k)
+                t.Pixels[i + k] = t.Counts[i + k] != 0 ? t.Table[idx[k]] : 0;
+        }
+    }
+};
+
+// Draws a density image as runs of quads, for when there is no texture backend.
+static void RenderDensityQuads(ImDrawList& draw_list, const ImU32* pixels, float x0, float y0, int w, int h) {
+    for (int y = 0; y < h; ++y) {
+        const ImU32* row = pixels + (size_t)y * w;
+        for (int x = 0; x < w; ) {
+            const ImU32 col = row[x];
+            int end = x + 1;
+            while (end < w && row[end] == col)
+                ++end;
+            if (col != 0)
+                draw_list.AddRectFilled(ImVec2(x0 + x, y0 + y), ImVec2(x0 + end, y0 + y + 1), col);
+            x = end;
+        }
+    }
+}
+
+template <typename _Getter>
+void RenderDensity(const _Getter& getter) {
+    ImPlotContext& gp = *GImPlot;
+    ImPlotPlot& plot = *gp.CurrentPlot;
+    ImDrawList& draw_list = *GetPlotDrawList();
+    const ImRect& plot_rect = plot.PlotRect;
+    const float x0 = ImFloor(plot_rect.Min.x + 0.5f);
+    const float y0 = ImFloor(plot_rect.Min.y + 0.5f);
+    const int w = (int)(ImFloor(plot_rect.Max.x + 0.5f) - x0);
+    const int h = (int)(ImFloor(plot_rect.Max.y + 0.5f) - y0);
+    if (w <= 0 || h <= 0)
+        return;
+    const size_t pixels = (size_t)w * h;
+
+    // count the points per pixel, each task into its own grid, as many grids as fit in IMPLOT_DENSITY_GRID_BUDGET
+    const int max_grids = (int)ImClamp(IMPLOT_DENSITY_GRID_BUDGET / (pixels * sizeof(ImU32)), (size_t)1, (size_t)INT_MAX);
+    const int count_tasks = gp.ParallelFor != nullptr && getter.Count >= IMPLOT_PARALLEL_MIN_PRIMS ? ImMin(ImMin(gp.ParallelMaxTasks, getter.Count / IMPLOT_PARALLEL_MIN_CHUNK), max_grids) : 1;
+    const size_t cells = pixels * count_tasks;
+    IM_ASSERT(cells <= (size_t)INT_MAX / sizeof(ImU32) && "Density grid too large");
+    gp.DensityCounts.resize((int)cells);
+    memset(gp.DensityCounts.Data, 0, cells * sizeof(ImU32));
+    const Transformer2 transformer;
+    DensityCountTask<_Getter> counter;
+    counter.Getter      = &getter;
+    counter.Transformer = &transformer;
+    counter.Counts      = gp.DensityCounts.Data;
+    counter.X0          = x0;
+    counter.Y0          = y0;
+    counter.Width       = w;
+    counter.Height      = h;
+    counter.Tasks       = count_tasks;
+    if (count_tasks > 1)
+        gp.ParallelFor(count_tasks, &DensityCountTask<_Getter>::Run, &counter, gp.ParallelForUserData);
+    else
+        counter.Count(0, getter.Count, counter.Counts);
+
+    // merge the grids, then color map them, both split by rows
+    const int tasks = gp.ParallelFor != nullptr && pixels >= IMPLOT_PARALLEL_MIN_PRIMS ? ImMin(ImMin(gp.ParallelMaxTasks, (int)(pixels / IMPLOT_PARALLEL_MIN_CHUNK)), h) : 1;
+    gp.DensityTaskMax.resize(tasks);
+    DensityMergeTask merger;
+    merger.Counts    = gp.DensityCounts.Data;
+    merger.MaxCounts = gp.DensityTaskMax.Data;
+    merger.Width     = w;
+    merger.Height    = h;
+    merger.Grids     = count_tasks;
+    merger.Tasks     = tasks;
+    if (tasks > 1)
+        gp.ParallelFor(tasks, &DensityMergeTask::Run, &merger, gp.ParallelForUserData);
+    else
+        DensityMergeTask::Run(0, &merger);
+    ImU32 max_count = 0;
+    for (int i = 0; i < tasks; ++i)
+        max_count = ImMax(max_count, gp.DensityTaskMax[i]);
+    if (max_count == 0)
+        return;
+
+    double logs[IMPLOT_TRANSFORM_BLOCK];
+    logs[0] = 0;
+    for (int i = 1; i < IMPLOT_TRANSFORM_BLOCK; ++i)
+        logs[i] = log((double)i);
+    const ImPlotColormap cmap = gp.Style.Colormap;
+    const HeatmapColormapCoefs coefs(0.0, max_count > 1 ? log((double)max_count) : 1.0, gp.ColormapData.TableSizes[cmap], gp.ColormapData.Quals[cmap]);
+    GetHeatmapPixels(gp, (int)pixels);
+    DensityImageTask image;
+    image.Counts   = gp.DensityCounts.Data;
+    image.Table    = gp.ColormapData.Tables.Data + gp.ColormapData.TableOffsets[cmap];
+    image.Colormap = GetHeatmapColormapBlockFunc(gp.TransformSimd);
+    image.Coefs    = &coefs;
+    image.Logs     = logs;
+    image.Pixels   = gp.HeatmapPixels.Data;
+    image.Width    = w;
+    image.Height   = h;
+    image.Tasks    = tasks;
+    if (tasks > 1)
+        gp.ParallelFor(tasks, &DensityImageTask::Run, &image, gp.ParallelForUserData);
+    else
+        DensityImageTask::Run(0, &image);
+
+    // the image is one texel per pixel of the plot area, kept with the heatmap textures
+    if (gp.CreateTexture != nullptr) {
+        const int frame = ImGui::GetFrameCount();
+        const ImGuiID id = ImHashData(&plot.ID, sizeof(ImGuiID), gp.CurrentItem->ID);
+        ImPlotHeatmapTexture& tex = *gp.HeatmapTextures.GetOrAddByKey(id);
+        // a second item with the same ID this frame would overwrite the texture of the first
+        if (tex.TexID == 0 || tex.LastFrame != frame) {
+            tex.ID        = id;
+            tex.LastFrame = frame;
+            if (tex.TexID != 0 && (tex.Width != w || tex.Height != h)) {
+                gp.DestroyTexture(tex.TexID, gp.TextureUserData);
+                tex.TexID = 0;
+            }
+            if (tex.TexID == 0) {
+                tex.TexID  = gp.CreateTexture(gp.HeatmapPixels.Data, w, h, gp.TextureUserData);
+                tex.Width  = w;
+                tex.Height = h;
+            }
+            else {
+                gp.UpdateTexture(tex.TexID, gp.HeatmapPixels.Data, w, h, gp.TextureUserData);
+            }
+            if (tex.TexID != 0) {
+                draw_list.AddImage(tex.TexID, ImVec2(x0, y0), ImVec2(x0 + w, y0 + h));
+                return;
+            }
+        }
+    }
+    RenderDensityQuads(draw_list, gp.HeatmapPixels.Data, x0, y0, w, h);
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] PlotHistogram
+//-----------------------------------------------------------------------------
+
+/// Bin index along one axis of a histogram, evaluated like PlotHistogram always did: values in [Min, Max] fall into
+/// bin (int)((v - Min) / Width) clamped to [0, Bins - 1], values below Min map to -1, values above Max and NaN to Bins.
+struct HistogramBinCoefs {
+    HistogramBinCoefs(const ImPlotRange& range, double width, int bins) :
+        Min(range.Min),
+        Max(range.Max),
+        Width(width),
+        Last((double)(bins - 1)),
+        Bins(bins)
+    { }
+    double Min, Max, Width, Last;
+    int    Bins;
+};
+
+// A Width of 0 (all values equal) puts every value into the first bin
+static void HistogramBinBlock_Scalar(const double* vals, int count, const HistogramBinCoefs& c, int* out) {
     for (int i = 0; i < count; ++i) {
-        double val = (double)values[i];
-        if (range.Contains(val)) {
-            const int b = ImClamp((int)((val - range.Min) / width), 0, bins - 1);
-            bin_counts[b] += 1.0;
-            if (bin_counts[b] > max_count)
-                max_count = bin_counts[b];
-            counted++;
+        const double v = vals[i];
+        if (v >= c.Min && v <= c.Max) {
+            const double t = (v - c.Min) / c.Width;
+            out[i] = t > 0 ? (int)ImMin(t, c.Last) : 0;
         }
-        else if (val < range.Min) {
-            below++;
+        else {
+            out[i] = v < c.Min ? -1 : c.Bins;
         }
     }
-    if (cumulative && density) {
-        if (outliers)
-            bin_counts[0] += below;
-        for (int b = 1; b < bins; ++b)
-            bin_counts[b] += bin_counts[b-1];
-        double scale = 1.0 / (outliers ? count : counted);
-        for (int b = 0; b < bins; ++b)
-            bin_counts[b] *= scale;
-        max_count = bin_counts[bins-1];
-    }
-    else if (cumulative) {
+}
+
+#ifdef IMPLOT_ENABLE_SSE2
+
+static IMPLOT_INLINE __m128i HistogramBinIndices_SSE2(__m128d v, const HistogramBinCoefs& c) {
+    const __m128d mn = _mm_set1_pd(c.Min);
+    // _mm_max_pd returns its second operand if either one is NaN
+    const __m128d t = _mm_min_pd(_mm_max_pd(_mm_div_pd(_mm_sub_pd(v, mn), _mm_set1_pd(c.Width)), _mm_setzero_pd()), _mm_set1_pd(c.Last));
+    const __m128d inside = _mm_and_pd(_mm_cmpge_pd(v, mn), _mm_cmple_pd(v, _mm_set1_pd(c.Max)));
+    const __m128d below = _mm_cmplt_pd(v, mn);
+    const __m128d outside = _mm_or_pd(_mm_and_pd(below, _mm_set1_pd(-1.0)), _mm_andnot_pd(below, _mm_set1_pd((double)c.Bins)));
+    return _mm_cvttpd_epi32(_mm_or_pd(_mm_and_pd(inside, t), _mm_andnot_pd(inside, outside)));
+}
+
+static void HistogramBinBlock_SSE2(const double* vals, int count, const HistogramBinCoefs& c, int* out) {
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m128i lo = HistogramBinIndices_SSE2(_mm_loadu_pd(vals + i), c);
+        const __m128i hi = HistogramBinIndices_SSE2(_mm_loadu_pd(vals + i + 2), c);
+        _mm_storeu_si128((__m128i*)(out + i), _mm_unpacklo_epi64(lo, hi));
+    }
+    HistogramBinBlock_Scalar(vals + i, count - i, c, out + i);
+}
+
+static IMPLOT_TARGET_AVX2 void HistogramBinBlock_AVX2(const double* vals, int count, const HistogramBinCoefs& c, int* out) {
+    const __m256d mn = _mm256_set1_pd(c.Min);
+    const __m256d mx = _mm256_set1_pd(c.Max);
+    const __m256d w = _mm256_set1_pd(c.Width);
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d last = _mm256_set1_pd(c.Last);
+    const __m256d under = _mm256_set1_pd(-1.0);
+    const __m256d over = _mm256_set1_pd((double)c.Bins);
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m256d v = _mm256_loadu_pd(vals + i);
+        const __m256d t = _mm256_min_pd(_mm256_max_pd(_mm256_div_pd(_mm256_sub_pd(v, mn), w), zero), last);
+        const __m256d inside = _mm256_and_pd(_mm256_cmp_pd(v, mn, _CMP_GE_OQ), _mm256_cmp_pd(v, mx, _CMP_LE_OQ));
+        const __m256d outside = _mm256_blendv_pd(over, under, _mm256_cmp_pd(v, mn, _CMP_LT_OQ));
+        _mm_storeu_si128((__m128i*)(out + i), _mm256_cvttpd_epi32(_mm256_blendv_pd(outside, t, inside)));
+    }
+    HistogramBinBlock_Scalar(vals + i, count - i, c, out + i);
+}
+
+#endif // IMPLOT_ENABLE_SSE2
+
+#ifdef IMPLOT_ENABLE_NEON
+
+static IMPLOT_INLINE int32x2_t HistogramBinIndices_NEON(float64x2_t v, const HistogramBinCoefs& c) {
+    const float64x2_t mn = vdupq_n_f64(c.Min);
+    // vmaxnmq returns the number if one operand is NaN
+    const float64x2_t t = vminq_f64(vmaxnmq_f64(vdivq_f64(vsubq_f64(v, mn), vdupq_n_f64(c.Width)), vdupq_n_f64(0.0)), vdupq_n_f64(c.Last));
+    const uint64x2_t inside = vandq_u64(vcgeq_f64(v, mn), vcleq_f64(v, vdupq_n_f64(c.Max)));
+    const float64x2_t outside = vbslq_f64(vcltq_f64(v, mn), vdupq_n_f64(-1.0), vdupq_n_f64((double)c.Bins));
+    return vmovn_s64(vcvtq_s64_f64(vbslq_f64(inside, t, outside)));
+}
+
+static void HistogramBinBlock_NEON(const double* vals, int count, const HistogramBinCoefs& c, int* out) {
+    int i = 0;
+    for (; i + 4 <= count; i += 4)
+        vst1q_s32(out + i, vcombine_s32(HistogramBinIndices_NEON(vld1q_f64(vals + i), c), HistogramBinIndices_NEON(vld1q_f64(vals + i + 2), c)));
+    HistogramBinBlock_Scalar(vals + i, count - i, c, out + i);
+}
+
+#endif // IMPLOT_ENABLE_NEON
+
+typedef void (*HistogramBinBlockFunc)(const double* vals, int count, const HistogramBinCoefs& c, int* out);
+
+static HistogramBinBlockFunc GetHistogramBinBlockFunc(ImPlotSimd simd) {
+    switch (simd) {
+#ifdef IMPLOT_ENABLE_SSE2
+        case ImPlotSimd_AVX2: return HistogramBinBlock_AVX2;
+        case ImPlotSimd_SSE2: return HistogramBinBlock_SSE2;
+#endif
+#ifdef IMPLOT_ENABLE_NEON
+        case ImPlotSimd_NEON: return HistogramBinBlock_NEON;
+#endif
+        default:              return HistogramBinBlock_Scalar;
+    }
+}
+
+// Lowers #mn and raises #mx to the smallest and largest value of a block, skipping NaN values
+static void HistogramMinMaxBlock_Scalar(const double* vals, int count, double* mn, double* mx) {
+    double lo = *mn, hi = *mx;
+    for (int i = 0; i < count; ++i) {
+        lo = vals[i] < lo ? vals[i] : lo;
+        hi = vals[i] > hi ? vals[i] : hi;
+    }
+    *mn = lo;
+    *mx = hi;
+}
+
+#ifdef IMPLOT_ENABLE_SSE2
+
+static void HistogramMinMaxBlock_SSE2(const double* vals, int count, double* mn, double* mx) {
+    // _mm_min_pd and _mm_max_pd return their second operand if either one is NaN
+    __m128d lo = _mm_set1_pd(*mn), hi = _mm_set1_pd(*mx);
+    int i = 0;
+    for (; i + 2 <= count; i += 2) {
+        const __m128d v = _mm_loadu_pd(vals + i);
+        lo = _mm_min_pd(v, lo);
+        hi = _mm_max_pd(v, hi);
+    }
+    lo = _mm_min_pd(lo, _mm_unpackhi_pd(lo, lo));
+    hi = _mm_max_pd(hi, _mm_unpackhi_pd(hi, hi));
+    *mn = _mm_cvtsd_f64(lo);
+    *mx = _mm_cvtsd_f64(hi);
+    HistogramMinMaxBlock_Scalar(vals + i, count - i, mn, mx);
+}
+
+static IMPLOT_TARGET_AVX2 void HistogramMinMaxBlock_AVX2(const double* vals, int count, double* mn, double* mx) {
+    __m256d lo = _mm256_set1_pd(*mn), hi = _mm256_set1_pd(*mx);
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m256d v = _mm256_loadu_pd(vals + i);
+        lo = _mm256_min_pd(v, lo);
+        hi = _mm256_max_pd(v, hi);
+    }
+    __m128d lo2 = _mm_min_pd(_mm256_castpd256_pd128(lo), _mm256_extractf128_pd(lo, 1));
+    __m128d hi2 = _mm_max_pd(_mm256_castpd256_pd128(hi), _mm256_extractf128_pd(hi, 1));
+    lo2 = _mm_min_pd(lo2, _mm_unpackhi_pd(lo2, lo2));
+    hi2 = _mm_max_pd(hi2, _mm_unpackhi_pd(hi2, hi2));
+    *mn = _mm_cvtsd_f64(lo2);
+    *mx = _mm_cvtsd_f64(hi2);
+    HistogramMinMaxBlock_Scalar(vals + i, count - i, mn, mx);
+}
+
+#endif // IMPLOT_ENABLE_SSE2
+
+#ifdef IMPLOT_ENABLE_NEON
+
+static void HistogramMinMaxBlock_NEON(const double* vals, int count, double* mn, double* mx) {
+    // vminnmq and vmaxnmq return the number if one operand is NaN
+    float64x2_t lo = vdupq_n_f64(*mn), hi = vdupq_n_f64(*mx);
+    int i = 0;
+    for (; i + 2 <= count; i += 2) {
+        const float64x2_t v = vld1q_f64(vals + i);
+        lo = vminnmq_f64(lo, v);
+        hi = vmaxnmq_f64(hi, v);
+    }
+    *mn = vminnmvq_f64(lo);
+    *mx = vmaxnmvq_f64(hi);
+    HistogramMinMaxBlock_Scalar(vals + i, count - i, mn, mx);
+}
+
+#endif // IMPLOT_ENABLE_NEON
+
+typedef void (*HistogramMinMaxBlockFunc)(const double* vals, int count, double* mn, double* mx);
+
+static HistogramMinMaxBlockFunc GetHistogramMinMaxBlockFunc(ImPlotSimd simd) {
+    switch (simd) {
+#ifdef IMPLOT_ENABLE_SSE2
+        case ImPlotSimd_AVX2: return HistogramMinMaxBlock_AVX2;
+        case ImPlotSimd_SSE2: return HistogramMinMaxBlock_SSE2;
+#endif
+#ifdef IMPLOT_ENABLE_NEON
+        case ImPlotSimd_NEON: return HistogramMinMaxBlock_NEON;
+#endif
+        default:              return HistogramMinMaxBlock_Scalar;
+    }
+}
+
+// Returns #count values starting at #values as doubles, converted into #buf unless they already are.
+template <typename T>
+static IMPLOT_INLINE const double* GetHistogramBlock(const T* values, int count, double* buf) {
+    for (int k = 0; k < count; ++k)
+        buf[k] = (double)values[k];
+    return buf;
+}
+static IMPLOT_INLINE const double* GetHistogramBlock(const double* values, int, double*) {
+    return values;
+}
+
+/// Computes the ImPlotHistogramStats of the values in [first, last) of one or two arrays. The sums are only computed
+/// for ImPlotBin_Scott, relative to the first value of each array so that the sum of squares stays accurate.
+/// Like ImStdDev, a NaN value makes the sums NaN.
+template <typename T>
+struct HistogramStatsTask {
+    const T*                 Values[2];
+    double                   Shift[2];
+    HistogramMinMaxBlockFunc MinMaxBlock;
+    int                      Arrays, Count, Tasks;
+    bool                     Sums;
+    ImPlotHistogramStats*    Stats;      // Arrays per task
+
+    void Compute(ImPlotHistogramStats* out, int first, int last) const {
+        double buf[IMPLOT_TRANSFORM_BLOCK];
+        for (int a = 0; a < Arrays; ++a) {
+            double mn = HUGE_VAL, mx = -HUGE_VAL, sum = 0, sum_sq = 0;
+            for (int i = first; i < last; i += IMPLOT_TRANSFORM_BLOCK) {
+                const int n = ImMin(IMPLOT_TRANSFORM_BLOCK, last - i);
+                const double* vals = GetHistogramBlock(Values[a] + i, n, buf);
+                MinMaxBlock(vals, n, &mn, &mx);
+                if (Sums) {
+                    for (int k = 0; k < n; ++k) {
+                        const double d = vals[k] - Shift[a];
+                        sum    += d;
+                        sum_sq += d * d;
+                    }
+                }
+            }
+            out[a].Min   = mn;
+            out[a].Max   = mx;
+            out[a].Sum   = sum;
+            out[a].SumSq = sum_sq;
+        }
+    }
+
+    static void Run(int task, void* data) {
+        const HistogramStatsTask& t = *(const HistogramStatsTask*)data;
+        t.Compute(t.Stats + task * t.Arrays, (int)((ImS64)t.Count * task / t.Tasks), (int)((ImS64)t.Count * (task + 1) / t.Tasks));
+    }
+};
+
+/// Counts the values in [first, last) into the bins of one task. #Ys is null for a one dimensional histogram.
+template <typename T>
+struct HistogramBinTask {
+    const T*                 Xs;
+    const T*                 Ys;
+    HistogramBinBlockFunc    BinBlock;
+    const HistogramBinCoefs* XCoefs;
+    const HistogramBinCoefs* YCoefs;
+    ImU32*                   Counts;     // XBins * YBins per task
+    int*                     Counted;    // values inside the range, per task
+    int*                     Below;      // values below the x range, per task
+    int                      Count, Tasks;
+
+    void Bin(int task, int first, int last) const {
+        double xbuf[IMPLOT_TRANSFORM_BLOCK], ybuf[IMPLOT_TRANSFORM_BLOCK];
+        int    xi[IMPLOT_TRANSFORM_BLOCK], yi[IMPLOT_TRANSFORM_BLOCK];
+        const int x_bins = XCoefs->Bins;
+        const int y_bins = Ys != nullptr ? YCoefs->Bins : 1;
+        ImU32* counts = Counts + (size_t)task * x_bins * y_bins;
+        memset(counts, 0, (size_t)x_bins * y_bins * sizeof(ImU32));
+        int counted = 0, below = 0;
+        for (int i = first; i < last; i += IMPLOT_TRANSFORM_BLOCK) {
+            const int n = ImMin(IMPLOT_TRANSFORM_BLOCK, last - i);
+            BinBlock(GetHistogramBlock(Xs + i, n, xbuf), n, *XCoefs, xi);
+            if (Ys == nullptr) {
+                for (int k = 0; k < n; ++k) {
+                    if ((unsigned)xi[k] < (unsigned)x_bins) {
+                        counts[xi[k]]++;
+                        counted++;
+                    }
+                    else if (xi[k] < 0) {
+                        below++;
+                    }
+                }
+            }
+            else {
+                BinBlock(GetHistogramBlock(Ys + i, n, ybuf), n, *YCoefs, yi);
+                for (int k = 0; k < n; ++k) {
+                    if ((unsigned)xi[k] < (unsigned)x_bins && (unsigned)yi[k] < (unsigned)y_bins) {
+                        counts[(size_t)yi[k] * x_bins + xi[k]]++;
+                        counted++;
+                    }
+                }
+            }
+        }
+        Counted[task] = counted;
+        Below[task]   = below;
+    }
+
+    static void Run(int task, void* data) {
+        const HistogramBinTask& t = *(const HistogramBinTask*)data;
+        t.Bin(task, (int)((ImS64)t.Count * task / t.Tasks), (int)((ImS64)t.Count * (task + 1) / t.Tasks));
+    }
+};
+
+static int GetHistogramTasks(int count) {
+    ImPlotContext& gp = *GImPlot;
+    return gp.ParallelFor != nullptr && count >= IMPLOT_PARALLEL_MIN_PRIMS ? ImMin(gp.ParallelMaxTasks, count / IMPLOT_PARALLEL_MIN_CHUNK) : 1;
+}
+
+// Computes the ImPlotHistogramStats of #xs and, if not null, #ys.
+template <typename T>
+static void ComputeHistogramStats(const T* xs, const T* ys, int count, bool sums, ImPlotHistogramStats* out) {
+    ImPlotContext& gp = *GImPlot;
+    HistogramStatsTask<T> data;
+    data.Values[0]   = xs;
+    data.Values[1]   = ys;
+    data.Shift[0]    = (double)xs[0];
+    data.Shift[1]    = ys != nullptr ? (double)ys[0] : 0.0;
+    data.MinMaxBlock = GetHistogramMinMaxBlockFunc(gp.TransformSimd);
+    data.Arrays      = ys != nullptr ? 2 : 1;
+    data.Count       = count;
+    data.Tasks       = GetHistogramTasks(count);
+    data.Sums        = sums;
+    ImVector<ImPlotHistogramStats>& stats = gp.HistogramTaskStats;
+    stats.resize(data.Tasks * data.Arrays);
+    data.Stats = stats.Data;
+    if (data.Tasks > 1)
+        gp.ParallelFor(data.Tasks, &HistogramStatsTask<T>::Run, &data, gp.ParallelForUserData);
+    else
+        data.Compute(data.Stats, 0, count);
+    for (int a = 0; a < data.Arrays; ++a) {
+        out[a] = stats[a];
+        for (int task = 1; task < data.Tasks; ++task) {
+            const ImPlotHistogramStats& s = stats[task * data.Arrays + a];
+            out[a].Min    = ImMin(out[a].Min, s.Min);
+            out[a].Max    = ImMax(out[a].Max, s.Max);
+            out[a].Sum   += s.Sum;
+            out[a].SumSq += s.SumSq;
+        }
+    }
+}
+
+// Resolves the range and bin count of one histogram axis like PlotHistogram always did.
+// #stats is only read for an automatic range or ImPlotBin_Scott.
+static void ResolveHistogramAxis(const ImPlotHistogramStats& stats, int count, bool auto_range, int bins_in, ImPlotRange& range, int& bins, double& width) {
+    if (auto_range)
+        range = stats.Min <= stats.Max ? ImPlotRange(stats.Min, stats.Max) : ImPlotRange();
+    if (bins_in < 0) {
+        const double var = bins_in == ImPlotBin_Scott ? (stats.SumSq - stats.Sum * stats.Sum / count) / (count - 1.0) : 0.0;
+        CalculateBins(count, sqrt(ImMax(var, 0.0)), bins_in, range, bins, width);
+        // ImPlotBin_Scott of a single value or of an empty range
+        if (!(bins >= 1)) {
+            bins  = 1;
+            width = range.Size();
+        }
+    }
+    else {
+        bins  = bins_in;
+        width = range.Size() / bins;
+    }
+}
+
+/// Returns the bins of #xs, and of #ys for a two dimensional histogram, from the cache of the context. They are
+/// computed again unless #has_version is true and the cached bins were computed from the same data version. The
+/// automatic range and ImPlotBin_Scott need one statistics pass before the binning pass, the other ImPlotBin_
+/// methods only depend on the count and the range.
+template <typename T>
+static const ImPlotHistogramBins& ComputeHistogram(const T* xs, const T* ys, int count, int x_bins, int y_bins, ImPlotRect range, ImPlotHistogramFlags flags, bool has_version, ImU64 version) {
+    ImPlotContext& gp = *GImPlot;
+    const int frame = ImGui::GetFrameCount();
+    // BinHistogram may be called outside of any plot
+    GcItemCaches();
+    flags &= ImPlotHistogramFlags_Cumulative | ImPlotHistogramFlags_Density | ImPlotHistogramFlags_NoOutliers;
+    const void*  ptrs[2] = { xs, ys };
+    const int    ints[5] = { count, (int)sizeof(T) * 2 + ((T)0.5 != (T)0 ? 1 : 0), x_bins, y_bins, flags };
+    const double lims[4] = { range.X.Min, range.X.Max, range.Y.Min, range.Y.Max };
+    const ImGuiID id = ImHashData(ptrs, sizeof(ptrs), ImHashData(ints, sizeof(ints), ImHashData(lims, sizeof(lims))));
+    ImPlotHistogram& hist = *gp.Histograms.GetOrAddByKey(id);
+    hist.ID        = id;
+    hist.LastFrame = frame;
+    if (hist.Valid && has_version && hist.HasDataVersion && hist.DataVersion == version)
+        return hist.Bins;
+    hist.Valid          = true;
+    hist.HasDataVersion = has_version;
+    hist.DataVersion    = version;
+
+    const bool is_2d  = ys != nullptr;
+    const bool auto_x = range.X.Min == 0 && range.X.Max == 0;
+    const bool auto_y = is_2d && range.Y.Min == 0 && range.Y.Max == 0;
+    const bool scott_x = x_bins == ImPlotBin_Scott;
+    const bool scott_y = is_2d && y_bins == ImPlotBin_Scott;
+    ImPlotHistogramStats stats[2] = {};
+    if (auto_x || auto_y || scott_x || scott_y)
+        ComputeHistogramStats(xs, ys, count, scott_x || scott_y, stats);
+    ImPlotHistogramBins& bins = hist.Bins;
+    bins.Range = range;
+    ResolveHistogramAxis(stats[0], count, auto_x, x_bins, bins.Range.X, bins.XBins, bins.Width);
+    if (is_2d)
+        ResolveHistogramAxis(stats[1], count, auto_y, y_bins, bins.Range.Y, bins.YBins, bins.Height);
+    else
+        bins.YBins = 1;
+    const int n_bins = bins.XBins * bins.YBins;
+
+    // count each task into its own bins, then add them up
+    const HistogramBinCoefs x_coefs(bins.Range.X, bins.Width, bins.XBins);
+    const HistogramBinCoefs y_coefs(bins.Range.Y, bins.Height, bins.YBins);
+    HistogramBinTask<T> data;
+    data.Xs       = xs;
+    data.Ys       = ys;
+    data.BinBlock = GetHistogramBinBlockFunc(gp.TransformSimd);
+    data.XCoefs   = &x_coefs;
+    data.YCoefs   = &y_coefs;
+    data.Count    = count;
+    data.Tasks    = GetHistogramTasks(count);
+    gp.HistogramTaskCounts.resize(data.Tasks * n_bins);
+    data.Counts   = gp.HistogramTaskCounts.Data;
+    ImVector<int> task_counts;
+    task_counts.resize(data.Tasks * 2);
+    data.Counted  = task_counts.Data;
+    data.Below    = task_counts.Data + data.Tasks;
+    if (data.Tasks > 1)
+        gp.ParallelFor(data.Tasks, &HistogramBinTask<T>::Run, &data, gp.ParallelForUserData);
+    else
+        data.Bin(0, 0, count);
+    hist.Counts.resize(n_bins);
+    double* counts = hist.Counts.Data;
+    for (int b = 0; b < n_bins; ++b)
+        counts[b] = (double)data.Counts[b];
+    int counted = data.Counted[0], below = data.Below[0];
+    for (int task = 1; task < data.Tasks; ++task) {
+        const ImU32* task_bins = data.Counts + (size_t)task * n_bins;
+        for (int b = 0; b < n_bins; ++b)
+            counts[b] += (double)task_bins[b];
+        counted += data.Counted[task];
+        below   += data.Below[task];
+    }
+
+    const bool cumulative = !is_2d && ImHasFlag(flags, ImPlotHistogramFlags_Cumulative);
+    const bool density    = ImHasFlag(flags, ImPlotHistogramFlags_Density);
+    const bool outliers   = !ImHasFlag(flags, ImPlotHistogramFlags_NoOutliers);
+    double max_count = 0;
+    for (int b = 0; b < n_bins; ++b)
+        max_count = ImMax(max_count, counts[b]);
+    if (cumulative) {
         if (outliers)
-            bin_counts[0] += below;
-        for (int b = 1; b < bins; ++b)
-            bin_counts[b] += bin_counts[b-1];
-        max_count = bin_counts[bins-1];
+            counts[0] += below;
+        for (int b = 1; b < n_bins; ++b)
+            counts[b] += counts[b-1];
+        if (density) {
+            double scale = 1.0 / (outliers ? count : counted);
+            for (int b = 0; b < n_bins; ++b)
+                counts[b] *= scale;
+        }
+        max_count = counts[n_bins-1];
     }
     else if (density) {
-        double scale = 1.0 / ((outliers ? count : counted) * width);
-        for (int b = 0; b < bins; ++b)
-            bin_counts[b] *= scale;
+        double scale = 1.0 / ((outliers ? count : counted) * bins.Width * (is_2d ? bins.Height : 1.0));
+        for (int b = 0; b < n_bins; ++b)
+            counts[b] *= scale;
         max_count *= scale;
     }
+    bins.Counts   = counts;
+    bins.Height   = is_2d ? bins.Height : 0.0;
+    bins.MaxCount = max_count;
+    bins.Count    = count;
+    bins.Counted  = counted;
+    return bins;
+}
+
+template <typename T>
+ImPlotHistogramBins BinHistogram(const T* values, int count, ImU64 data_version, int bins, ImPlotRange range, ImPlotHistogramFlags flags) {
+    IM_ASSERT_USER_ERROR(GImPlot != nullptr, "No current context. Did you call ImPlot::CreateContext() or ImPlot::SetCurrentContext()?");
+    if (count <= 0 || bins == 0)
+        return ImPlotHistogramBins();
+    return ComputeHistogram(values, (const T*)nullptr, count, bins, 1, ImPlotRect(range.Min, range.Max, 0, 0), flags, true, data_version);
+}
+#define INSTANTIATE_MACRO(T) template IMPLOT_API ImPlotHistogramBins BinHistogram<T>(const T* values, int count, ImU64 data_version, int bins, ImPlotRange range, ImPlotHistogramFlags flags);
+CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
+#undef INSTANTIATE_MACRO
+
+template <typename T>
+ImPlotHistogramBins BinHistogram2D(const T* xs, const T* ys, int count, ImU64 data_version, int x_bins, int y_bins, ImPlotRect range, ImPlotHistogramFlags flags) {
+    IM_ASSERT_USER_ERROR(GImPlot != nullptr, "No current context. Did you call ImPlot::CreateContext() or ImPlot::SetCurrentContext()?");
+    if (count <= 0 || x_bins == 0 || y_bins == 0)
+        return ImPlotHistogramBins();
+    return ComputeHistogram(xs, ys, count, x_bins, y_bins, range, flags, true, data_version);
+}
+#define INSTANTIATE_MACRO(T) template IMPLOT_API ImPlotHistogramBins BinHistogram2D<T>(const T* xs, const T* ys, int count, ImU64 data_version, int x_bins, int y_bins, ImPlotRect range, ImPlotHistogramFlags flags);
+CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
+#undef INSTANTIATE_MACRO
+
+template <typename T>
+double PlotHistogram(const char* label_id, const T* values, int count, int bins, double bar_scale, ImPlotRange range, ImPlotHistogramFlags flags) {
+
+    if (count <= 0 || bins == 0)
+        return 0;
+
+    ImPlotContext& gp = *GImPlot;
+    const ImPlotNextItemData& s = gp.NextItemData;
+    const ImPlotHistogramBins& hist = ComputeHistogram(values, (const T*)nullptr, count, bins, 1, ImPlotRect(range.Min, range.Max, 0, 0), flags, s.HasDataVersion, s.DataVersion);
+    const double width = hist.Width;
+    ImVector<double>& bin_centers = gp.TempDouble1;
+    bin_centers.resize(hist.XBins);
+    for (int b = 0; b < hist.XBins; ++b)
+        bin_centers[b] = hist.Range.X.Min + b * width + width * 0.5;
     if (ImHasFlag(flags, ImPlotHistogramFlags_Horizontal))
-        PlotBars(label_id, &bin_counts.Data[0], &bin_centers.Data[0], bins, bar_scale*width, ImPlotBarsFlags_Horizontal);
+        PlotBars(label_id, hist.Counts, &bin_centers.Data[0], hist.XBins, bar_scale*width, ImPlotBarsFlags_Horizontal);
     else
-        PlotBars(label_id, &bin_centers.Data[0], &bin_counts.Data[0], bins, bar_scale*width);
-    return max_count;
+        PlotBars(label_id, &bin_centers.Data[0], hist.Counts, hist.XBins, bar_scale*width);
+    return hist.MaxCount;
 }
 #define INSTANTIATE_MACRO(T) template IMPLOT_API double PlotHistogram<T>(const char* label_id, const T* values, int count, int bins, double bar_scale, ImPlotRange range, ImPlotHistogramFlags flags);
 CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
@@ -2629,72 +5408,20 @@ template <typename T>
 double PlotHistogram2D(const char* label_id, const T* xs, const T* ys, int count, int x_bins, int y_bins, ImPlotRect range, ImPlotHistogramFlags flags) {
 
     // const bool cumulative = ImHasFlag(flags, ImPlotHistogramFlags_Cumulative); NOT SUPPORTED
-    const bool density  = ImHasFlag(flags, ImPlotHistogramFlags_Density);
-    const bool outliers = !ImHasFlag(flags, ImPlotHistogramFlags_NoOutliers);
-    const bool col_maj  = ImHasFlag(flags, ImPlotHistogramFlags_ColMajor);
+    const bool col_maj = ImHasFlag(flags, ImPlotHistogramFlags_ColMajor);
 
     if (count <= 0 || x_bins == 0 || y_bins == 0)
         return 0;
 
-    if (range.X.Min == 0 && range.X.Max == 0) {
-        T Min, Max;
-        ImMinMaxArray(xs, count, &Min, &Max);
-        range.X.Min = (double)Min;
-        range.X.Max = (double)Max;
-    }
-    if (range.Y.Min == 0 && range.Y.Max == 0) {
-        T Min, Max;
-        ImMinMaxArray(ys, count, &Min, &Max);
-        range.Y.Min = (double)Min;
-        range.Y.Max = (double)Max;
-    }
-
-    double width, height;
-    if (x_bins < 0)
-        CalculateBins(xs, count, x_bins, range.X, x_bins, width);
-    else
-        width = range.X.Size() / x_bins;
-    if (y_bins < 0)
-        CalculateBins(ys, count, y_bins, range.Y, y_bins, height);
-    else
-        height = range.Y.Size() / y_bins;
-
-    const int bins = x_bins * y_bins;
-
     ImPlotContext& gp = *GImPlot;
-    ImVector<double>& bin_counts = gp.TempDouble1;
-    bin_counts.resize(bins);
-
-    for (int b = 0; b < bins; ++b)
-        bin_counts[b] = 0;
-
-    int counted = 0;
-    double max_count = 0;
-    for (int i = 0; i < count; ++i) {
-        if (range.Contains((double)xs[i], (double)ys[i])) {
-            const int xb = ImClamp( (int)((double)(xs[i] - range.X.Min) / width)  , 0, x_bins - 1);
-            const int yb = ImClamp( (int)((double)(ys[i] - range.Y.Min) / height) , 0, y_bins - 1);
-            const int b  = yb * x_bins + xb;
-            bin_counts[b] += 1.0;
-            if (bin_counts[b] > max_count)
-                max_count = bin_counts[b];
-            counted++;
-        }
-    }
-    if (density) {
-        double scale = 1.0 / ((outliers ? count : counted) * width * height);
-        for (int b = 0; b < bins; ++b)
-            bin_counts[b] *= scale;
-        max_count *= scale;
-    }
+    const ImPlotNextItemData& s = gp.NextItemData;
+    const ImPlotHistogramBins& hist = ComputeHistogram(xs, ys, count, x_bins, y_bins, range, flags, s.HasDataVersion, s.DataVersion);
+    const double max_count = hist.MaxCount;
+    range = hist.Range;
 
     if (BeginItemEx(label_id, FitterRect(range))) {
-        if (y_bins <= 0 || x_bins <= 0) {
-            EndItem();
-            return max_count;
-        }
         ImDrawList& draw_list = *GetPlotDrawList();
-        RenderHeatmap(draw_list, &bin_counts.Data[0], y_bins, x_bins, 0, max_count, nullptr, range.Min(), range.Max(), false, col_maj);
+        RenderHeatmap(draw_list, hist.Counts, hist.YBins, hist.XBins, 0, max_count, nullptr, range.Min(), range.Max(), false, col_maj);
         EndItem();
     }
     return max_count;
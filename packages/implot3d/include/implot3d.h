@@ -312,6 +312,15 @@ enum ImPlot3DColormap_ {
 // Callback signature for axis tick label formatter
 typedef int (*ImPlot3DFormatter)(float value, char* buff, int size, void* user_data);
 
+// Geometry emitted by one visible item in one frame, before depth sorting. See GetItemDrawStats()
+struct ImPlot3DItemDrawStats {
+    ImGuiID ID;            // Item ID
+    const char* PlotTitle; // Title of the plot that owns the item (empty for "##" titles)
+    const char* Label;     // Item label, without the "##" suffix
+    int VtxCount;          // Vertices added between BeginItem and EndItem (3D and 2D draw lists)
+    int IdxCount;          // Indices added between BeginItem and EndItem (3D and 2D draw lists)
+};
+
 namespace ImPlot3D {
 
 //-----------------------------------------------------------------------------
@@ -438,6 +447,12 @@ IMPLOT3D_TMP void PlotSurface(const char* label_id, const T* xs, const T* ys, co
 IMPLOT3D_API void PlotMesh(const char* label_id, const ImPlot3DPoint* vtx, const unsigned int* idx, int vtx_count, int idx_count,
                            ImPlot3DMeshFlags flags = 0);
 
+// Plots a mesh whose fill is colored per vertex by mapping #values (one per vertex) through the current colormap. Colors are interpolated across
+// each triangle, so a whole scalar field is drawn as a single item. Leave #scale_min and #scale_max both at 0 for automatic color scaling, or set
+// them to a predefined range
+IMPLOT3D_API void PlotMesh(const char* label_id, const ImPlot3DPoint* vtx, const unsigned int* idx, const float* values, int vtx_count,
+                           int idx_count, double scale_min = 0.0, double scale_max = 0.0, ImPlot3DMeshFlags flags = 0);
+
 // Plots a rectangular image in 3D defined by its center and two direction vectors (axes).
 // #center is the center of the rectangle in plot coordinates.
 // #axis_u and #axis_v define the local axes and half-extents of the rectangle in 3D space.
@@ -484,6 +499,10 @@ IMPLOT3D_API ImVec2 GetPlotSize(); // Get the current plot size in pixels
 
 IMPLOT3D_API ImDrawList* GetPlotDrawList();
 
+// Returns the per-item geometry of the last complete frame (the frame before the current one) and writes the number
+// of entries to count. The array and its strings stay valid until the next frame's stats are published
+IMPLOT3D_API const ImPlot3DItemDrawStats* GetItemDrawStats(int* count);
+
 //-----------------------------------------------------------------------------
 // [SECTION] Styles
 //-----------------------------------------------------------------------------
@@ -520,6 +539,10 @@ IMPLOT3D_API void SetNextFillStyle(const ImVec4& col = IMPLOT3D_AUTO_COL, float
 // Set the marker style for the next item only
 IMPLOT3D_API void SetNextMarkerStyle(ImPlot3DMarker marker = IMPLOT3D_AUTO, float size = IMPLOT3D_AUTO, const ImVec4& fill = IMPLOT3D_AUTO_COL,
                                      float weight = IMPLOT3D_AUTO, const ImVec4& outline = IMPLOT3D_AUTO_COL);
+// Declare that the data of the next item stays the same for as long as version does. While the version, the rotation,
+// the axes and the item style all match the previous frame, the item replays the triangles it generated then instead of
+// rebuilding them. Change the version whenever the data or any other argument passed to the PlotX function changes
+IMPLOT3D_API void SetNextItemDataVersion(ImU64 version);
 
 // Get color
 IMPLOT3D_API ImVec4 GetStyleColorVec4(ImPlot3DCol idx);
@@ -43,6 +43,10 @@
 #define IMPLOT3D_LABEL_FORMAT "%g"
 // Max character size for tick labels
 #define IMPLOT3D_LABEL_MAX_SIZE 32
+// Frames the cached geometry of an item that is no longer plotted is kept before it is freed
+#define IMPLOT3D_ITEM_GEOMETRY_GC_FRAMES 60
+// Items that emit more vertices than this are not cached
+#define IMPLOT3D_ITEM_GEOMETRY_MAX_VTX (1 << 21)
 
 //-----------------------------------------------------------------------------
 // [SECTION] Generic Helpers
@@ -136,6 +140,8 @@ struct ImDrawList3D {
     float* _ZWritePtr;        // [Internal] point within ZBuffer.Data after each add command (to avoid using the ImVector<> operators too much)
     ImDrawListFlags _Flags;   // [Internal] draw list flags
     ImVector<ImTextureBufferItem> _TextureBuffer; // [Internal] buffer for SetTexture/ResetTexture
+    ImVector<ImU32> _SortKeys;                    // [Internal] radix sort scratch (depth keys), reused across frames
+    ImVector<int> _SortOrder;                     // [Internal] radix sort scratch (triangle indices), reused across frames
     ImDrawListSharedData* _SharedData;            // [Internal] shared draw list data
 
     ImDrawList3D() {
@@ -181,6 +187,8 @@ struct ImPlot3DNextItemData {
     bool IsAutoFill;
     bool IsAutoLine;
     bool Hidden;
+    bool HasDataVersion;
+    ImU64 DataVersion;
 
     ImPlot3DNextItemData() { Reset(); }
 
@@ -199,6 +207,8 @@ struct ImPlot3DNextItemData {
         IsAutoFill = true;
         IsAutoLine = true;
         Hidden = false;
+        HasDataVersion = false;
+        DataVersion = 0;
     }
 };
 
@@ -619,6 +629,56 @@ struct ImPlot3DPlot {
     float GetBoxZoom() const;
 };
 
+// Geometry accounting of one item in the frame being recorded (see GetItemDrawStats)
+struct ImPlot3DItemDrawRecord {
+    ImGuiID ID;
+    int PlotTitleOffset, LabelOffset; // Into ImPlot3DContext::ItemDrawNames
+    int VtxCount, IdxCount;           // Draw list sizes at BeginItem, replaced by the amount added at EndItem
+};
+
+// Everything besides the data that the triangles of an item depend on (see SetNextItemDataVersion). Zero filled on
+// construction so that keys can be compared with memcmp
+struct ImPlot3DItemGeometryKey {
+    ImU64 DataVersion;
+    ImPlot3DItemFlags Flags;
+    ImPlot3DQuat Rotation;
+    ImPlot3DRange Range[3];
+    ImPlot3DAxisFlags AxisFlags[3];
+    ImPlot3DPoint BoxScale;
+    ImRect PlotRect;
+    ImVec4 Colors[4];
+    float LineWeight, MarkerSize, MarkerWeight;
+    ImPlot3DMarker Marker;
+    ImPlot3DColormap Colormap;
+    float Alpha;
+    ImDrawListFlags DrawListFlags;
+
+    ImPlot3DItemGeometryKey() { memset((void*)this, 0, sizeof(*this)); }
+};
+
+// Triangles an item added to the plot's 3D draw list, replayed while its key is unchanged
+struct ImPlot3DItemGeometry {
+    ImGuiID ID;
+    ImPlot3DItemGeometryKey Key;
+    bool Valid; // False until a recording completed
+    ImVector<ImDrawVert> VtxBuffer;
+    ImVector<ImDrawIdx> IdxBuffer; // Relative to the first vertex of VtxBuffer
+    ImVector<float> ZBuffer;
+    int VtxStart, IdxStart, ZStart;            // 3D draw list sizes when the recording started
+    unsigned int VtxIdxStart;                  // ImDrawList3D::_VtxCurrentIdx when the recording started
+    int WindowVtxStart, TextureCount;          // Items that draw text or switch textures are not cached
+    int LastFrame;
+
+    ImPlot3DItemGeometry() {
+        ID = 0;
+        Valid = false;
+        VtxStart = IdxStart = ZStart = 0;
+        VtxIdxStart = 0;
+        WindowVtxStart = TextureCount = 0;
+        LastFrame = 0;
+    }
+};
+
 struct ImPlot3DContext {
     ImPool<ImPlot3DPlot> Plots;
     ImPlot3DPlot* CurrentPlot;
@@ -630,6 +690,17 @@ struct ImPlot3DContext {
     ImVector<ImGuiStyleMod> StyleModifiers;
     ImVector<ImPlot3DColormap> ColormapModifiers;
     ImPlot3DColormapData ColormapData;
+    // Per item geometry accounting (see GetItemDrawStats)
+    int ItemDrawFrame;                              // Frame that ItemDrawRecords belongs to
+    bool ItemDrawRecordOpen;                        // BeginItem recorded the draw list sizes of the current item
+    ImVector<ImPlot3DItemDrawRecord> ItemDrawRecords;
+    ImVector<char> ItemDrawNames;
+    ImVector<ImPlot3DItemDrawStats> ItemDrawStats;  // Last complete frame, strings point into ItemDrawStatsNames
+    ImVector<char> ItemDrawStatsNames;
+    // Item geometry cache, keyed by plot and item ID (see SetNextItemDataVersion)
+    ImPool<ImPlot3DItemGeometry> ItemGeometries;
+    ImGuiID ItemGeometryRecordID; // Entry recorded by the current item, or 0
+    int ItemGeometryGcFrame;      // Last frame GcItemGeometries ran
 };
 
 //-----------------------------------------------------------------------------
@@ -683,6 +754,9 @@ IMPLOT3D_API ImPlot3DItem* GetCurrentItem();
 // Busts the cache for every item for every plot in the current context
 IMPLOT3D_API void BustItemCache();
 
+// Frees the cached geometry of items that are no longer plotted. Does the work once per frame, BeginPlot calls it
+IMPLOT3D_API void GcItemGeometries();
+
 // TODO move to another place
 IMPLOT3D_API void AddTextRotated(ImDrawList* draw_list, ImVec2 pos, float angle, ImU32 col, const char* text_begin, const char* text_end = nullptr);
 
@@ -710,6 +784,10 @@ IMPLOT3D_API ImPlot3DRay PixelsToNDCRay(const ImVec2& pix);
 // Convert a ray in the NDC to a ray in the current plot's coordinate system
 IMPLOT3D_API ImPlot3DRay NDCRayToPlotRay(const ImPlot3DRay& ray);
 
+// Sort indices [0, count) by ascending depth using an LSD radix sort on order-preserving float keys
+// The scratch vectors keep their capacity between calls. Returns a pointer into order_scratch
+IMPLOT3D_API const int* RadixSortByDepth(const float* depths, int count, ImVector<ImU32>& key_scratch, ImVector<int>& order_scratch);
+
 //-----------------------------------------------------------------------------
 // [SECTION] Setup Utils
 //-----------------------------------------------------------------------------
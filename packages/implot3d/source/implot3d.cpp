@@ -1310,6 +1310,9 @@ bool BeginPlot(const char* title_id, const ImVec2& size, ImPlot3DFlags flags) {
     ImGuiContext& g = *GImGui;
     ImGuiWindow* window = g.CurrentWindow;
 
+    // Free the cached geometry of items that stopped being plotted, the first plot of a frame does the work
+    GcItemGeometries();
+
     // Skip if needed
     if (window->SkipItems)
         return false;
@@ -1628,6 +1631,7 @@ ImPlot3DPlot* GetCurrentPlot() { return GImPlot3D->CurrentPlot; }
 void BustPlotCache() {
     ImPlot3DContext& gp = *GImPlot3D;
     gp.Plots.Clear();
+    gp.ItemGeometries.Clear();
 }
 
 ImVec2 PlotToPixels(const ImPlot3DPoint& point) {
@@ -1845,6 +1849,56 @@ ImPlot3DRay NDCRayToPlotRay(const ImPlot3DRay& ray) {
     return plot_ray;
 }
 
+// Maps a float to an unsigned key with the same ordering: flip all bits of negatives, only the sign bit of positives
+static inline ImU32 DepthToSortKey(float z) {
+    ImU32 u;
+    memcpy(&u, &z, sizeof(u));
+    return (u & 0x80000000u) ? ~u : (u | 0x80000000u);
+}
+
+const int* RadixSortByDepth(const float* depths, int count, ImVector<ImU32>& key_scratch, ImVector<int>& order_scratch) {
+    key_scratch.resize(count * 2);
+    order_scratch.resize(count * 2);
+    ImU32* keys = key_scratch.Data;
+    ImU32* keys_tmp = key_scratch.Data + count;
+    int* order = order_scratch.Data;
+    int* order_tmp = order_scratch.Data + count;
+
+    // Build keys and all four byte histograms in a single pass
+    ImU32 hist[4][256] = {};
+    for (int i = 0; i < count; i++) {
+        ImU32 key = DepthToSortKey(depths[i]);
+        keys[i] = key;
+        order[i] = i;
+        hist[0][key & 0xFF]++;
+        hist[1][(key >> 8) & 0xFF]++;
+        hist[2][(key >> 16) & 0xFF]++;
+        hist[3][key >> 24]++;
+    }
+
+    // One stable counting pass per byte, least significant first
+    for (int pass = 0; pass < 4; pass++) {
+        const int shift = pass * 8;
+        ImU32* h = hist[pass];
+        if (count == 0 || h[(keys[0] >> shift) & 0xFF] == (ImU32)count)
+            continue; // Every key has the same byte here, the pass would not move anything
+        ImU32 sum = 0;
+        for (int b = 0; b < 256; b++) {
+            ImU32 n = h[b];
+            h[b] = sum;
+            sum += n;
+        }
+        for (int i = 0; i < count; i++) {
+            ImU32 dst = h[(keys[i] >> shift) & 0xFF]++;
+            keys_tmp[dst] = keys[i];
+            order_tmp[dst] = order[i];
+        }
+        ImSwap(keys, keys_tmp);
+        ImSwap(order, order_tmp);
+    }
+    return order;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Setup Utils
 //-----------------------------------------------------------------------------
@@ -2627,6 +2681,15 @@ void ResetContext(ImPlot3DContext* ctx) {
     ctx->CurrentItem = nullptr;
     ctx->NextItemData.Reset();
     ctx->Style = ImPlot3DStyle();
+    ctx->ItemDrawFrame = -1;
+    ctx->ItemDrawRecordOpen = false;
+    ctx->ItemDrawRecords.clear();
+    ctx->ItemDrawNames.clear();
+    ctx->ItemDrawStats.clear();
+    ctx->ItemDrawStatsNames.clear();
+    ctx->ItemGeometries.Clear();
+    ctx->ItemGeometryRecordID = 0;
+    ctx->ItemGeometryGcFrame = -1;
 }
 
 //-----------------------------------------------------------------------------
@@ -3059,23 +3122,8 @@ void ImDrawList3D::SortedMoveToImGuiDrawList() {
         return;
     }
 
-    // Build an array of (z, tri_idx)
-    struct TriRef {
-        float z;
-        int tri_idx;
-    };
-    TriRef* tris = (TriRef*)IM_ALLOC(sizeof(TriRef) * tri_count);
-    for (int i = 0; i < tri_count; i++) {
-        tris[i].z = ZBuffer[i];
-        tris[i].tri_idx = i;
-    }
-
-    // Sort by z (distance from viewer)
-    ImQsort(tris, (size_t)tri_count, sizeof(TriRef), [](const void* a, const void* b) {
-        float za = ((const TriRef*)a)->z;
-        float zb = ((const TriRef*)b)->z;
-        return (za < zb) ? -1 : (za > zb) ? 1 : 0;
-    });
+    // Sort triangle indices by z (distance from viewer)
+    const int* tris = ImPlot3D::RadixSortByDepth(ZBuffer.Data, tri_count, _SortKeys, _SortOrder);
 
     // Reserve space in the ImGui draw list
     draw_list.PrimReserve(IdxBuffer.Size, VtxBuffer.Size);
@@ -3094,7 +3142,7 @@ void ImDrawList3D::SortedMoveToImGuiDrawList() {
     ImDrawIdx* idx_out = idx_out_begin;
     ImDrawIdx* idx_in = IdxBuffer.Data;
     for (int i = 0; i < tri_count; i++) {
-        int tri_i = tris[i].tri_idx;
+        int tri_i = tris[i];
         int base_idx = tri_i * 3;
         unsigned int i0 = (unsigned int)idx_in[base_idx + 0];
         unsigned int i1 = (unsigned int)idx_in[base_idx + 1];
@@ -3171,8 +3219,6 @@ void ImDrawList3D::SortedMoveToImGuiDrawList() {
 
     // Reset buffers since we've moved them
     ResetBuffers();
-
-    IM_FREE(tris);
 }
 
 //-----------------------------------------------------------------------------
@@ -28,6 +28,7 @@
 
 #include "implot3d.h"
 #include "implot3d_internal.h"
+#include <chrono>
 
 //-----------------------------------------------------------------------------
 // [SECTION] User Namespace
@@ -402,6 +403,22 @@ void DemoMeshPlots() {
         ImGui::ColorEdit4("##MeshMarkerColor", (float*)&marker_color);
     }
 
+    // Color each vertex by its height instead of using a single fill color
+    static bool color_by_z = false;
+    ImGui::Checkbox("Colormap by Z", &color_by_z);
+
+    const ImPlot3DPoint* vtx = mesh_id == 0 ? duck_vtx : mesh_id == 1 ? sphere_vtx : cube_vtx;
+    const unsigned int* idx = mesh_id == 0 ? duck_idx : mesh_id == 1 ? sphere_idx : cube_idx;
+    const int vtx_count = mesh_id == 0 ? DUCK_VTX_COUNT : mesh_id == 1 ? SPHERE_VTX_COUNT : CUBE_VTX_COUNT;
+    const int idx_count = mesh_id == 0 ? DUCK_IDX_COUNT : mesh_id == 1 ? SPHERE_IDX_COUNT : CUBE_IDX_COUNT;
+    static ImVector<float> heights;
+    if (color_by_z) {
+        heights.resize(vtx_count);
+        for (int i = 0; i < vtx_count; i++)
+            heights[i] = vtx[i].z;
+        ImPlot3D::PushColormap("Viridis");
+    }
+
     if (ImPlot3D::BeginPlot("Mesh Plots")) {
         ImPlot3D::SetupAxesLimits(-1, 1, -1, 1, -1, 1);
 
@@ -418,15 +435,16 @@ void DemoMeshPlots() {
             ImPlot3D::SetNextMarkerStyle(ImPlot3DMarker_Square, 3, marker_color, IMPLOT3D_AUTO, marker_color);
 
         // Plot mesh
-        if (mesh_id == 0)
-            ImPlot3D::PlotMesh("Duck", duck_vtx, duck_idx, DUCK_VTX_COUNT, DUCK_IDX_COUNT);
-        else if (mesh_id == 1)
-            ImPlot3D::PlotMesh("Sphere", sphere_vtx, sphere_idx, SPHERE_VTX_COUNT, SPHERE_IDX_COUNT);
-        else if (mesh_id == 2)
-            ImPlot3D::PlotMesh("Cube", cube_vtx, cube_idx, CUBE_VTX_COUNT, CUBE_IDX_COUNT);
+        const char* label = mesh_id == 0 ? "Duck" : mesh_id == 1 ? "Sphere" : "Cube";
+        if (color_by_z)
+            ImPlot3D::PlotMesh(label, vtx, idx, heights.Data, vtx_count, idx_count);
+        else
+            ImPlot3D::PlotMesh(label, vtx, idx, vtx_count, idx_count);
 
         ImPlot3D::EndPlot();
     }
+    if (color_by_z)
+        ImPlot3D::PopColormap();
 }
 
 void DemoImagePlots() {
@@ -756,6 +774,76 @@ void DemoCustomRendering() {
     }
 }
 
+void DemoDepthSortBenchmark() {
+    ImGui::BulletText("Every frame, ImPlot3D sorts all triangles by depth before moving them to the ImGui draw list.");
+    ImGui::BulletText("This compares the radix sort it uses with ImQsort on the same random depths, for several triangle counts.");
+
+    static const int tri_counts[] = {1000, 10000, 100000, 1000000, 4000000};
+    constexpr int size_count = IM_ARRAYSIZE(tri_counts);
+    static double radix_ms[size_count] = {};
+    static double qsort_ms[size_count] = {};
+    static bool sorted_ok[size_count] = {};
+    static ImVector<float> depths;
+    static ImVector<ImU32> keys;
+    static ImVector<int> order;
+    if (ImGui::Button("Run")) {
+        struct TriRef {
+            float z;
+            int tri_idx;
+        };
+        ImVector<TriRef> tris;
+        for (int s = 0; s < size_count; s++) {
+            const int tri_count = tri_counts[s];
+            depths.resize(tri_count);
+            for (int i = 0; i < tri_count; i++)
+                depths[i] = 2.0f * rand() / (float)RAND_MAX - 1.0f;
+
+            // Warm the scratch buffers once, as they are reused across frames in the draw list
+            ImPlot3D::RadixSortByDepth(depths.Data, tri_count, keys, order);
+            auto t0 = std::chrono::steady_clock::now();
+            const int* sorted = ImPlot3D::RadixSortByDepth(depths.Data, tri_count, keys, order);
+            auto t1 = std::chrono::steady_clock::now();
+            sorted_ok[s] = true;
+            for (int i = 1; i < tri_count; i++)
+                sorted_ok[s] &= depths[sorted[i - 1]] <= depths[sorted[i]];
+
+            tris.resize(tri_count);
+            for (int i = 0; i < tri_count; i++) {
+                tris[i].z = depths[i];
+                tris[i].tri_idx = i;
+            }
+            auto t2 = std::chrono::steady_clock::now();
+            ImQsort(tris.Data, (size_t)tri_count, sizeof(TriRef), [](const void* a, const void* b) {
+                float za = ((const TriRef*)a)->z;
+                float zb = ((const TriRef*)b)->z;
+                return (za < zb) ? -1 : (za > zb) ? 1 : 0;
+            });
+            auto t3 = std::chrono::steady_clock::now();
+            radix_ms[s] = std::chrono::duration<double, std::milli>(t1 - t0).count();
+            qsort_ms[s] = std::chrono::duration<double, std::milli>(t3 - t2).count();
+        }
+    }
+    if (radix_ms[0] > 0.0 && ImGui::BeginTable("##DepthSortResults", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_SizingFixedFit)) {
+        ImGui::TableSetupColumn("Triangles");
+        ImGui::TableSetupColumn("Radix sort (ms)");
+        ImGui::TableSetupColumn("ImQsort (ms)");
+        ImGui::TableSetupColumn("Speedup");
+        ImGui::TableHeadersRow();
+        for (int s = 0; s < size_count; s++) {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::Text("%d", tri_counts[s]);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f%s", radix_ms[s], sorted_ok[s] ? "" : " (NOT SORTED)");
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", qsort_ms[s]);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.1fx", radix_ms[s] > 0.0 ? qsort_ms[s] / radix_ms[s] : 0.0);
+        }
+        ImGui::EndTable();
+    }
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Demo Window
 //-----------------------------------------------------------------------------
@@ -855,6 +943,7 @@ void ShowAllDemos() {
         if (ImGui::BeginTabItem("Custom")) {
             DemoHeader("Custom Styles", DemoCustomStyles);
             DemoHeader("Custom Rendering", DemoCustomRendering);
+            DemoHeader("Depth Sort Benchmark", DemoDepthSortBenchmark);
             ImGui::EndTabItem();
         }
         if (ImGui::BeginTabItem("Help")) {
@@ -140,6 +140,189 @@ namespace ImPlot3D {
 static const float ITEM_HIGHLIGHT_LINE_SCALE = 2.0f;
 static const float ITEM_HIGHLIGHT_MARK_SCALE = 1.25f;
 
+// Moves the records of the previous frame to ItemDrawStats and starts recording the current frame. Records older than
+// the previous frame are dropped, so a frame without plots publishes no stats
+static void UpdateItemDrawStats(ImPlot3DContext& gp) {
+    const int frame = ImGui::GetFrameCount();
+    if (gp.ItemDrawFrame == frame)
+        return;
+    gp.ItemDrawStats.shrink(0);
+    gp.ItemDrawStatsNames.swap(gp.ItemDrawNames);
+    if (gp.ItemDrawFrame == frame - 1) {
+        gp.ItemDrawStats.resize(gp.ItemDrawRecords.Size);
+        for (int i = 0; i < gp.ItemDrawRecords.Size; i++) {
+            const ImPlot3DItemDrawRecord& record = gp.ItemDrawRecords[i];
+            ImPlot3DItemDrawStats& stats = gp.ItemDrawStats[i];
+            stats.ID = record.ID;
+            stats.PlotTitle = gp.ItemDrawStatsNames.Data + record.PlotTitleOffset;
+            stats.Label = gp.ItemDrawStatsNames.Data + record.LabelOffset;
+            stats.VtxCount = record.VtxCount;
+            stats.IdxCount = record.IdxCount;
+        }
+    }
+    gp.ItemDrawRecords.shrink(0);
+    gp.ItemDrawNames.shrink(0);
+    gp.ItemDrawFrame = frame;
+}
+
+static int AppendItemDrawName(ImVector<char>& names, const char* text, const char* text_end) {
+    const int offset = names.Size;
+    const int len = (int)(text_end - text);
+    names.resize(offset + len + 1);
+    memcpy(names.Data + offset, text, (size_t)len);
+    names[offset + len] = 0;
+    return offset;
+}
+
+// Items write triangles to the plot's 3D draw list and text to the window draw list, both are counted
+static void BeginItemDrawRecord(ImPlot3DContext& gp, const char* label_id, ImGuiID id) {
+    UpdateItemDrawStats(gp);
+    const ImPlot3DPlot& plot = *gp.CurrentPlot;
+    const char* title = plot.Title.c_str();
+    const ImDrawList& draw_list = *GetPlotDrawList();
+    ImPlot3DItemDrawRecord record;
+    record.ID = id;
+    record.PlotTitleOffset = AppendItemDrawName(gp.ItemDrawNames, title, ImGui::FindRenderedTextEnd(title));
+    record.LabelOffset = AppendItemDrawName(gp.ItemDrawNames, label_id, ImGui::FindRenderedTextEnd(label_id));
+    record.VtxCount = plot.DrawList.VtxBuffer.Size + draw_list.VtxBuffer.Size;
+    record.IdxCount = plot.DrawList.IdxBuffer.Size + draw_list.IdxBuffer.Size;
+    gp.ItemDrawRecords.push_back(record);
+    gp.ItemDrawRecordOpen = true;
+}
+
+static void EndItemDrawRecord(ImPlot3DContext& gp) {
+    if (!gp.ItemDrawRecordOpen)
+        return;
+    gp.ItemDrawRecordOpen = false;
+    const ImPlot3DPlot& plot = *gp.CurrentPlot;
+    const ImDrawList& draw_list = *GetPlotDrawList();
+    ImPlot3DItemDrawRecord& record = gp.ItemDrawRecords.back();
+    record.VtxCount = plot.DrawList.VtxBuffer.Size + draw_list.VtxBuffer.Size - record.VtxCount;
+    record.IdxCount = plot.DrawList.IdxBuffer.Size + draw_list.IdxBuffer.Size - record.IdxCount;
+}
+
+const ImPlot3DItemDrawStats* GetItemDrawStats(int* count) {
+    IM_ASSERT_USER_ERROR(GImPlot3D != nullptr, "No current context. Did you call ImPlot3D::CreateContext() or ImPlot3D::SetCurrentContext()?");
+    ImPlot3DContext& gp = *GImPlot3D;
+    UpdateItemDrawStats(gp);
+    if (count != nullptr)
+        *count = gp.ItemDrawStats.Size;
+    return gp.ItemDrawStats.Data;
+}
+
+void GcItemGeometries() {
+    ImPlot3DContext& gp = *GImPlot3D;
+    const int frame = ImGui::GetFrameCount();
+    if (gp.ItemGeometryGcFrame == frame)
+        return;
+    gp.ItemGeometryGcFrame = frame;
+    for (int n = 0; n < gp.ItemGeometries.GetMapSize(); n++) {
+        ImPlot3DItemGeometry* geom = gp.ItemGeometries.TryGetMapData(n);
+        if (geom != nullptr && frame - geom->LastFrame > IMPLOT3D_ITEM_GEOMETRY_GC_FRAMES)
+            gp.ItemGeometries.Remove(geom->ID, geom);
+    }
+}
+
+// Fills key with the state of the current item, after BeginItem resolved its style
+static void BuildItemGeometryKey(ImPlot3DContext& gp, ImPlot3DItemFlags flags, ImPlot3DItemGeometryKey& key) {
+    const ImPlot3DPlot& plot = *gp.CurrentPlot;
+    const ImPlot3DNextItemData& n = gp.NextItemData;
+    key.DataVersion = n.DataVersion;
+    key.Flags = flags;
+    key.Rotation = plot.Rotation;
+    for (int i = 0; i < 3; i++) {
+        key.Range[i] = plot.Axes[i].Range;
+        key.AxisFlags[i] = plot.Axes[i].Flags;
+    }
+    key.BoxScale = plot.BoxScale;
+    key.PlotRect = plot.PlotRect;
+    for (int i = 0; i < 4; i++)
+        key.Colors[i] = n.Colors[i];
+    key.LineWeight = n.LineWeight;
+    key.MarkerSize = n.MarkerSize;
+    key.MarkerWeight = n.MarkerWeight;
+    key.Marker = n.Marker;
+    key.Colormap = gp.Style.Colormap;
+    key.Alpha = ImGui::GetStyle().Alpha;
+    key.DrawListFlags = plot.DrawList._Flags;
+}
+
+// Appends cached triangles to the 3D draw list, they are depth sorted with the rest at EndPlot
+static void ReplayItemGeometry(const ImPlot3DItemGeometry& geom, ImDrawList3D& draw_list_3d) {
+    const int vtx_count = geom.VtxBuffer.Size;
+    const int idx_count = geom.IdxBuffer.Size;
+    draw_list_3d.PrimReserve(idx_count, vtx_count);
+    const unsigned int vtx_base = draw_list_3d._VtxCurrentIdx;
+    memcpy(draw_list_3d._VtxWritePtr, geom.VtxBuffer.Data, (size_t)vtx_count * sizeof(ImDrawVert));
+    for (int i = 0; i < idx_count; i++)
+        draw_list_3d._IdxWritePtr[i] = (ImDrawIdx)(vtx_base + geom.IdxBuffer[i]);
+    memcpy(draw_list_3d._ZWritePtr, geom.ZBuffer.Data, (size_t)geom.ZBuffer.Size * sizeof(float));
+    draw_list_3d._VtxWritePtr += vtx_count;
+    draw_list_3d._IdxWritePtr += idx_count;
+    draw_list_3d._ZWritePtr += geom.ZBuffer.Size;
+    draw_list_3d._VtxCurrentIdx += (unsigned int)vtx_count;
+}
+
+// Replays the cached triangles of the current item and returns true if the item has a data version and nothing else
+// it depends on changed. Otherwise starts recording what the item draws
+static bool BeginItemGeometry(ImPlot3DItemFlags flags) {
+    ImPlot3DContext& gp = *GImPlot3D;
+    gp.ItemGeometryRecordID = 0;
+    if (!gp.NextItemData.HasDataVersion)
+        return false;
+    const int frame = ImGui::GetFrameCount();
+    ImPlot3DPlot& plot = *gp.CurrentPlot;
+    const ImGuiID id = ImHashData(&plot.ID, sizeof(ImGuiID), gp.CurrentItem->ID);
+    ImPlot3DItemGeometry& geom = *gp.ItemGeometries.GetOrAddByKey(id);
+    geom.ID = id;
+    geom.LastFrame = frame;
+    ImPlot3DItemGeometryKey key;
+    BuildItemGeometryKey(gp, flags, key);
+    if (geom.Valid && memcmp(&key, &geom.Key, sizeof(key)) == 0) {
+        ReplayItemGeometry(geom, plot.DrawList);
+        return true;
+    }
+    memcpy((void*)&geom.Key, &key, sizeof(key));
+    geom.Valid = false;
+    geom.VtxStart = plot.DrawList.VtxBuffer.Size;
+    geom.IdxStart = plot.DrawList.IdxBuffer.Size;
+    geom.ZStart = plot.DrawList.ZBuffer.Size;
+    geom.VtxIdxStart = plot.DrawList._VtxCurrentIdx;
+    geom.WindowVtxStart = GetPlotDrawList()->VtxBuffer.Size;
+    geom.TextureCount = plot.DrawList._TextureBuffer.Size;
+    gp.ItemGeometryRecordID = id;
+    return false;
+}
+
+// Copies what the current item added to the 3D draw list into its cache entry
+static void EndItemGeometry(ImPlot3DContext& gp) {
+    if (gp.ItemGeometryRecordID == 0)
+        return;
+    ImPlot3DItemGeometry* geom = gp.ItemGeometries.GetByKey(gp.ItemGeometryRecordID);
+    gp.ItemGeometryRecordID = 0;
+    if (geom == nullptr)
+        return;
+    const ImDrawList3D& draw_list_3d = gp.CurrentPlot->DrawList;
+    const int vtx_count = draw_list_3d.VtxBuffer.Size - geom->VtxStart;
+    const int idx_count = draw_list_3d.IdxBuffer.Size - geom->IdxStart;
+    const int z_count = draw_list_3d.ZBuffer.Size - geom->ZStart;
+    if (vtx_count > IMPLOT3D_ITEM_GEOMETRY_MAX_VTX || GetPlotDrawList()->VtxBuffer.Size != geom->WindowVtxStart ||
+        draw_list_3d._TextureBuffer.Size != geom->TextureCount) {
+        geom->VtxBuffer.clear();
+        geom->IdxBuffer.clear();
+        geom->ZBuffer.clear();
+        return;
+    }
+    geom->VtxBuffer.resize(vtx_count);
+    memcpy(geom->VtxBuffer.Data, draw_list_3d.VtxBuffer.Data + geom->VtxStart, (size_t)vtx_count * sizeof(ImDrawVert));
+    geom->IdxBuffer.resize(idx_count);
+    for (int i = 0; i < idx_count; i++)
+        geom->IdxBuffer[i] = (ImDrawIdx)(draw_list_3d.IdxBuffer[geom->IdxStart + i] - geom->VtxIdxStart);
+    geom->ZBuffer.resize(z_count);
+    memcpy(geom->ZBuffer.Data, draw_list_3d.ZBuffer.Data + geom->ZStart, (size_t)z_count * sizeof(float));
+    geom->Valid = true;
+}
+
 bool BeginItem(const char* label_id, ImPlot3DItemFlags flags, ImPlot3DCol recolor_from) {
     ImPlot3DContext& gp = *GImPlot3D;
     IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr, "PlotX() needs to be called between BeginPlot() and EndPlot()!");
@@ -219,6 +402,7 @@ bool BeginItem(const char* label_id, ImPlot3DItemFlags flags, ImPlot3DCol recolo
         }
     }
 
+    BeginItemDrawRecord(gp, label_id, item->ID);
     return true;
 }
 
@@ -231,6 +415,11 @@ bool BeginItemEx(const char* label_id, const _Getter& getter, ImPlot3DItemFlags
             for (int i = 0; i < getter.Count; i++)
                 plot.ExtendFit(getter(i));
         }
+        // Unchanged triangles were replayed from the cache, nothing is left to render
+        if (BeginItemGeometry(flags)) {
+            EndItem();
+            return false;
+        }
         return true;
     }
     return false;
@@ -238,6 +427,8 @@ bool BeginItemEx(const char* label_id, const _Getter& getter, ImPlot3DItemFlags
 
 void EndItem() {
     ImPlot3DContext& gp = *GImPlot3D;
+    EndItemGeometry(gp);
+    EndItemDrawRecord(gp);
     gp.NextItemData.Reset();
     gp.CurrentItem = nullptr;
 }
@@ -303,6 +494,12 @@ void SetNextMarkerStyle(ImPlot3DMarker marker, float size, const ImVec4& fill, f
     n.MarkerWeight = weight;
 }
 
+void SetNextItemDataVersion(ImU64 version) {
+    ImPlot3DContext& gp = *GImPlot3D;
+    gp.NextItemData.HasDataVersion = true;
+    gp.NextItemData.DataVersion = version;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Draw Utils
 //-----------------------------------------------------------------------------
@@ -620,6 +817,82 @@ template <class _Getter> struct RendererTriangleFill : RendererBase {
     const ImU32 Col;
 };
 
+template <class _Getter> struct RendererTriangleFillColormap : RendererBase {
+    RendererTriangleFillColormap(const _Getter& getter, const float* values, float scale_min, float scale_max)
+        : RendererBase(getter.Count / 3, 3, 3), Getter(getter), Values(values), ScaleMin(scale_min),
+          ScaleInv(scale_max > scale_min ? 1.0f / (scale_max - scale_min) : 0.0f) {}
+
+    void Init(ImDrawList3D& draw_list_3d) const {
+        UV = draw_list_3d._SharedData->TexUvWhitePixel;
+
+        // Sample the interpolated colormap table directly instead of calling SampleColormap per vertex
+        const ImPlot3DContext& gp = *GImPlot3D;
+        const ImPlot3DColormap cmap = gp.Style.Colormap;
+        Table = gp.ColormapData.GetTable(cmap);
+        TableSize = gp.ColormapData.GetTableSize(cmap);
+        Qual = gp.ColormapData.IsQual(cmap);
+        Alpha = gp.NextItemData.FillAlpha;
+    }
+
+    IMPLOT3D_INLINE ImU32 GetVertexColor(unsigned int vi) const {
+        // NaN values map to the start of the colormap
+        float t = (Values[vi] - ScaleMin) * ScaleInv;
+        t = t > 0.0f ? (t < 1.0f ? t : 1.0f) : 0.0f;
+        int idx = Qual ? ImMin((int)(TableSize * t), TableSize - 1) : (int)((TableSize - 1) * t + 0.5f);
+        return Alpha < 1.0f ? ImAlphaU32(Table[idx], Alpha) : Table[idx];
+    }
+
+    IMPLOT3D_INLINE bool Render(ImDrawList3D& draw_list_3d, const ImPlot3DBox& cull_box, int prim) const {
+        unsigned int vi[3];
+        vi[0] = Getter.Idx[3 * prim];
+        vi[1] = Getter.Idx[3 * prim + 1];
+        vi[2] = Getter.Idx[3 * prim + 2];
+
+        ImPlot3DPoint p_plot[3];
+        p_plot[0] = Getter.Vtx[vi[0]];
+        p_plot[1] = Getter.Vtx[vi[1]];
+        p_plot[2] = Getter.Vtx[vi[2]];
+
+        // Check if the triangle is outside the culling box
+        if (!cull_box.Contains(p_plot[0]) && !cull_box.Contains(p_plot[1]) && !cull_box.Contains(p_plot[2]))
+            return false;
+
+        // Project the triangle vertices to screen space and write one colormap color per vertex
+        for (int i = 0; i < 3; i++) {
+            ImVec2 p = PlotToPixels(p_plot[i]);
+            draw_list_3d._VtxWritePtr[i].pos.x = p.x;
+            draw_list_3d._VtxWritePtr[i].pos.y = p.y;
+            draw_list_3d._VtxWritePtr[i].uv = UV;
+            draw_list_3d._VtxWritePtr[i].col = GetVertexColor(vi[i]);
+        }
+        draw_list_3d._VtxWritePtr += 3;
+
+        // 3 indices per triangle
+        draw_list_3d._IdxWritePtr[0] = (ImDrawIdx)(draw_list_3d._VtxCurrentIdx);
+        draw_list_3d._IdxWritePtr[1] = (ImDrawIdx)(draw_list_3d._VtxCurrentIdx + 1);
+        draw_list_3d._IdxWritePtr[2] = (ImDrawIdx)(draw_list_3d._VtxCurrentIdx + 2);
+        draw_list_3d._IdxWritePtr += 3;
+        // 1 Z per triangle
+        draw_list_3d._ZWritePtr[0] = GetPointDepth((p_plot[0] + p_plot[1] + p_plot[2]) / 3);
+        draw_list_3d._ZWritePtr++;
+
+        // Update vertex count
+        draw_list_3d._VtxCurrentIdx += 3;
+
+        return true;
+    }
+
+    const _Getter& Getter;
+    const float* Values;
+    const float ScaleMin;
+    const float ScaleInv;
+    mutable ImVec2 UV;
+    mutable const ImU32* Table;
+    mutable int TableSize;
+    mutable bool Qual;
+    mutable float Alpha;
+};
+
 template <class _Getter> struct RendererQuadFill : RendererBase {
     RendererQuadFill(const _Getter& getter, ImU32 col) : RendererBase(getter.Count / 4, 6, 4), Getter(getter), Col(col) {}
 
@@ -1401,6 +1674,47 @@ void PlotMesh(const char* label_id, const ImPlot3DPoint* vtx, const unsigned int
     }
 }
 
+void PlotMesh(const char* label_id, const ImPlot3DPoint* vtx, const unsigned int* idx, const float* values, int vtx_count, int idx_count,
+              double scale_min, double scale_max, ImPlot3DMeshFlags flags) {
+    Getter3DPoints getter(vtx, vtx_count);                     // Get vertices
+    GetterMeshTriangles getter_triangles(vtx, idx, idx_count); // Get triangle vertices
+    if (BeginItemEx(label_id, getter, flags, ImPlot3DCol_Fill)) {
+        const ImPlot3DNextItemData& n = GetItemData();
+
+        // Render fill, colored by the scalar value of each vertex
+        if (getter.Count >= 3 && n.RenderFill) {
+            if (scale_min == 0.0 && scale_max == 0.0) {
+                float min = FLT_MAX;
+                float max = -FLT_MAX;
+                for (int i = 0; i < vtx_count; i++) {
+                    if (ImNanOrInf(values[i]))
+                        continue;
+                    min = ImMin(min, values[i]);
+                    max = ImMax(max, values[i]);
+                }
+                scale_min = min;
+                scale_max = max;
+            }
+            RenderPrimitives<RendererTriangleFillColormap>(getter_triangles, values, (float)scale_min, (float)scale_max);
+        }
+
+        // Render lines
+        if (getter.Count >= 2 && n.RenderLine && !n.IsAutoLine) {
+            const ImU32 col_line = ImGui::GetColorU32(n.Colors[ImPlot3DCol_Line]);
+            RenderPrimitives<RendererLineSegments>(GetterTriangleLines<GetterMeshTriangles>(getter_triangles), col_line, n.LineWeight);
+        }
+
+        // Render markers
+        if (n.Marker != ImPlot3DMarker_None) {
+            const ImU32 col_line = ImGui::GetColorU32(n.Colors[ImPlot3DCol_MarkerOutline]);
+            const ImU32 col_fill = ImGui::GetColorU32(n.Colors[ImPlot3DCol_MarkerFill]);
+            RenderMarkers(getter, n.Marker, n.MarkerSize, n.RenderMarkerFill, col_fill, n.RenderMarkerLine, col_line, n.MarkerWeight);
+        }
+
+        EndItem();
+    }
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] PlotImage
 //-----------------------------------------------------------------------------
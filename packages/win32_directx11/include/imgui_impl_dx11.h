@@ -33,6 +33,26 @@ IMGUI_IMPL_API void     ImGui_ImplDX11_RenderDrawData(ImDrawData* draw_data);
 IMGUI_IMPL_API bool     ImGui_ImplDX11_CreateDeviceObjects();
 IMGUI_IMPL_API void     ImGui_ImplDX11_InvalidateDeviceObjects();
 
+// Ring buffer capacity, the number of times a vertex/index buffer was (re)created since ImGui_ImplDX11_Init(),
+// and how much geometry the last frame uploaded or reused from the buffers of unchanged large draw lists.
+struct ImGui_ImplDX11_BufferStats
+{
+    int                         VertexBufferSize;       // Ring capacity in vertices
+    int                         IndexBufferSize;        // Ring capacity in indices
+    int                         VertexBufferReallocs;
+    int                         IndexBufferReallocs;
+    int                         RetainedListCount;      // Draw lists with their own buffers
+    int                         UploadedVtxCount;
+    int                         ReusedVtxCount;
+};
+IMGUI_IMPL_API void     ImGui_ImplDX11_GetBufferStats(ImGui_ImplDX11_BufferStats* out_stats);
+
+// User textures written from the CPU. 'pixels' are RGBA8 in IM_COL32 layout, 'width' pixels per row, and are copied.
+// UpdateTexture() must be called with the size the texture was created with. The returned ImTextureID is an 'ID3D11ShaderResourceView*'.
+IMGUI_IMPL_API ImTextureID ImGui_ImplDX11_CreateTexture(const ImU32* pixels, int width, int height);
+IMGUI_IMPL_API void     ImGui_ImplDX11_UpdateTexture(ImTextureID tex_id, const ImU32* pixels, int width, int height);
+IMGUI_IMPL_API void     ImGui_ImplDX11_DestroyTexture(ImTextureID tex_id);
+
 // [BETA] Selected render state data shared with callbacks.
 // This is temporarily stored in GetPlatformIO().Renderer_RenderState during the ImGui_ImplDX11_RenderDrawData() call.
 // (Please open an issue if you feel you need access to more data)
@@ -0,0 +1,36 @@
+// dear imgui: Platform Backend without any window or OS input, for headless runs
+// This needs to be used along with a Renderer Backend (e.g. Soft)
+// Display size and time are driven by the caller, input comes from a script that is replayed frame by frame.
+
+// Implemented features:
+//  [X] Platform: Fixed display size and delta time, for reproducible frames.
+//  [X] Platform: Scripted mouse, keyboard and text input.
+//  [ ] Platform: Clipboard (kept in memory only), mouse cursor shapes, gamepad, IME.
+
+// Script format: one event per line, blank lines and lines starting with '#' are ignored.
+//   <frame> mouse <x> <y>              move the mouse
+//   <frame> down <button>              press a mouse button (0 = left, 1 = right, 2 = middle)
+//   <frame> up <button>                release a mouse button
+//   <frame> wheel <dx> <dy>            scroll
+//   <frame> key <name> <down|up>       key event, <name> as returned by ImGui::GetKeyName() (e.g. Enter, LeftCtrl, A)
+//   <frame> text <utf-8 text>          text input, rest of the line
+//   <frame> resize <width> <height>    change the display size
+// Events are queued at the start of the given frame (0 = first call to ImGui_ImplNull_NewFrame()), in file order.
+
+#pragma once
+#include "imgui.h"      // IMGUI_IMPL_API
+#ifndef IMGUI_DISABLE
+
+IMGUI_IMPL_API bool     ImGui_ImplNull_Init(int width, int height);
+IMGUI_IMPL_API void     ImGui_ImplNull_Shutdown();
+IMGUI_IMPL_API void     ImGui_ImplNull_NewFrame(float delta_time = 1.0f / 60.0f);
+
+// Append events from a script file or from a string. Return false and fill 'out_error' (if not null) on the first malformed line.
+IMGUI_IMPL_API bool     ImGui_ImplNull_LoadScript(const char* filename, char* out_error = nullptr, int out_error_size = 0);
+IMGUI_IMPL_API bool     ImGui_ImplNull_AddScript(const char* script, char* out_error = nullptr, int out_error_size = 0);
+
+// Frame counter used to schedule script events, and the last frame that has an event
+IMGUI_IMPL_API int      ImGui_ImplNull_GetFrame();
+IMGUI_IMPL_API int      ImGui_ImplNull_GetLastScriptedFrame();
+
+#endif // #ifndef IMGUI_DISABLE
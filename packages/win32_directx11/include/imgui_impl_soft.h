@@ -0,0 +1,49 @@
+// dear imgui: Renderer Backend for a CPU software rasterizer
+// This needs to be used along with a Platform Backend (e.g. Null for headless runs)
+// Renders ImDrawData into a RGBA8 framebuffer in system memory, so the UI can run and be image-diffed on machines without a GPU.
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Use the value returned by ImGui_ImplSoft_CreateTexture() as ImTextureID.
+//  [X] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset).
+//  [X] Renderer: Expose selected render state for draw callbacks to use. Access in '(ImGui_ImplXXXX_RenderState*)GetPlatformIO().Renderer_RenderState'.
+// Notes:
+//  - Textures are sampled with nearest filtering and clamped addressing.
+//  - The framebuffer is split in tiles; triangles are binned per tile and tiles are rasterized in parallel. Each tile processes its
+//    triangles in submission order, so the output does not depend on the thread count.
+
+#pragma once
+#include "imgui.h"      // IMGUI_IMPL_API
+#ifndef IMGUI_DISABLE
+
+// Follow "Getting Started" link and check examples/ folder to learn about using backends!
+// thread_count = 0 uses one thread per hardware core.
+IMGUI_IMPL_API bool     ImGui_ImplSoft_Init(int width, int height, int thread_count = 0);
+IMGUI_IMPL_API void     ImGui_ImplSoft_Shutdown();
+IMGUI_IMPL_API void     ImGui_ImplSoft_NewFrame();
+IMGUI_IMPL_API void     ImGui_ImplSoft_RenderDrawData(ImDrawData* draw_data);
+
+// Framebuffer access. Pixels are stored row by row in IM_COL32 layout (R in the lowest byte), 'width' pixels per row.
+IMGUI_IMPL_API void     ImGui_ImplSoft_SetFramebufferSize(int width, int height);
+IMGUI_IMPL_API void     ImGui_ImplSoft_ClearFramebuffer(ImU32 col);
+IMGUI_IMPL_API const ImU32* ImGui_ImplSoft_GetFramebuffer(int* out_width, int* out_height);
+
+// User textures. 'pixels' are RGBA8 in IM_COL32 layout and are copied.
+IMGUI_IMPL_API ImTextureID ImGui_ImplSoft_CreateTexture(const ImU32* pixels, int width, int height);
+IMGUI_IMPL_API void     ImGui_ImplSoft_UpdateTexture(ImTextureID tex_id, const ImU32* pixels, int width, int height);
+IMGUI_IMPL_API void     ImGui_ImplSoft_DestroyTexture(ImTextureID tex_id);
+
+// Use if you want to rebuild the font texture without losing Dear ImGui state.
+IMGUI_IMPL_API bool     ImGui_ImplSoft_CreateDeviceObjects();
+IMGUI_IMPL_API void     ImGui_ImplSoft_InvalidateDeviceObjects();
+
+// [BETA] Selected render state data shared with callbacks.
+// This is temporarily stored in GetPlatformIO().Renderer_RenderState during the ImGui_ImplSoft_RenderDrawData() call.
+// Callbacks are executed on the calling thread after all triangles submitted before them have been rasterized.
+struct ImGui_ImplSoft_RenderState
+{
+    ImU32*                  Framebuffer;
+    int                     Width;
+    int                     Height;
+};
+
+#endif // #ifndef IMGUI_DISABLE
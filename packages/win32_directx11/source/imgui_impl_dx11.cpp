@@ -5,6 +5,7 @@
 //  [X] Renderer: User texture binding. Use 'ID3D11ShaderResourceView*' as ImTextureID. Read the FAQ about ImTextureID!
 //  [X] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset).
 //  [X] Renderer: Expose selected render state for draw callbacks to use. Access in '(ImGui_ImplXXXX_RenderState*)GetPlatformIO().Renderer_RenderState'.
+//  [X] Renderer: Vertex/index ring buffers shared by several frames, large unchanged draw lists are not uploaded again.
 
 // You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
 // Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
@@ -16,6 +17,9 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2025-06-26: DirectX11: Added ImGui_ImplDX11_CreateTexture(), ImGui_ImplDX11_UpdateTexture() and ImGui_ImplDX11_DestroyTexture() for RGBA8 user textures that are rewritten from the CPU.
+//  2025-06-24: DirectX11: Vertex/index buffers grow geometrically and are used as rings (WRITE_NO_OVERWRITE, WRITE_DISCARD on wrap). Draw lists with at least IMGUI_IMPL_DX11_RETAIN_MIN_VERTICES vertices get their own buffers and are only uploaded when their content hash changes.
+//  2025-06-22: DirectX11: Added ImGui_ImplDX11_GetBufferStats() to report buffer capacity and reallocation counts.
 //  2025-01-06: DirectX11: Expose VertexConstantBuffer in ImGui_ImplDX11_RenderState. Reset projection matrix in ImDrawCallback_ResetRenderState handler.
 //  2024-10-07: DirectX11: Changed default texture sampler to Clamp instead of Repeat/Wrap.
 //  2024-10-07: DirectX11: Expose selected render state in ImGui_ImplDX11_RenderState, which you can access in 'void* platform_io.Renderer_RenderState' during draw callbacks.
@@ -49,6 +53,36 @@
 #pragma comment(lib, "d3dcompiler") // Automatically link with d3dcompiler.lib as we are using D3DCompile() below.
 #endif
 
+// Number of frames of geometry the ring buffers are sized for when they grow
+#ifndef IMGUI_IMPL_DX11_RING_FRAMES
+#define IMGUI_IMPL_DX11_RING_FRAMES         3
+#endif
+// Draw lists with at least this many vertices are kept in their own buffers and skipped when unchanged
+#ifndef IMGUI_IMPL_DX11_RETAIN_MIN_VERTICES
+#define IMGUI_IMPL_DX11_RETAIN_MIN_VERTICES 65536
+#endif
+// A retained draw list that changed this many frames in a row goes through the ring buffers for a while, without hashing
+#ifndef IMGUI_IMPL_DX11_RETAIN_CHANGE_LIMIT
+#define IMGUI_IMPL_DX11_RETAIN_CHANGE_LIMIT 8
+#endif
+#define IMGUI_IMPL_DX11_RETAIN_SKIP_FRAMES  120
+
+// Buffers owned by one large draw list (matched by ImDrawList pointer, which is stable for a window)
+struct ImGui_ImplDX11_RetainedList
+{
+    const ImDrawList*           DrawList;
+    ID3D11Buffer*               pVB;
+    ID3D11Buffer*               pIB;
+    int                         VertexBufferSize;
+    int                         IndexBufferSize;
+    int                         VtxCount;           // Content currently in the buffers
+    int                         IdxCount;
+    ImU64                       Hash;
+    int                         LastFrame;          // Last frame the draw list was rendered
+    int                         ChangeStreak;       // Consecutive frames with new content
+    int                         SkipUntilFrame;     // Until then the draw list goes through the ring buffers
+};
+
 // DirectX11 data
 struct ImGui_ImplDX11_Data
 {
@@ -68,6 +102,15 @@ struct ImGui_ImplDX11_Data
     ID3D11DepthStencilState*    pDepthStencilState;
     int                         VertexBufferSize;
     int                         IndexBufferSize;
+    int                         VertexBufferReallocs;
+    int                         IndexBufferReallocs;
+    int                         VertexRingPos;      // Next free vertex in pVB, data before it may still be in use by the GPU
+    int                         IndexRingPos;
+    int                         FrameCount;
+    int                         UploadedVtxCount;   // Last frame
+    int                         ReusedVtxCount;     // Last frame
+    ImVector<ImGui_ImplDX11_RetainedList> RetainedLists;
+    ImVector<int>               ListSlots;          // Per draw list of the current frame: index into RetainedLists, or -1 for the ring
 
     ImGui_ImplDX11_Data()       { memset((void*)this, 0, sizeof(*this)); VertexBufferSize = 5000; IndexBufferSize = 10000; }
 };
@@ -142,6 +185,160 @@ static void ImGui_ImplDX11_SetupRenderState(ImDrawData* draw_data, ID3D11DeviceC
     device_ctx->RSSetState(bd->pRasterizerState);
 }
 
+static void ImGui_ImplDX11_BindBuffers(ID3D11DeviceContext* device_ctx, ID3D11Buffer* vb, ID3D11Buffer* ib)
+{
+    unsigned int stride = sizeof(ImDrawVert);
+    unsigned int offset = 0;
+    device_ctx->IASetVertexBuffers(0, 1, &vb, &stride, &offset);
+    device_ctx->IASetIndexBuffer(ib, sizeof(ImDrawIdx) == 2 ? DXGI_FORMAT_R16_UINT : DXGI_FORMAT_R32_UINT, 0);
+}
+
+static bool ImGui_ImplDX11_CreateDynamicBuffer(ID3D11Device* device, int size, int elem_size, UINT bind_flags, ID3D11Buffer** out_buffer)
+{
+    D3D11_BUFFER_DESC desc = {};
+    desc.Usage = D3D11_USAGE_DYNAMIC;
+    desc.ByteWidth = (UINT)size * (UINT)elem_size;
+    desc.BindFlags = bind_flags;
+    desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+    desc.MiscFlags = 0;
+    return device->CreateBuffer(&desc, nullptr, out_buffer) >= 0;
+}
+
+// Makes room for 'count' elements at *ring_pos, wrapping to the start of the buffer when the tail is too short.
+// A buffer too small for one frame is recreated with room for several frames, and at least twice its previous size.
+static bool ImGui_ImplDX11_ReserveRing(ImGui_ImplDX11_Data* bd, ID3D11Buffer** buffer, int* size, int* ring_pos, int* realloc_count, int count, int elem_size, UINT bind_flags)
+{
+    if (*buffer == nullptr || *size < count)
+    {
+        if (*buffer) { (*buffer)->Release(); *buffer = nullptr; }
+        if (*size < count)
+            *size = (*size * 2 > count * IMGUI_IMPL_DX11_RING_FRAMES) ? *size * 2 : count * IMGUI_IMPL_DX11_RING_FRAMES;
+        (*realloc_count)++;
+        *ring_pos = 0;
+        return ImGui_ImplDX11_CreateDynamicBuffer(bd->pd3dDevice, *size, elem_size, bind_flags, buffer);
+    }
+    if (*ring_pos + count > *size)
+        *ring_pos = 0;
+    return true;
+}
+
+// Hash of the vertex and index data. Four independent lanes keep it close to memory bandwidth.
+static ImU64 ImGui_ImplDX11_HashBytes(const void* data, size_t size, ImU64 seed)
+{
+    const ImU64 k = 0x9E3779B97F4A7C15ULL;
+    const ImU64 m = 0xFF51AFD7ED558CCDULL;
+    ImU64 h0 = seed, h1 = seed ^ k, h2 = seed + k, h3 = seed - k;
+    const unsigned char* p = (const unsigned char*)data;
+    for (size_t blocks = size / 32; blocks > 0; blocks--, p += 32)
+    {
+        ImU64 w[4];
+        memcpy(w, p, sizeof(w));
+        h0 = (h0 ^ w[0]) * m; h0 ^= h0 >> 29;
+        h1 = (h1 ^ w[1]) * m; h1 ^= h1 >> 29;
+        h2 = (h2 ^ w[2]) * m; h2 ^= h2 >> 29;
+        h3 = (h3 ^ w[3]) * m; h3 ^= h3 >> 29;
+    }
+    ImU64 h = (h0 * 31 + h1) * 31 + h2 * 7 + h3 + (ImU64)size * k;
+    for (size_t rest = size % 32; rest > 0; rest--, p++)
+        h = (h ^ *p) * m;
+    h ^= h >> 32;
+    return h;
+}
+
+static int ImGui_ImplDX11_FindRetainedList(ImGui_ImplDX11_Data* bd, const ImDrawList* draw_list)
+{
+    for (int i = 0; i < bd->RetainedLists.Size; i++)
+        if (bd->RetainedLists[i].DrawList == draw_list)
+            return i;
+    ImGui_ImplDX11_RetainedList entry;
+    memset((void*)&entry, 0, sizeof(entry));
+    entry.DrawList = draw_list;
+    bd->RetainedLists.push_back(entry);
+    return bd->RetainedLists.Size - 1;
+}
+
+// Uploads the draw list into its own buffers unless the content is unchanged.
+// Returns false when the draw list should go through the ring buffers this frame.
+static bool ImGui_ImplDX11_UpdateRetainedList(ImGui_ImplDX11_Data* bd, ImGui_ImplDX11_RetainedList& entry, const ImDrawList* draw_list)
+{
+    entry.LastFrame = bd->FrameCount;
+    if (bd->FrameCount < entry.SkipUntilFrame)
+        return false;
+
+    const int vtx_count = draw_list->VtxBuffer.Size;
+    const int idx_count = draw_list->IdxBuffer.Size;
+    ImU64 hash = ImGui_ImplDX11_HashBytes(draw_list->VtxBuffer.Data, (size_t)vtx_count * sizeof(ImDrawVert), 0);
+    hash = ImGui_ImplDX11_HashBytes(draw_list->IdxBuffer.Data, (size_t)idx_count * sizeof(ImDrawIdx), hash);
+    if (entry.pVB && entry.pIB && entry.VtxCount == vtx_count && entry.IdxCount == idx_count && entry.Hash == hash)
+    {
+        entry.ChangeStreak = 0;
+        bd->ReusedVtxCount += vtx_count;
+        return true;
+    }
+
+    // Content that changes every frame (e.g. a rotating 3D view) gains nothing from its own buffers
+    if (++entry.ChangeStreak >= IMGUI_IMPL_DX11_RETAIN_CHANGE_LIMIT)
+    {
+        entry.ChangeStreak = 0;
+        entry.SkipUntilFrame = bd->FrameCount + IMGUI_IMPL_DX11_RETAIN_SKIP_FRAMES;
+        if (entry.pVB) { entry.pVB->Release(); entry.pVB = nullptr; }
+        if (entry.pIB) { entry.pIB->Release(); entry.pIB = nullptr; }
+        entry.VertexBufferSize = entry.IndexBufferSize = 0;
+        return false;
+    }
+
+    if (entry.pVB == nullptr || entry.VertexBufferSize < vtx_count)
+    {
+        if (entry.pVB) { entry.pVB->Release(); entry.pVB = nullptr; }
+        entry.VertexBufferSize = (entry.VertexBufferSize * 3 / 2 > vtx_count) ? entry.VertexBufferSize * 3 / 2 : vtx_count;
+        bd->VertexBufferReallocs++;
+        if (!ImGui_ImplDX11_CreateDynamicBuffer(bd->pd3dDevice, entry.VertexBufferSize, sizeof(ImDrawVert), D3D11_BIND_VERTEX_BUFFER, &entry.pVB))
+            return false;
+    }
+    if (entry.pIB == nullptr || entry.IndexBufferSize < idx_count)
+    {
+        if (entry.pIB) { entry.pIB->Release(); entry.pIB = nullptr; }
+        entry.IndexBufferSize = (entry.IndexBufferSize * 3 / 2 > idx_count) ? entry.IndexBufferSize * 3 / 2 : idx_count;
+        bd->IndexBufferReallocs++;
+        if (!ImGui_ImplDX11_CreateDynamicBuffer(bd->pd3dDevice, entry.IndexBufferSize, sizeof(ImDrawIdx), D3D11_BIND_INDEX_BUFFER, &entry.pIB))
+            return false;
+    }
+
+    ID3D11DeviceContext* device = bd->pd3dDeviceContext;
+    D3D11_MAPPED_SUBRESOURCE vtx_resource, idx_resource;
+    if (device->Map(entry.pVB, 0, D3D11_MAP_WRITE_DISCARD, 0, &vtx_resource) != S_OK)
+        return false;
+    if (device->Map(entry.pIB, 0, D3D11_MAP_WRITE_DISCARD, 0, &idx_resource) != S_OK)
+    {
+        device->Unmap(entry.pVB, 0);
+        return false;
+    }
+    memcpy(vtx_resource.pData, draw_list->VtxBuffer.Data, (size_t)vtx_count * sizeof(ImDrawVert));
+    memcpy(idx_resource.pData, draw_list->IdxBuffer.Data, (size_t)idx_count * sizeof(ImDrawIdx));
+    device->Unmap(entry.pVB, 0);
+    device->Unmap(entry.pIB, 0);
+    entry.VtxCount = vtx_count;
+    entry.IdxCount = idx_count;
+    entry.Hash = hash;
+    bd->UploadedVtxCount += vtx_count;
+    return true;
+}
+
+// Frees the buffers of draw lists that were not rendered last frame (closed windows, lists that shrank).
+// Called before the slots of the new frame are assigned, as erasing shifts the indices.
+static void ImGui_ImplDX11_ReleaseUnusedRetainedLists(ImGui_ImplDX11_Data* bd)
+{
+    for (int i = bd->RetainedLists.Size - 1; i >= 0; i--)
+    {
+        ImGui_ImplDX11_RetainedList& entry = bd->RetainedLists[i];
+        if (entry.LastFrame == bd->FrameCount)
+            continue;
+        if (entry.pVB) entry.pVB->Release();
+        if (entry.pIB) entry.pIB->Release();
+        bd->RetainedLists.erase(bd->RetainedLists.Data + i);
+    }
+}
+
 // Render function
 void ImGui_ImplDX11_RenderDrawData(ImDrawData* draw_data)
 {
@@ -152,51 +349,65 @@ void ImGui_ImplDX11_RenderDrawData(ImDrawData* draw_data)
     ImGui_ImplDX11_Data* bd = ImGui_ImplDX11_GetBackendData();
     ID3D11DeviceContext* device = bd->pd3dDeviceContext;
 
-    // Create and grow vertex/index buffers if needed
-    if (!bd->pVB || bd->VertexBufferSize < draw_data->TotalVtxCount)
+    // Large draw lists use their own buffers, which are left untouched while the content hash does not change
+    ImGui_ImplDX11_ReleaseUnusedRetainedLists(bd);
+    bd->FrameCount++;
+    bd->UploadedVtxCount = bd->ReusedVtxCount = 0;
+    bd->ListSlots.resize(draw_data->CmdListsCount);
+    int ring_vtx_count = 0;
+    int ring_idx_count = 0;
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
     {
-        if (bd->pVB) { bd->pVB->Release(); bd->pVB = nullptr; }
-        bd->VertexBufferSize = draw_data->TotalVtxCount + 5000;
-        D3D11_BUFFER_DESC desc = {};
-        desc.Usage = D3D11_USAGE_DYNAMIC;
-        desc.ByteWidth = bd->VertexBufferSize * sizeof(ImDrawVert);
-        desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
-        desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
-        desc.MiscFlags = 0;
-        if (bd->pd3dDevice->CreateBuffer(&desc, nullptr, &bd->pVB) < 0)
-            return;
+        const ImDrawList* draw_list = draw_data->CmdLists[n];
+        int slot = (draw_list->VtxBuffer.Size >= IMGUI_IMPL_DX11_RETAIN_MIN_VERTICES) ? ImGui_ImplDX11_FindRetainedList(bd, draw_list) : -1;
+        if (slot >= 0 && !ImGui_ImplDX11_UpdateRetainedList(bd, bd->RetainedLists[slot], draw_list))
+            slot = -1;
+        bd->ListSlots[n] = slot;
+        if (slot < 0)
+        {
+            ring_vtx_count += draw_list->VtxBuffer.Size;
+            ring_idx_count += draw_list->IdxBuffer.Size;
+        }
     }
-    if (!bd->pIB || bd->IndexBufferSize < draw_data->TotalIdxCount)
+
+    // Append the remaining geometry to the ring buffers
+    int ring_vtx_base = 0;
+    int ring_idx_base = 0;
+    if (ring_vtx_count > 0 && ring_idx_count > 0)
     {
-        if (bd->pIB) { bd->pIB->Release(); bd->pIB = nullptr; }
-        bd->IndexBufferSize = draw_data->TotalIdxCount + 10000;
-        D3D11_BUFFER_DESC desc = {};
-        desc.Usage = D3D11_USAGE_DYNAMIC;
-        desc.ByteWidth = bd->IndexBufferSize * sizeof(ImDrawIdx);
-        desc.BindFlags = D3D11_BIND_INDEX_BUFFER;
-        desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
-        if (bd->pd3dDevice->CreateBuffer(&desc, nullptr, &bd->pIB) < 0)
+        if (!ImGui_ImplDX11_ReserveRing(bd, &bd->pVB, &bd->VertexBufferSize, &bd->VertexRingPos, &bd->VertexBufferReallocs, ring_vtx_count, sizeof(ImDrawVert), D3D11_BIND_VERTEX_BUFFER) ||
+            !ImGui_ImplDX11_ReserveRing(bd, &bd->pIB, &bd->IndexBufferSize, &bd->IndexRingPos, &bd->IndexBufferReallocs, ring_idx_count, sizeof(ImDrawIdx), D3D11_BIND_INDEX_BUFFER))
             return;
-    }
+        ring_vtx_base = bd->VertexRingPos;
+        ring_idx_base = bd->IndexRingPos;
 
-    // Upload vertex/index data into a single contiguous GPU buffer
-    D3D11_MAPPED_SUBRESOURCE vtx_resource, idx_resource;
-    if (device->Map(bd->pVB, 0, D3D11_MAP_WRITE_DISCARD, 0, &vtx_resource) != S_OK)
-        return;
-    if (device->Map(bd->pIB, 0, D3D11_MAP_WRITE_DISCARD, 0, &idx_resource) != S_OK)
-        return;
-    ImDrawVert* vtx_dst = (ImDrawVert*)vtx_resource.pData;
-    ImDrawIdx* idx_dst = (ImDrawIdx*)idx_resource.pData;
-    for (int n = 0; n < draw_data->CmdListsCount; n++)
-    {
-        const ImDrawList* draw_list = draw_data->CmdLists[n];
-        memcpy(vtx_dst, draw_list->VtxBuffer.Data, draw_list->VtxBuffer.Size * sizeof(ImDrawVert));
-        memcpy(idx_dst, draw_list->IdxBuffer.Data, draw_list->IdxBuffer.Size * sizeof(ImDrawIdx));
-        vtx_dst += draw_list->VtxBuffer.Size;
-        idx_dst += draw_list->IdxBuffer.Size;
+        // Start of a ring (or a new buffer): discard, so the driver hands out fresh memory. Otherwise append behind data the GPU may still read.
+        D3D11_MAPPED_SUBRESOURCE vtx_resource, idx_resource;
+        if (device->Map(bd->pVB, 0, ring_vtx_base == 0 ? D3D11_MAP_WRITE_DISCARD : D3D11_MAP_WRITE_NO_OVERWRITE, 0, &vtx_resource) != S_OK)
+            return;
+        if (device->Map(bd->pIB, 0, ring_idx_base == 0 ? D3D11_MAP_WRITE_DISCARD : D3D11_MAP_WRITE_NO_OVERWRITE, 0, &idx_resource) != S_OK)
+        {
+            device->Unmap(bd->pVB, 0);
+            return;
+        }
+        ImDrawVert* vtx_dst = (ImDrawVert*)vtx_resource.pData + ring_vtx_base;
+        ImDrawIdx* idx_dst = (ImDrawIdx*)idx_resource.pData + ring_idx_base;
+        for (int n = 0; n < draw_data->CmdListsCount; n++)
+        {
+            if (bd->ListSlots[n] >= 0)
+                continue;
+            const ImDrawList* draw_list = draw_data->CmdLists[n];
+            memcpy(vtx_dst, draw_list->VtxBuffer.Data, draw_list->VtxBuffer.Size * sizeof(ImDrawVert));
+            memcpy(idx_dst, draw_list->IdxBuffer.Data, draw_list->IdxBuffer.Size * sizeof(ImDrawIdx));
+            vtx_dst += draw_list->VtxBuffer.Size;
+            idx_dst += draw_list->IdxBuffer.Size;
+        }
+        device->Unmap(bd->pVB, 0);
+        device->Unmap(bd->pIB, 0);
+        bd->VertexRingPos += ring_vtx_count;
+        bd->IndexRingPos += ring_idx_count;
+        bd->UploadedVtxCount += ring_vtx_count;
     }
-    device->Unmap(bd->pVB, 0);
-    device->Unmap(bd->pIB, 0);
 
     // Backup DX state that will be modified to restore it afterwards (unfortunately this is very ugly looking and verbose. Close your eyes!)
     struct BACKUP_DX11_STATE
@@ -256,13 +467,24 @@ void ImGui_ImplDX11_RenderDrawData(ImDrawData* draw_data)
     platform_io.Renderer_RenderState = &render_state;
 
     // Render command lists
-    // (Because we merged all buffers into a single one, we maintain our own offset into them)
-    int global_idx_offset = 0;
-    int global_vtx_offset = 0;
+    // (Ring draw lists are packed one after the other behind ring_vtx_base/ring_idx_base, retained draw lists start at 0 in their own buffers)
+    int ring_idx_offset = ring_idx_base;
+    int ring_vtx_offset = ring_vtx_base;
+    ID3D11Buffer* bound_vb = bd->pVB;
     ImVec2 clip_off = draw_data->DisplayPos;
     for (int n = 0; n < draw_data->CmdListsCount; n++)
     {
         const ImDrawList* draw_list = draw_data->CmdLists[n];
+        const int slot = bd->ListSlots[n];
+        ID3D11Buffer* list_vb = (slot >= 0) ? bd->RetainedLists[slot].pVB : bd->pVB;
+        ID3D11Buffer* list_ib = (slot >= 0) ? bd->RetainedLists[slot].pIB : bd->pIB;
+        const int global_vtx_offset = (slot >= 0) ? 0 : ring_vtx_offset;
+        const int global_idx_offset = (slot >= 0) ? 0 : ring_idx_offset;
+        if (list_vb != bound_vb)
+        {
+            ImGui_ImplDX11_BindBuffers(device, list_vb, list_ib);
+            bound_vb = list_vb;
+        }
         for (int cmd_i = 0; cmd_i < draw_list->CmdBuffer.Size; cmd_i++)
         {
             const ImDrawCmd* pcmd = &draw_list->CmdBuffer[cmd_i];
@@ -271,9 +493,14 @@ void ImGui_ImplDX11_RenderDrawData(ImDrawData* draw_data)
                 // User callback, registered via ImDrawList::AddCallback()
                 // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
                 if (pcmd->UserCallback == ImDrawCallback_ResetRenderState)
+                {
                     ImGui_ImplDX11_SetupRenderState(draw_data, device);
+                    ImGui_ImplDX11_BindBuffers(device, list_vb, list_ib);
+                }
                 else
+                {
                     pcmd->UserCallback(draw_list, pcmd);
+                }
             }
             else
             {
@@ -293,8 +520,11 @@ void ImGui_ImplDX11_RenderDrawData(ImDrawData* draw_data)
                 device->DrawIndexed(pcmd->ElemCount, pcmd->IdxOffset + global_idx_offset, pcmd->VtxOffset + global_vtx_offset);
             }
         }
-        global_idx_offset += draw_list->IdxBuffer.Size;
-        global_vtx_offset += draw_list->VtxBuffer.Size;
+        if (slot < 0)
+        {
+            ring_idx_offset += draw_list->IdxBuffer.Size;
+            ring_vtx_offset += draw_list->VtxBuffer.Size;
+        }
     }
     platform_io.Renderer_RenderState = nullptr;
 
@@ -556,6 +786,12 @@ void    ImGui_ImplDX11_InvalidateDeviceObjects()
     if (bd->pFontSampler)           { bd->pFontSampler->Release(); bd->pFontSampler = nullptr; }
     if (bd->pIB)                    { bd->pIB->Release(); bd->pIB = nullptr; }
     if (bd->pVB)                    { bd->pVB->Release(); bd->pVB = nullptr; }
+    for (ImGui_ImplDX11_RetainedList& entry : bd->RetainedLists)
+    {
+        if (entry.pVB) entry.pVB->Release();
+        if (entry.pIB) entry.pIB->Release();
+    }
+    bd->RetainedLists.clear();
     if (bd->pBlendState)            { bd->pBlendState->Release(); bd->pBlendState = nullptr; }
     if (bd->pDepthStencilState)     { bd->pDepthStencilState->Release(); bd->pDepthStencilState = nullptr; }
     if (bd->pRasterizerState)       { bd->pRasterizerState->Release(); bd->pRasterizerState = nullptr; }
@@ -623,6 +859,85 @@ void ImGui_ImplDX11_NewFrame()
         ImGui_ImplDX11_CreateDeviceObjects();
 }
 
+void ImGui_ImplDX11_GetBufferStats(ImGui_ImplDX11_BufferStats* out_stats)
+{
+    ImGui_ImplDX11_Data* bd = ImGui_ImplDX11_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplDX11_Init()?");
+    out_stats->VertexBufferSize = bd->VertexBufferSize;
+    out_stats->IndexBufferSize = bd->IndexBufferSize;
+    out_stats->VertexBufferReallocs = bd->VertexBufferReallocs;
+    out_stats->IndexBufferReallocs = bd->IndexBufferReallocs;
+    out_stats->RetainedListCount = bd->RetainedLists.Size;
+    out_stats->UploadedVtxCount = bd->UploadedVtxCount;
+    out_stats->ReusedVtxCount = bd->ReusedVtxCount;
+}
+
+// Dynamic textures so that UpdateTexture() can rewrite them every frame with WRITE_DISCARD.
+ImTextureID ImGui_ImplDX11_CreateTexture(const ImU32* pixels, int width, int height)
+{
+    ImGui_ImplDX11_Data* bd = ImGui_ImplDX11_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplDX11_Init()?");
+    IM_ASSERT(width > 0 && height > 0);
+
+    D3D11_TEXTURE2D_DESC desc;
+    ZeroMemory(&desc, sizeof(desc));
+    desc.Width = width;
+    desc.Height = height;
+    desc.MipLevels = 1;
+    desc.ArraySize = 1;
+    desc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+    desc.SampleDesc.Count = 1;
+    desc.Usage = D3D11_USAGE_DYNAMIC;
+    desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+    desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+    ID3D11Texture2D* pTexture = nullptr;
+    D3D11_SUBRESOURCE_DATA subResource;
+    subResource.pSysMem = pixels;
+    subResource.SysMemPitch = desc.Width * 4;
+    subResource.SysMemSlicePitch = 0;
+    if (bd->pd3dDevice->CreateTexture2D(&desc, pixels ? &subResource : nullptr, &pTexture) != S_OK)
+        return (ImTextureID)0;
+
+    D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc;
+    ZeroMemory(&srvDesc, sizeof(srvDesc));
+    srvDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+    srvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
+    srvDesc.Texture2D.MipLevels = desc.MipLevels;
+    srvDesc.Texture2D.MostDetailedMip = 0;
+    ID3D11ShaderResourceView* pTextureView = nullptr;
+    bd->pd3dDevice->CreateShaderResourceView(pTexture, &srvDesc, &pTextureView);
+    pTexture->Release();
+    return (ImTextureID)pTextureView;
+}
+
+void ImGui_ImplDX11_UpdateTexture(ImTextureID tex_id, const ImU32* pixels, int width, int height)
+{
+    ImGui_ImplDX11_Data* bd = ImGui_ImplDX11_GetBackendData();
+    ID3D11ShaderResourceView* pTextureView = (ID3D11ShaderResourceView*)tex_id;
+    IM_ASSERT(bd != nullptr && pTextureView != nullptr);
+
+    ID3D11Resource* pResource = nullptr;
+    pTextureView->GetResource(&pResource);
+    D3D11_MAPPED_SUBRESOURCE mapped;
+    if (bd->pd3dDeviceContext->Map(pResource, 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped) == S_OK)
+    {
+        // Rows of the mapped texture may be padded
+        const size_t row_size = (size_t)width * sizeof(ImU32);
+        for (int y = 0; y < height; y++)
+            memcpy((char*)mapped.pData + (size_t)y * mapped.RowPitch, pixels + (size_t)y * width, row_size);
+        bd->pd3dDeviceContext->Unmap(pResource, 0);
+    }
+    pResource->Release();
+}
+
+void ImGui_ImplDX11_DestroyTexture(ImTextureID tex_id)
+{
+    ID3D11ShaderResourceView* pTextureView = (ID3D11ShaderResourceView*)tex_id;
+    if (pTextureView)
+        pTextureView->Release();
+}
+
 //-----------------------------------------------------------------------------
 
 #endif // #ifndef IMGUI_DISABLE
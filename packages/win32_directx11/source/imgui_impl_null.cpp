@@ -0,0 +1,268 @@
+// dear imgui: Platform Backend without any window or OS input, for headless runs
+// This needs to be used along with a Renderer Backend (e.g. Soft)
+// Display size and time are driven by the caller, input comes from a script that is replayed frame by frame.
+
+// Implemented features:
+//  [X] Platform: Fixed display size and delta time, for reproducible frames.
+//  [X] Platform: Scripted mouse, keyboard and text input.
+//  [ ] Platform: Clipboard (kept in memory only), mouse cursor shapes, gamepad, IME.
+
+// CHANGELOG
+//  2025-06-20: Initial version.
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_impl_null.h"
+#include "imgui_internal.h"     // ImFileLoadToMemory
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+enum ImGui_ImplNull_EventType
+{
+    ImGui_ImplNull_EventType_Mouse,
+    ImGui_ImplNull_EventType_Button,
+    ImGui_ImplNull_EventType_Wheel,
+    ImGui_ImplNull_EventType_Key,
+    ImGui_ImplNull_EventType_Text,
+    ImGui_ImplNull_EventType_Resize,
+};
+
+struct ImGui_ImplNull_Event
+{
+    int                         Frame;
+    ImGui_ImplNull_EventType    Type;
+    float                       X, Y;           // Mouse position, wheel delta or display size
+    int                         Code;           // Mouse button or ImGuiKey
+    bool                        Down;
+    int                         TextOffset;     // Into ImGui_ImplNull_Data::Text, zero terminated
+};
+
+struct ImGui_ImplNull_Data
+{
+    ImVec2                          DisplaySize;
+    int                             Frame = 0;
+    int                             NextEvent = 0;      // Events before this index have been replayed
+    ImVector<ImGui_ImplNull_Event>  Events;
+    ImVector<char>                  Text;
+};
+
+// Backend data stored in io.BackendPlatformUserData to allow support for multiple Dear ImGui contexts
+static ImGui_ImplNull_Data* ImGui_ImplNull_GetBackendData()
+{
+    return ImGui::GetCurrentContext() ? (ImGui_ImplNull_Data*)ImGui::GetIO().BackendPlatformUserData : nullptr;
+}
+
+bool ImGui_ImplNull_Init(int width, int height)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    IMGUI_CHECKVERSION();
+    IM_ASSERT(io.BackendPlatformUserData == nullptr && "Already initialized a platform backend!");
+
+    ImGui_ImplNull_Data* bd = IM_NEW(ImGui_ImplNull_Data)();
+    io.BackendPlatformUserData = (void*)bd;
+    io.BackendPlatformName = "imgui_impl_null";
+    bd->DisplaySize = ImVec2((float)width, (float)height);
+    return true;
+}
+
+void ImGui_ImplNull_Shutdown()
+{
+    ImGui_ImplNull_Data* bd = ImGui_ImplNull_GetBackendData();
+    IM_ASSERT(bd != nullptr && "No platform backend to shutdown, or already shutdown?");
+    ImGuiIO& io = ImGui::GetIO();
+    io.BackendPlatformName = nullptr;
+    io.BackendPlatformUserData = nullptr;
+    IM_DELETE(bd);
+}
+
+static const char* ImGui_ImplNull_SkipSpaces(const char* p)
+{
+    while (*p == ' ' || *p == '\t')
+        p++;
+    return p;
+}
+
+// Read one whitespace separated word into 'buf'
+static const char* ImGui_ImplNull_ReadWord(const char* p, char* buf, int buf_size)
+{
+    int len = 0;
+    while (*p != 0 && *p != ' ' && *p != '\t' && *p != '\r')
+    {
+        if (len + 1 < buf_size)
+            buf[len++] = *p;
+        p++;
+    }
+    buf[len] = 0;
+    return ImGui_ImplNull_SkipSpaces(p);
+}
+
+static bool ImGui_ImplNull_FindKey(const char* name, int* out_key)
+{
+    for (int key = ImGuiKey_NamedKey_BEGIN; key < ImGuiKey_NamedKey_END; key++)
+    {
+        if (strcmp(ImGui::GetKeyName((ImGuiKey)key), name) == 0)
+        {
+            *out_key = key;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Parse one script line into an event. Returns false on malformed input.
+static bool ImGui_ImplNull_ParseLine(ImGui_ImplNull_Data* bd, const char* line)
+{
+    const char* p = ImGui_ImplNull_SkipSpaces(line);
+    if (*p == 0 || *p == '#' || *p == '\r')
+        return true;
+
+    char* end = nullptr;
+    ImGui_ImplNull_Event e = {};
+    e.Frame = (int)strtol(p, &end, 10);
+    if (end == p || e.Frame < 0)
+        return false;
+
+    char word[32];
+    p = ImGui_ImplNull_ReadWord(ImGui_ImplNull_SkipSpaces(end), word, IM_ARRAYSIZE(word));
+    if (strcmp(word, "mouse") == 0 || strcmp(word, "wheel") == 0 || strcmp(word, "resize") == 0)
+    {
+        e.Type = word[0] == 'm' ? ImGui_ImplNull_EventType_Mouse : word[0] == 'w' ? ImGui_ImplNull_EventType_Wheel : ImGui_ImplNull_EventType_Resize;
+        e.X = strtof(p, &end);
+        if (end == p)
+            return false;
+        p = end;
+        e.Y = strtof(p, &end);
+        if (end == p)
+            return false;
+    }
+    else if (strcmp(word, "down") == 0 || strcmp(word, "up") == 0)
+    {
+        e.Type = ImGui_ImplNull_EventType_Button;
+        e.Down = word[0] == 'd';
+        e.Code = (int)strtol(p, &end, 10);
+        if (end == p || e.Code < 0 || e.Code >= ImGuiMouseButton_COUNT)
+            return false;
+    }
+    else if (strcmp(word, "key") == 0)
+    {
+        e.Type = ImGui_ImplNull_EventType_Key;
+        p = ImGui_ImplNull_ReadWord(p, word, IM_ARRAYSIZE(word));
+        if (!ImGui_ImplNull_FindKey(word, &e.Code))
+            return false;
+        ImGui_ImplNull_ReadWord(p, word, IM_ARRAYSIZE(word));
+        if (strcmp(word, "down") != 0 && strcmp(word, "up") != 0)
+            return false;
+        e.Down = word[0] == 'd';
+    }
+    else if (strcmp(word, "text") == 0)
+    {
+        e.Type = ImGui_ImplNull_EventType_Text;
+        e.TextOffset = bd->Text.Size;
+        const char* text_end = p + strlen(p);
+        while (text_end > p && (text_end[-1] == '\r' || text_end[-1] == '\n'))
+            text_end--;
+        const int len = (int)(text_end - p);
+        bd->Text.resize(e.TextOffset + len + 1);
+        memcpy(bd->Text.Data + e.TextOffset, p, (size_t)len);
+        bd->Text[e.TextOffset + len] = 0;
+    }
+    else
+    {
+        return false;
+    }
+
+    // Keep events ordered by frame, preserving file order within a frame
+    int insert_at = bd->Events.Size;
+    while (insert_at > bd->NextEvent && bd->Events[insert_at - 1].Frame > e.Frame)
+        insert_at--;
+    bd->Events.insert(bd->Events.Data + insert_at, e);
+    return true;
+}
+
+bool ImGui_ImplNull_AddScript(const char* script, char* out_error, int out_error_size)
+{
+    ImGui_ImplNull_Data* bd = ImGui_ImplNull_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplNull_Init()?");
+
+    ImVector<char> line;
+    int line_number = 0;
+    for (const char* p = script; *p != 0; )
+    {
+        const char* line_end = strchr(p, '\n');
+        if (line_end == nullptr)
+            line_end = p + strlen(p);
+        const int len = (int)(line_end - p);
+        line.resize(len + 1);
+        memcpy(line.Data, p, (size_t)len);
+        line[len] = 0;
+        line_number++;
+        if (!ImGui_ImplNull_ParseLine(bd, line.Data))
+        {
+            if (out_error != nullptr && out_error_size > 0)
+                snprintf(out_error, (size_t)out_error_size, "line %d: cannot parse '%s'", line_number, line.Data);
+            return false;
+        }
+        p = *line_end ? line_end + 1 : line_end;
+    }
+    return true;
+}
+
+bool ImGui_ImplNull_LoadScript(const char* filename, char* out_error, int out_error_size)
+{
+    size_t size = 0;
+    char* data = (char*)ImFileLoadToMemory(filename, "rb", &size, 1);
+    if (data == nullptr)
+    {
+        if (out_error != nullptr && out_error_size > 0)
+            snprintf(out_error, (size_t)out_error_size, "cannot open '%s'", filename);
+        return false;
+    }
+    const bool ok = ImGui_ImplNull_AddScript(data, out_error, out_error_size);
+    IM_FREE(data);
+    return ok;
+}
+
+int ImGui_ImplNull_GetFrame()
+{
+    ImGui_ImplNull_Data* bd = ImGui_ImplNull_GetBackendData();
+    return bd ? bd->Frame : 0;
+}
+
+int ImGui_ImplNull_GetLastScriptedFrame()
+{
+    ImGui_ImplNull_Data* bd = ImGui_ImplNull_GetBackendData();
+    return (bd && bd->Events.Size > 0) ? bd->Events.back().Frame : -1;
+}
+
+void ImGui_ImplNull_NewFrame(float delta_time)
+{
+    ImGui_ImplNull_Data* bd = ImGui_ImplNull_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplNull_Init()?");
+    ImGuiIO& io = ImGui::GetIO();
+
+    // Replay the events scheduled for this frame
+    for (; bd->NextEvent < bd->Events.Size && bd->Events[bd->NextEvent].Frame <= bd->Frame; bd->NextEvent++)
+    {
+        const ImGui_ImplNull_Event& e = bd->Events[bd->NextEvent];
+        switch (e.Type)
+        {
+        case ImGui_ImplNull_EventType_Mouse:    io.AddMousePosEvent(e.X, e.Y); break;
+        case ImGui_ImplNull_EventType_Button:   io.AddMouseButtonEvent(e.Code, e.Down); break;
+        case ImGui_ImplNull_EventType_Wheel:    io.AddMouseWheelEvent(e.X, e.Y); break;
+        case ImGui_ImplNull_EventType_Key:      io.AddKeyEvent((ImGuiKey)e.Code, e.Down); break;
+        case ImGui_ImplNull_EventType_Text:     io.AddInputCharactersUTF8(bd->Text.Data + e.TextOffset); break;
+        case ImGui_ImplNull_EventType_Resize:   bd->DisplaySize = ImVec2(e.X, e.Y); break;
+        }
+    }
+
+    io.DisplaySize = bd->DisplaySize;
+    io.DisplayFramebufferScale = ImVec2(1.0f, 1.0f);
+    io.DeltaTime = delta_time > 0.0f ? delta_time : 1.0f / 60.0f;
+    bd->Frame++;
+}
+
+//-----------------------------------------------------------------------------
+
+#endif // #ifndef IMGUI_DISABLE
@@ -0,0 +1,670 @@
+// dear imgui: Renderer Backend for a CPU software rasterizer
+// This needs to be used along with a Platform Backend (e.g. Null for headless runs)
+// Renders ImDrawData into a RGBA8 framebuffer in system memory, so the UI can run and be image-diffed on machines without a GPU.
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Use the value returned by ImGui_ImplSoft_CreateTexture() as ImTextureID.
+//  [X] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset).
+//  [X] Renderer: Expose selected render state for draw callbacks to use. Access in '(ImGui_ImplXXXX_RenderState*)GetPlatformIO().Renderer_RenderState'.
+
+// How it works:
+//  - Triangles of all draw commands are binned into 64x64 pixel tiles by their bounding box (clipped by the command's clip rectangle).
+//  - Tiles are handed out to worker threads. Each tile walks its bin in submission order, so blending order matches a GPU and the
+//    output is identical for any thread count.
+//  - Edges are evaluated in 1/16 pixel fixed point with a tie-breaking rule, so quads made of two triangles never blend their shared
+//    diagonal twice. Each covered row is solved analytically into a span [x0,x1].
+//  - Spans of constant color (solid rectangles, which make up most of a Dear ImGui frame) are blended 4 pixels at a time with SSE2.
+//    Other spans interpolate color and UV per pixel and sample the texture with nearest filtering.
+
+// CHANGELOG
+//  2025-06-20: Initial version.
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_impl_soft.h"
+#include "imgui_internal.h"     // ImMin, ImMax, ImClamp, ImFloor
+
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define IMGUI_IMPL_SOFT_SSE2
+#include <emmintrin.h>
+#endif
+
+static const int    SOFT_TILE_SIZE      = 64;
+static const int    SOFT_SUBPIXEL_BITS  = 4;
+static const int    SOFT_SUBPIXEL_ONE   = 1 << SOFT_SUBPIXEL_BITS;
+static const float  SOFT_COORD_LIMIT    = (float)(1 << 24);     // Keeps fixed point edge equations within 64-bit range
+
+struct ImGui_ImplSoft_Texture
+{
+    int                 Width;
+    int                 Height;
+    ImVector<ImU32>     Pixels;
+};
+
+// One draw command of the batch being rasterized
+struct ImGui_ImplSoft_Cmd
+{
+    const ImDrawVert*   Vtx;            // Already offset by ImDrawCmd::VtxOffset
+    const ImDrawIdx*    Idx;            // Already offset by ImDrawCmd::IdxOffset
+    const ImGui_ImplSoft_Texture* Texture;
+    int                 ClipMinX, ClipMinY, ClipMaxX, ClipMaxY;     // Pixels, max exclusive
+    unsigned int        FirstTriangle;  // Batch-wide index of the first triangle
+};
+
+struct ImGui_ImplSoft_Data;
+
+// Persistent worker threads. The calling thread also rasterizes tiles, so 'thread_count = 1' spawns no thread at all.
+struct ImGui_ImplSoft_Workers
+{
+    std::vector<std::thread>    Threads;
+    std::mutex                  Mutex;
+    std::condition_variable     WakeCv;
+    std::condition_variable     DoneCv;
+    unsigned int                Generation = 0;
+    int                         Busy = 0;
+    bool                        Quit = false;
+    std::atomic<int>            NextTile{ 0 };
+};
+
+struct ImGui_ImplSoft_Data
+{
+    ImVector<ImU32>                 Framebuffer;
+    int                             Width = 0;
+    int                             Height = 0;
+    int                             TilesX = 0;
+    int                             TilesY = 0;
+    ImGui_ImplSoft_Texture*         FontTexture = nullptr;
+
+    // Per-frame scratch, kept between frames to avoid reallocations
+    ImVector<ImGui_ImplSoft_Cmd>    Cmds;
+    std::vector<ImVector<unsigned int>> Bins;
+    ImVec2                          ClipOff;
+    ImVec2                          ClipScale;
+
+    ImGui_ImplSoft_Workers          Workers;
+};
+
+// Backend data stored in io.BackendRendererUserData to allow support for multiple Dear ImGui contexts
+static ImGui_ImplSoft_Data* ImGui_ImplSoft_GetBackendData()
+{
+    return ImGui::GetCurrentContext() ? (ImGui_ImplSoft_Data*)ImGui::GetIO().BackendRendererUserData : nullptr;
+}
+
+//-----------------------------------------------------------------------------
+// Pixel helpers
+//-----------------------------------------------------------------------------
+
+// Exact (x + 127) / 255 for x in [0, 65025]
+static inline ImU32 ImGui_ImplSoft_Div255(ImU32 x)
+{
+    x += 128;
+    return (x + (x >> 8)) >> 8;
+}
+
+// Dear ImGui blending: color = src * src_a + dst * (1 - src_a), alpha = src_a + dst_a * (1 - src_a)
+static inline ImU32 ImGui_ImplSoft_Blend(ImU32 dst, ImU32 src)
+{
+    const ImU32 sa = src >> IM_COL32_A_SHIFT;
+    if (sa == 255)
+        return src;
+    if (sa == 0)
+        return dst;
+    const ImU32 ia = 255 - sa;
+    const ImU32 r = ImGui_ImplSoft_Div255(((src >> IM_COL32_R_SHIFT) & 0xFF) * sa + ((dst >> IM_COL32_R_SHIFT) & 0xFF) * ia);
+    const ImU32 g = ImGui_ImplSoft_Div255(((src >> IM_COL32_G_SHIFT) & 0xFF) * sa + ((dst >> IM_COL32_G_SHIFT) & 0xFF) * ia);
+    const ImU32 b = ImGui_ImplSoft_Div255(((src >> IM_COL32_B_SHIFT) & 0xFF) * sa + ((dst >> IM_COL32_B_SHIFT) & 0xFF) * ia);
+    const ImU32 a = ImGui_ImplSoft_Div255(sa * 255 + ((dst >> IM_COL32_A_SHIFT) & 0xFF) * ia);
+    return (r << IM_COL32_R_SHIFT) | (g << IM_COL32_G_SHIFT) | (b << IM_COL32_B_SHIFT) | (a << IM_COL32_A_SHIFT);
+}
+
+// Component-wise multiply of two colors, used to modulate texels by the vertex color
+static inline ImU32 ImGui_ImplSoft_Modulate(ImU32 a, ImU32 b)
+{
+    ImU32 out = 0;
+    for (int shift = 0; shift < 32; shift += 8)
+        out |= ImGui_ImplSoft_Div255(((a >> shift) & 0xFF) * ((b >> shift) & 0xFF)) << shift;
+    return out;
+}
+
+// Blend one constant color over a span of pixels
+static void ImGui_ImplSoft_BlendSpan(ImU32* dst, int count, ImU32 src)
+{
+    const ImU32 sa = src >> IM_COL32_A_SHIFT;
+    if (sa == 0)
+        return;
+    if (sa == 255)
+    {
+        for (int i = 0; i < count; i++)
+            dst[i] = src;
+        return;
+    }
+
+    int i = 0;
+#ifdef IMGUI_IMPL_SOFT_SSE2
+    // Per 16-bit lane: (s * sa + d * (255 - sa)) / 255. Both products sum to at most 255 * 255, so lanes never overflow.
+    const ImU32 ia = 255 - sa;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i src_term = _mm_set_epi16((short)(sa * 255), (short)(((src >> 16) & 0xFF) * sa), (short)(((src >> 8) & 0xFF) * sa), (short)((src & 0xFF) * sa),
+                                           (short)(sa * 255), (short)(((src >> 16) & 0xFF) * sa), (short)(((src >> 8) & 0xFF) * sa), (short)((src & 0xFF) * sa));
+    const __m128i inv_alpha = _mm_set1_epi16((short)ia);
+    const __m128i bias = _mm_set1_epi16(128);
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i d = _mm_loadu_si128((const __m128i*)(dst + i));
+        __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), inv_alpha), src_term);
+        __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), inv_alpha), src_term);
+        lo = _mm_add_epi16(lo, bias);
+        hi = _mm_add_epi16(hi, bias);
+        lo = _mm_srli_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), 8);
+        hi = _mm_srli_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), 8);
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi16(lo, hi));
+    }
+#endif
+    for (; i < count; i++)
+        dst[i] = ImGui_ImplSoft_Blend(dst[i], src);
+}
+
+static inline int64_t ImGui_ImplSoft_FloorDiv(int64_t n, int64_t d) // d > 0
+{
+    int64_t q = n / d;
+    if ((n % d) != 0 && n < 0)
+        q--;
+    return q;
+}
+
+//-----------------------------------------------------------------------------
+// Triangle rasterization
+//-----------------------------------------------------------------------------
+
+// Rasterize one triangle restricted to the pixel rectangle [min_x,max_x) x [min_y,max_y)
+static void ImGui_ImplSoft_RasterTriangle(ImGui_ImplSoft_Data* bd, const ImGui_ImplSoft_Cmd& cmd, const ImDrawIdx* idx, int min_x, int min_y, int max_x, int max_y)
+{
+    const ImDrawVert* v[3] = { &cmd.Vtx[idx[0]], &cmd.Vtx[idx[1]], &cmd.Vtx[idx[2]] };
+    ImVec2 p[3];
+    for (int i = 0; i < 3; i++)
+    {
+        p[i].x = (v[i]->pos.x - bd->ClipOff.x) * bd->ClipScale.x;
+        p[i].y = (v[i]->pos.y - bd->ClipOff.y) * bd->ClipScale.y;
+        if (!(p[i].x == p[i].x) || !(p[i].y == p[i].y))
+            return;
+        p[i].x = ImClamp(p[i].x, -SOFT_COORD_LIMIT, SOFT_COORD_LIMIT);
+        p[i].y = ImClamp(p[i].y, -SOFT_COORD_LIMIT, SOFT_COORD_LIMIT);
+    }
+
+    // Fixed point vertices and orientation
+    int64_t fx[3], fy[3];
+    for (int i = 0; i < 3; i++)
+    {
+        fx[i] = (int64_t)(p[i].x * SOFT_SUBPIXEL_ONE + (p[i].x >= 0.0f ? 0.5f : -0.5f));
+        fy[i] = (int64_t)(p[i].y * SOFT_SUBPIXEL_ONE + (p[i].y >= 0.0f ? 0.5f : -0.5f));
+    }
+    const int64_t area = (fx[1] - fx[0]) * (fy[2] - fy[0]) - (fy[1] - fy[0]) * (fx[2] - fx[0]);
+    if (area == 0)
+        return;
+    if (area < 0)
+    {
+        ImSwap(v[1], v[2]);
+        ImSwap(p[1], p[2]);
+        ImSwap(fx[1], fx[2]);
+        ImSwap(fy[1], fy[2]);
+    }
+
+    // Row range from the bounding box
+    const float bb_min_y = ImMin(p[0].y, ImMin(p[1].y, p[2].y));
+    const float bb_max_y = ImMax(p[0].y, ImMax(p[1].y, p[2].y));
+    const float bb_min_x = ImMin(p[0].x, ImMin(p[1].x, p[2].x));
+    const float bb_max_x = ImMax(p[0].x, ImMax(p[1].x, p[2].x));
+    min_y = ImMax(min_y, (int)ImFloor(bb_min_y));
+    max_y = ImMin(max_y, (int)ImFloor(bb_max_y) + 1);
+    min_x = ImMax(min_x, (int)ImFloor(bb_min_x));
+    max_x = ImMin(max_x, (int)ImFloor(bb_max_x) + 1);
+    if (min_x >= max_x || min_y >= max_y)
+        return;
+
+    // Edge equations E(X,Y) = a*X + b*Y + c >= 0 inside, in subpixel units. The tie-breaking rule is antisymmetric, so a shared
+    // edge belongs to exactly one of the two triangles.
+    int64_t edge_a[3], edge_b[3], edge_k[3];
+    for (int i = 0; i < 3; i++)
+    {
+        const int j = (i + 1) % 3;
+        const int64_t a = fy[i] - fy[j];
+        const int64_t b = fx[j] - fx[i];
+        const int64_t c = (fy[j] - fy[i]) * fx[i] - (fx[j] - fx[i]) * fy[i];
+        const bool inclusive = a > 0 || (a == 0 && b > 0);
+        // E at the center of pixel (x, min_y) is a*ONE*x + k
+        const int64_t center_y = (int64_t)min_y * SOFT_SUBPIXEL_ONE + SOFT_SUBPIXEL_ONE / 2;
+        edge_a[i] = a * SOFT_SUBPIXEL_ONE;
+        edge_b[i] = b * SOFT_SUBPIXEL_ONE;
+        edge_k[i] = a * (SOFT_SUBPIXEL_ONE / 2) + b * center_y + c + (inclusive ? 0 : -1);
+    }
+
+    // Constant color and texel: one blend color for the whole triangle
+    const ImGui_ImplSoft_Texture* tex = cmd.Texture;
+    const bool const_col = v[0]->col == v[1]->col && v[0]->col == v[2]->col;
+    const bool const_uv = v[0]->uv.x == v[1]->uv.x && v[0]->uv.x == v[2]->uv.x && v[0]->uv.y == v[1]->uv.y && v[0]->uv.y == v[2]->uv.y;
+    ImU32 solid = v[0]->col;
+    if (const_uv && tex != nullptr)
+    {
+        const int tx = ImClamp((int)(v[0]->uv.x * tex->Width), 0, tex->Width - 1);
+        const int ty = ImClamp((int)(v[0]->uv.y * tex->Height), 0, tex->Height - 1);
+        solid = ImGui_ImplSoft_Modulate(tex->Pixels.Data[ty * tex->Width + tx], solid);
+    }
+    const bool solid_span = const_col && (const_uv || tex == nullptr);
+
+    // Attribute gradients for the varying path: f(x,y) = f0 + dfdx * (x - x0) + dfdy * (y - y0)
+    float attr0[6], attr_dx[6], attr_dy[6];
+    if (!solid_span)
+    {
+        const float e1x = p[1].x - p[0].x, e1y = p[1].y - p[0].y;
+        const float e2x = p[2].x - p[0].x, e2y = p[2].y - p[0].y;
+        const float inv_area = 1.0f / (e1x * e2y - e1y * e2x);
+        float f[3][6];
+        for (int i = 0; i < 3; i++)
+        {
+            const ImU32 c = v[i]->col;
+            f[i][0] = (float)((c >> IM_COL32_R_SHIFT) & 0xFF);
+            f[i][1] = (float)((c >> IM_COL32_G_SHIFT) & 0xFF);
+            f[i][2] = (float)((c >> IM_COL32_B_SHIFT) & 0xFF);
+            f[i][3] = (float)((c >> IM_COL32_A_SHIFT) & 0xFF);
+            f[i][4] = tex ? v[i]->uv.x * tex->Width : 0.0f;
+            f[i][5] = tex ? v[i]->uv.y * tex->Height : 0.0f;
+        }
+        const float cx = min_x + 0.5f - p[0].x;
+        const float cy = min_y + 0.5f - p[0].y;
+        for (int k = 0; k < 6; k++)
+        {
+            const float d1 = f[1][k] - f[0][k];
+            const float d2 = f[2][k] - f[0][k];
+            attr_dx[k] = (d1 * e2y - d2 * e1y) * inv_area;
+            attr_dy[k] = (d2 * e1x - d1 * e2x) * inv_area;
+            attr0[k] = f[0][k] + attr_dx[k] * cx + attr_dy[k] * cy;   // Value at the center of pixel (min_x, min_y)
+        }
+    }
+
+    ImU32* fb_row = bd->Framebuffer.Data + (size_t)min_y * bd->Width;
+    for (int y = min_y; y < max_y; y++, fb_row += bd->Width)
+    {
+        // Solve each edge for the covered interval of this row
+        int64_t x0 = min_x, x1 = max_x - 1;
+        for (int i = 0; i < 3; i++)
+        {
+            const int64_t a = edge_a[i];
+            const int64_t k = edge_k[i];
+            if (a > 0)
+                x0 = ImMax(x0, -ImGui_ImplSoft_FloorDiv(k, a));                 // a*x + k >= 0  =>  x >= ceil(-k / a)
+            else if (a < 0)
+                x1 = ImMin(x1, ImGui_ImplSoft_FloorDiv(k, -a));                 // x <= floor(k / -a)
+            else if (k < 0)
+                x1 = -1;
+            edge_k[i] += edge_b[i];
+        }
+        if (x0 > x1)
+            continue;
+
+        const int span_x0 = (int)x0;
+        const int span_count = (int)(x1 - x0) + 1;
+        if (solid_span)
+        {
+            ImGui_ImplSoft_BlendSpan(fb_row + span_x0, span_count, solid);
+            continue;
+        }
+
+        const float row_dy = (float)(y - min_y);
+        const float col_dx = (float)(span_x0 - min_x);
+        float attr[6];
+        for (int k = 0; k < 6; k++)
+            attr[k] = attr0[k] + attr_dx[k] * col_dx + attr_dy[k] * row_dy;
+        ImU32* dst = fb_row + span_x0;
+        for (int x = 0; x < span_count; x++)
+        {
+            ImU32 src;
+            if (const_col)
+                src = v[0]->col;
+            else
+                src = IM_COL32((int)ImClamp(attr[0] + 0.5f, 0.0f, 255.0f), (int)ImClamp(attr[1] + 0.5f, 0.0f, 255.0f),
+                               (int)ImClamp(attr[2] + 0.5f, 0.0f, 255.0f), (int)ImClamp(attr[3] + 0.5f, 0.0f, 255.0f));
+            if (tex != nullptr)
+            {
+                const int tx = ImClamp((int)attr[4], 0, tex->Width - 1);
+                const int ty = ImClamp((int)attr[5], 0, tex->Height - 1);
+                src = ImGui_ImplSoft_Modulate(tex->Pixels.Data[ty * tex->Width + tx], src);
+            }
+            dst[x] = ImGui_ImplSoft_Blend(dst[x], src);
+            for (int k = 0; k < 6; k++)
+                attr[k] += attr_dx[k];
+        }
+    }
+}
+
+// Rasterize every triangle binned into one tile, in submission order
+static void ImGui_ImplSoft_RasterTile(ImGui_ImplSoft_Data* bd, int tile)
+{
+    const ImVector<unsigned int>& bin = bd->Bins[tile];
+    if (bin.Size == 0)
+        return;
+    const int tile_x0 = (tile % bd->TilesX) * SOFT_TILE_SIZE;
+    const int tile_y0 = (tile / bd->TilesX) * SOFT_TILE_SIZE;
+    const int tile_x1 = ImMin(tile_x0 + SOFT_TILE_SIZE, bd->Width);
+    const int tile_y1 = ImMin(tile_y0 + SOFT_TILE_SIZE, bd->Height);
+
+    int cmd_i = 0;
+    for (unsigned int tri : bin)
+    {
+        while (cmd_i + 1 < bd->Cmds.Size && bd->Cmds.Data[cmd_i + 1].FirstTriangle <= tri)
+            cmd_i++;
+        const ImGui_ImplSoft_Cmd& cmd = bd->Cmds.Data[cmd_i];
+        ImGui_ImplSoft_RasterTriangle(bd, cmd, cmd.Idx + (tri - cmd.FirstTriangle) * 3,
+            ImMax(tile_x0, cmd.ClipMinX), ImMax(tile_y0, cmd.ClipMinY), ImMin(tile_x1, cmd.ClipMaxX), ImMin(tile_y1, cmd.ClipMaxY));
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Workers
+//-----------------------------------------------------------------------------
+
+static void ImGui_ImplSoft_ProcessTiles(ImGui_ImplSoft_Data* bd)
+{
+    const int tile_count = bd->TilesX * bd->TilesY;
+    for (int tile = bd->Workers.NextTile.fetch_add(1); tile < tile_count; tile = bd->Workers.NextTile.fetch_add(1))
+        ImGui_ImplSoft_RasterTile(bd, tile);
+}
+
+static void ImGui_ImplSoft_WorkerMain(ImGui_ImplSoft_Data* bd)
+{
+    ImGui_ImplSoft_Workers& w = bd->Workers;
+    unsigned int seen_generation = 0;
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock(w.Mutex);
+            w.WakeCv.wait(lock, [&] { return w.Quit || w.Generation != seen_generation; });
+            if (w.Quit)
+                return;
+            seen_generation = w.Generation;
+        }
+        ImGui_ImplSoft_ProcessTiles(bd);
+        {
+            std::lock_guard<std::mutex> lock(w.Mutex);
+            if (--w.Busy == 0)
+                w.DoneCv.notify_one();
+        }
+    }
+}
+
+// Rasterize all binned triangles, then reset the bins for the next batch
+static void ImGui_ImplSoft_FlushBatch(ImGui_ImplSoft_Data* bd)
+{
+    if (bd->Cmds.Size == 0)
+        return;
+    ImGui_ImplSoft_Workers& w = bd->Workers;
+    w.NextTile = 0;
+    if (!w.Threads.empty())
+    {
+        {
+            std::lock_guard<std::mutex> lock(w.Mutex);
+            w.Busy = (int)w.Threads.size();
+            w.Generation++;
+        }
+        w.WakeCv.notify_all();
+    }
+    ImGui_ImplSoft_ProcessTiles(bd);
+    if (!w.Threads.empty())
+    {
+        std::unique_lock<std::mutex> lock(w.Mutex);
+        w.DoneCv.wait(lock, [&] { return w.Busy == 0; });
+    }
+
+    for (ImVector<unsigned int>& bin : bd->Bins)
+        bin.resize(0);
+    bd->Cmds.resize(0);
+}
+
+//-----------------------------------------------------------------------------
+// Rendering
+//-----------------------------------------------------------------------------
+
+// Append the triangles of one draw command to the tile bins
+static void ImGui_ImplSoft_BinCmd(ImGui_ImplSoft_Data* bd, const ImDrawList* draw_list, const ImDrawCmd* pcmd, unsigned int& triangle_count)
+{
+    // Project scissor/clipping rectangles into framebuffer space
+    const int clip_min_x = ImMax(0, (int)((pcmd->ClipRect.x - bd->ClipOff.x) * bd->ClipScale.x));
+    const int clip_min_y = ImMax(0, (int)((pcmd->ClipRect.y - bd->ClipOff.y) * bd->ClipScale.y));
+    const int clip_max_x = ImMin(bd->Width, (int)((pcmd->ClipRect.z - bd->ClipOff.x) * bd->ClipScale.x));
+    const int clip_max_y = ImMin(bd->Height, (int)((pcmd->ClipRect.w - bd->ClipOff.y) * bd->ClipScale.y));
+    if (clip_max_x <= clip_min_x || clip_max_y <= clip_min_y)
+        return;
+
+    ImGui_ImplSoft_Cmd cmd;
+    cmd.Vtx = draw_list->VtxBuffer.Data + pcmd->VtxOffset;
+    cmd.Idx = draw_list->IdxBuffer.Data + pcmd->IdxOffset;
+    cmd.Texture = (const ImGui_ImplSoft_Texture*)(intptr_t)pcmd->GetTexID();
+    cmd.ClipMinX = clip_min_x;
+    cmd.ClipMinY = clip_min_y;
+    cmd.ClipMaxX = clip_max_x;
+    cmd.ClipMaxY = clip_max_y;
+    cmd.FirstTriangle = triangle_count;
+    bd->Cmds.push_back(cmd);
+
+    const unsigned int tri_count = pcmd->ElemCount / 3;
+    for (unsigned int t = 0; t < tri_count; t++)
+    {
+        const ImDrawVert& v0 = cmd.Vtx[cmd.Idx[t * 3 + 0]];
+        const ImDrawVert& v1 = cmd.Vtx[cmd.Idx[t * 3 + 1]];
+        const ImDrawVert& v2 = cmd.Vtx[cmd.Idx[t * 3 + 2]];
+        const float min_x = (ImMin(v0.pos.x, ImMin(v1.pos.x, v2.pos.x)) - bd->ClipOff.x) * bd->ClipScale.x;
+        const float min_y = (ImMin(v0.pos.y, ImMin(v1.pos.y, v2.pos.y)) - bd->ClipOff.y) * bd->ClipScale.y;
+        const float max_x = (ImMax(v0.pos.x, ImMax(v1.pos.x, v2.pos.x)) - bd->ClipOff.x) * bd->ClipScale.x;
+        const float max_y = (ImMax(v0.pos.y, ImMax(v1.pos.y, v2.pos.y)) - bd->ClipOff.y) * bd->ClipScale.y;
+        // Also rejects NaN positions
+        if (!(max_x >= clip_min_x && min_x < clip_max_x && max_y >= clip_min_y && min_y < clip_max_y))
+            continue;
+        const int tx0 = (int)ImMax(min_x, (float)clip_min_x) / SOFT_TILE_SIZE;
+        const int ty0 = (int)ImMax(min_y, (float)clip_min_y) / SOFT_TILE_SIZE;
+        const int tx1 = (int)ImMin(max_x, (float)(clip_max_x - 1)) / SOFT_TILE_SIZE;
+        const int ty1 = (int)ImMin(max_y, (float)(clip_max_y - 1)) / SOFT_TILE_SIZE;
+        const unsigned int tri = triangle_count + t;
+        for (int ty = ty0; ty <= ty1; ty++)
+            for (int tx = tx0; tx <= tx1; tx++)
+                bd->Bins[ty * bd->TilesX + tx].push_back(tri);
+    }
+    triangle_count += tri_count;
+}
+
+void ImGui_ImplSoft_RenderDrawData(ImDrawData* draw_data)
+{
+    ImGui_ImplSoft_Data* bd = ImGui_ImplSoft_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplSoft_Init()?");
+    if (bd->Width <= 0 || bd->Height <= 0)
+        return;
+
+    // Will project scissor/clipping rectangles into framebuffer space
+    bd->ClipOff = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
+    bd->ClipScale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
+
+    ImGui_ImplSoft_RenderState render_state;
+    render_state.Framebuffer = bd->Framebuffer.Data;
+    render_state.Width = bd->Width;
+    render_state.Height = bd->Height;
+    ImGui::GetPlatformIO().Renderer_RenderState = &render_state;
+
+    unsigned int triangle_count = 0;
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* draw_list = draw_data->CmdLists[n];
+        for (int cmd_i = 0; cmd_i < draw_list->CmdBuffer.Size; cmd_i++)
+        {
+            const ImDrawCmd* pcmd = &draw_list->CmdBuffer[cmd_i];
+            if (pcmd->UserCallback != nullptr)
+            {
+                // Callbacks see everything submitted before them
+                ImGui_ImplSoft_FlushBatch(bd);
+                triangle_count = 0;
+                if (pcmd->UserCallback != ImDrawCallback_ResetRenderState)
+                    pcmd->UserCallback(draw_list, pcmd);
+            }
+            else
+            {
+                ImGui_ImplSoft_BinCmd(bd, draw_list, pcmd, triangle_count);
+            }
+        }
+    }
+    ImGui_ImplSoft_FlushBatch(bd);
+    ImGui::GetPlatformIO().Renderer_RenderState = nullptr;
+}
+
+//-----------------------------------------------------------------------------
+// Framebuffer and textures
+//-----------------------------------------------------------------------------
+
+void ImGui_ImplSoft_SetFramebufferSize(int width, int height)
+{
+    ImGui_ImplSoft_Data* bd = ImGui_ImplSoft_GetBackendData();
+    IM_ASSERT(bd != nullptr);
+    width = ImMax(width, 0);
+    height = ImMax(height, 0);
+    if (bd->Width == width && bd->Height == height)
+        return;
+    bd->Width = width;
+    bd->Height = height;
+    bd->Framebuffer.resize(width * height);
+    bd->TilesX = (width + SOFT_TILE_SIZE - 1) / SOFT_TILE_SIZE;
+    bd->TilesY = (height + SOFT_TILE_SIZE - 1) / SOFT_TILE_SIZE;
+    bd->Bins.resize((size_t)bd->TilesX * bd->TilesY);
+}
+
+void ImGui_ImplSoft_ClearFramebuffer(ImU32 col)
+{
+    ImGui_ImplSoft_Data* bd = ImGui_ImplSoft_GetBackendData();
+    IM_ASSERT(bd != nullptr);
+    ImU32* p = bd->Framebuffer.Data;
+    for (int i = 0, n = bd->Framebuffer.Size; i < n; i++)
+        p[i] = col;
+}
+
+const ImU32* ImGui_ImplSoft_GetFramebuffer(int* out_width, int* out_height)
+{
+    ImGui_ImplSoft_Data* bd = ImGui_ImplSoft_GetBackendData();
+    IM_ASSERT(bd != nullptr);
+    if (out_width)
+        *out_width = bd->Width;
+    if (out_height)
+        *out_height = bd->Height;
+    return bd->Framebuffer.Data;
+}
+
+ImTextureID ImGui_ImplSoft_CreateTexture(const ImU32* pixels, int width, int height)
+{
+    ImGui_ImplSoft_Texture* tex = IM_NEW(ImGui_ImplSoft_Texture)();
+    tex->Width = 0;
+    tex->Height = 0;
+    ImTextureID tex_id = (ImTextureID)(intptr_t)tex;
+    ImGui_ImplSoft_UpdateTexture(tex_id, pixels, width, height);
+    return tex_id;
+}
+
+void ImGui_ImplSoft_UpdateTexture(ImTextureID tex_id, const ImU32* pixels, int width, int height)
+{
+    ImGui_ImplSoft_Texture* tex = (ImGui_ImplSoft_Texture*)(intptr_t)tex_id;
+    IM_ASSERT(tex != nullptr && width > 0 && height > 0);
+    tex->Width = width;
+    tex->Height = height;
+    tex->Pixels.resize(width * height);
+    memcpy(tex->Pixels.Data, pixels, (size_t)width * height * sizeof(ImU32));
+}
+
+void ImGui_ImplSoft_DestroyTexture(ImTextureID tex_id)
+{
+    IM_DELETE((ImGui_ImplSoft_Texture*)(intptr_t)tex_id);
+}
+
+bool ImGui_ImplSoft_CreateDeviceObjects()
+{
+    ImGui_ImplSoft_Data* bd = ImGui_ImplSoft_GetBackendData();
+    if (bd->FontTexture)
+        ImGui_ImplSoft_InvalidateDeviceObjects();
+
+    // Build texture atlas
+    ImGuiIO& io = ImGui::GetIO();
+    unsigned char* pixels;
+    int width, height;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+    ImTextureID tex_id = ImGui_ImplSoft_CreateTexture((const ImU32*)pixels, width, height);
+    bd->FontTexture = (ImGui_ImplSoft_Texture*)(intptr_t)tex_id;
+
+    // Store our identifier
+    io.Fonts->SetTexID(tex_id);
+    return true;
+}
+
+void ImGui_ImplSoft_InvalidateDeviceObjects()
+{
+    ImGui_ImplSoft_Data* bd = ImGui_ImplSoft_GetBackendData();
+    if (!bd || !bd->FontTexture)
+        return;
+    ImGui_ImplSoft_DestroyTexture((ImTextureID)(intptr_t)bd->FontTexture);
+    bd->FontTexture = nullptr;
+    ImGui::GetIO().Fonts->SetTexID(0);
+}
+
+bool ImGui_ImplSoft_Init(int width, int height, int thread_count)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    IMGUI_CHECKVERSION();
+    IM_ASSERT(io.BackendRendererUserData == nullptr && "Already initialized a renderer backend!");
+
+    // Setup backend capabilities flags
+    ImGui_ImplSoft_Data* bd = IM_NEW(ImGui_ImplSoft_Data)();
+    io.BackendRendererUserData = (void*)bd;
+    io.BackendRendererName = "imgui_impl_soft";
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
+
+    ImGui_ImplSoft_SetFramebufferSize(width, height);
+
+    if (thread_count <= 0)
+        thread_count = (int)std::thread::hardware_concurrency();
+    for (int i = 1; i < thread_count; i++)
+        bd->Workers.Threads.emplace_back(ImGui_ImplSoft_WorkerMain, bd);
+    return true;
+}
+
+void ImGui_ImplSoft_Shutdown()
+{
+    ImGui_ImplSoft_Data* bd = ImGui_ImplSoft_GetBackendData();
+    IM_ASSERT(bd != nullptr && "No renderer backend to shutdown, or already shutdown?");
+    ImGuiIO& io = ImGui::GetIO();
+
+    {
+        std::lock_guard<std::mutex> lock(bd->Workers.Mutex);
+        bd->Workers.Quit = true;
+    }
+    bd->Workers.WakeCv.notify_all();
+    for (std::thread& thread : bd->Workers.Threads)
+        thread.join();
+
+    ImGui_ImplSoft_InvalidateDeviceObjects();
+    io.BackendRendererName = nullptr;
+    io.BackendRendererUserData = nullptr;
+    io.BackendFlags &= ~ImGuiBackendFlags_RendererHasVtxOffset;
+    IM_DELETE(bd);
+}
+
+void ImGui_ImplSoft_NewFrame()
+{
+    ImGui_ImplSoft_Data* bd = ImGui_ImplSoft_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplSoft_Init()?");
+
+    if (!bd->FontTexture)
+        ImGui_ImplSoft_CreateDeviceObjects();
+}
+
+//-----------------------------------------------------------------------------
+
+#endif // #ifndef IMGUI_DISABLE
@@ -0,0 +1,166 @@
+/********************************************************************
+MIT License
+
+Copyright (c) 2025 loong22
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*********************************************************************/
+#include "../include/app_views.h"
+#include "../include/frame_profiler.h"
+#include "imgui.h"
+#include "imgui_internal.h"
+#include "implot.h"
+#include <algorithm>
+#include <cstdio>
+
+void RenderLogContent(LogSource& source, const LogSearcher& searcher, bool showLineNumbers, bool wrapText, float wrapWidth,
+    bool onlyMatches, int cursorLine, bool scrollToCursor) {
+    PROFILE_SCOPE("RenderLogContent");
+    int lineCount = source.GetLineCount();
+    if (lineCount == 0) {
+        ImGui::TextColored(ImVec4(0.5f, 0.5f, 0.5f, 1.0f), u8"暂无日志内容");
+        return;
+    }
+
+    // 只显示匹配行时按匹配序号列出，行号仍是日志中的原始行号
+    const bool searching = searcher.IsActive();
+    const bool filtered = onlyMatches && searching;
+    const int rowCount = filtered ? searcher.GetMatchCount() : lineCount;
+    if (rowCount == 0) {
+        ImGui::TextColored(ImVec4(0.5f, 0.5f, 0.5f, 1.0f), searcher.IsSearching() ? u8"正在搜索..." : u8"没有匹配的行");
+        return;
+    }
+    auto rowToLine = [&](int row) { return filtered ? std::min(searcher.GetMatchLine(row), lineCount - 1) : row; };
+    int scrollToRow = -1;
+    if (scrollToCursor && cursorLine >= 0) {
+        scrollToRow = filtered ? searcher.LowerBoundMatch(cursorLine) : cursorLine;
+    }
+
+    char lastLineLabel[16];
+    snprintf(lastLineLabel, sizeof(lastLineLabel), "%d", lineCount);
+    float lineNumberWidth = ImMax(50.0f, ImGui::CalcTextSize(lastLineLabel).x + ImGui::GetStyle().CellPadding.x * 2.0f);
+
+    float effectiveWrapWidth = wrapWidth;
+    if (effectiveWrapWidth <= 0.0f) {
+        effectiveWrapWidth = ImGui::GetContentRegionAvail().x;
+        if (showLineNumbers) effectiveWrapWidth -= lineNumberWidth;
+    }
+
+    if (showLineNumbers) {
+        if (!ImGui::BeginTable("LogContentTable", 2, ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_SizingFixedFit)) {
+            return;
+        }
+        ImGui::TableSetupColumn("LineNumbers", ImGuiTableColumnFlags_WidthFixed, lineNumberWidth);
+        ImGui::TableSetupColumn("Content", ImGuiTableColumnFlags_WidthStretch);
+    }
+
+    const ImVec4 matchColor(1.0f, 0.85f, 0.3f, 1.0f);
+    const ImU32 matchRowColor = IM_COL32(255, 200, 60, 40);
+    const ImU32 cursorRowColor = IM_COL32(255, 200, 60, 110);
+
+    // 只提交可见行，每帧开销与日志总行数无关。
+    // 自动换行时各行高度不同，裁剪器按首个可见行的高度估算滚动范围，可见行仍按实际换行绘制。
+    ImGuiListClipper clipper;
+    clipper.Begin(rowCount);
+    if (scrollToRow >= 0 && scrollToRow < rowCount) {
+        clipper.IncludeItemByIndex(scrollToRow);
+    }
+    while (clipper.Step()) {
+        // 匹配行分散在整个文件中时逐行映射，避免一次映射过大的范围
+        const int firstLine = rowToLine(clipper.DisplayStart);
+        const int lastLine = rowToLine(clipper.DisplayEnd - 1);
+        const bool mapPerLine = filtered && lastLine - firstLine > 4 * (clipper.DisplayEnd - clipper.DisplayStart) + 1024;
+        if (!mapPerLine) {
+            source.MapLines(firstLine, lastLine + 1);
+        }
+        for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++) {
+            const int lineIndex = rowToLine(row);
+            if (mapPerLine) {
+                source.MapLines(lineIndex, lineIndex + 1);
+            }
+            std::string_view line = source.GetLine(lineIndex);
+            const bool isMatch = searching && searcher.IsMatch(lineIndex);
+            const bool isCursor = isMatch && lineIndex == cursorLine;
+
+            if (showLineNumbers) {
+                ImGui::TableNextRow();
+                if (isMatch) {
+                    ImGui::TableSetBgColor(ImGuiTableBgTarget_RowBg0, isCursor ? cursorRowColor : matchRowColor);
+                }
+                ImGui::TableSetColumnIndex(0);
+                ImGui::TextColored(ImVec4(0.5f, 0.5f, 0.5f, 1.0f), "%d", lineIndex + 1);
+                ImGui::TableSetColumnIndex(1);
+            }
+            if (row == scrollToRow) {
+                ImGui::SetScrollHereY(0.5f);
+            }
+
+            if (isMatch) ImGui::PushStyleColor(ImGuiCol_Text, matchColor);
+            if (wrapText) {
+                ImGui::PushTextWrapPos(ImGui::GetCursorPos().x + effectiveWrapWidth);
+                ImGui::TextUnformatted(line.data(), line.data() + line.size());
+                ImGui::PopTextWrapPos();
+            } else {
+                ImGui::TextUnformatted(line.data(), line.data() + line.size());
+            }
+            if (isMatch) ImGui::PopStyleColor();
+        }
+    }
+
+    if (showLineNumbers) {
+        ImGui::EndTable();
+    }
+}
+
+void ShowConvergencePlots(const Su2History& history, float plotHeight) {
+    const int rowCount = history.GetRowCount();
+    if (rowCount == 0) {
+        ImGui::TextColored(ImVec4(0.5f, 0.5f, 0.5f, 1.0f), u8"暂无收敛历史，请在日志窗口中打开 SU2 屏幕输出日志或 history.csv");
+        return;
+    }
+
+    ImGui::Text(u8"已解析 %d 步，共 %d 列", rowCount, history.GetColumnCount());
+
+    float halfHeight = (plotHeight - ImGui::GetStyle().ItemSpacing.y) * 0.5f;
+    if (halfHeight < 150.0f) halfHeight = 150.0f;
+
+    if (ImPlot::BeginPlot(u8"残差", ImVec2(-1, halfHeight))) {
+        ImPlot::SetupAxes(u8"迭代步", u8"残差", ImPlotAxisFlags_AutoFit, ImPlotAxisFlags_AutoFit);
+        ImPlot::SetupAxisScale(ImAxis_Y1, ImPlotScale_Log10);
+        for (int column = 0; column < history.GetColumnCount(); column++) {
+            const std::string& name = history.GetColumnName(column);
+            if (!Su2History::IsResidualName(name)) continue;
+            // SU2 输出的残差是 log10 值，曲线中已还原成原始量级，画在对数坐标轴上
+            ImPlot::PlotLine(name.c_str(), history.GetColumnSeries(column), ImPlotLineFlags_LOD);
+        }
+        PROFILE_SCOPE("ImPlot::EndPlot");
+        ImPlot::EndPlot();
+    }
+
+    if (ImPlot::BeginPlot(u8"气动系数", ImVec2(-1, halfHeight))) {
+        ImPlot::SetupAxes(u8"迭代步", nullptr, ImPlotAxisFlags_AutoFit, ImPlotAxisFlags_AutoFit);
+        for (int column = 0; column < history.GetColumnCount(); column++) {
+            const std::string& name = history.GetColumnName(column);
+            if (Su2History::IsIterationName(name) || Su2History::IsResidualName(name)) continue;
+            ImPlot::PlotLine(name.c_str(), history.GetColumnSeries(column), ImPlotLineFlags_LOD);
+        }
+        PROFILE_SCOPE("ImPlot::EndPlot");
+        ImPlot::EndPlot();
+    }
+}
@@ -0,0 +1,112 @@
+/********************************************************************
+MIT License
+
+Copyright (c) 2025 loong22
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*********************************************************************/
+
+#include "../include/draw_stats.h"
+#include "imgui.h"
+#include "imgui_internal.h"   // ImDrawList::_OwnerName
+#include "implot.h"
+#include "implot3d.h"
+#include <algorithm>
+
+DrawStats::DrawStats()
+    : m_VtxHistory(kHistoryLength, 0.0f)
+    , m_IdxHistory(kHistoryLength, 0.0f)
+    , m_CmdHistory(kHistoryLength, 0.0f)
+    , m_ReallocHistory(kHistoryLength, 0.0f) {
+}
+
+void DrawStats::Update(const ImDrawData* drawData, const DrawBackendStats& backend) {
+    const int slot = static_cast<int>(m_Frame % kHistoryLength);
+    const int reallocs = (backend.vertexReallocs - m_Backend.vertexReallocs) + (backend.indexReallocs - m_Backend.indexReallocs);
+    m_Backend = backend;
+
+    m_VtxCount = m_IdxCount = m_CmdCount = 0;
+    for (DrawListStats& list : m_DrawLists) {
+        list.vtxCount = list.idxCount = list.cmdCount = 0;
+        list.vtxHistory[slot] = 0.0f;
+    }
+    if (drawData != nullptr && drawData->Valid) {
+        for (const ImDrawList* drawList : drawData->CmdLists) {
+            const char* name = drawList->_OwnerName != nullptr ? drawList->_OwnerName : "";
+            auto it = std::find_if(m_DrawLists.begin(), m_DrawLists.end(),
+                [name](const DrawListStats& list) { return list.name == name; });
+            if (it == m_DrawLists.end()) {
+                DrawListStats list;
+                list.name = name;
+                list.vtxHistory.assign(kHistoryLength, 0.0f);
+                m_DrawLists.push_back(std::move(list));
+                it = m_DrawLists.end() - 1;
+            }
+            // 同名的绘制列表（例如同一窗口的多个视口）合并统计
+            it->vtxCount += drawList->VtxBuffer.Size;
+            it->idxCount += drawList->IdxBuffer.Size;
+            it->cmdCount += drawList->CmdBuffer.Size;
+            it->vtxHistory[slot] = static_cast<float>(it->vtxCount);
+            it->lastFrame = m_Frame;
+            m_CmdCount += drawList->CmdBuffer.Size;
+        }
+        m_VtxCount = drawData->TotalVtxCount;
+        m_IdxCount = drawData->TotalIdxCount;
+    }
+
+    m_VtxHistory[slot] = static_cast<float>(m_VtxCount);
+    m_IdxHistory[slot] = static_cast<float>(m_IdxCount);
+    m_CmdHistory[slot] = static_cast<float>(m_CmdCount);
+    m_ReallocHistory[slot] = static_cast<float>(reallocs);
+
+    m_DrawLists.erase(std::remove_if(m_DrawLists.begin(), m_DrawLists.end(),
+        [this](const DrawListStats& list) { return m_Frame - list.lastFrame >= kHistoryLength; }), m_DrawLists.end());
+    for (DrawListStats& list : m_DrawLists) {
+        list.peakVtxCount = static_cast<int>(*std::max_element(list.vtxHistory.begin(), list.vtxHistory.end()));
+    }
+    std::sort(m_DrawLists.begin(), m_DrawLists.end(),
+        [](const DrawListStats& a, const DrawListStats& b) { return a.vtxCount > b.vtxCount; });
+
+    m_Items.clear();
+    int count = 0;
+    const ImPlotItemDrawStats* items = ImPlot::GetItemDrawStats(&count);
+    for (int i = 0; i < count; i++) {
+        DrawItemStats item;
+        item.plot = items[i].PlotTitle;
+        item.label = items[i].Label;
+        item.vtxCount = items[i].VtxCount;
+        item.idxCount = items[i].IdxCount;
+        item.cmdCount = items[i].CmdCount;
+        m_Items.push_back(std::move(item));
+    }
+    const ImPlot3DItemDrawStats* items3D = ImPlot3D::GetItemDrawStats(&count);
+    for (int i = 0; i < count; i++) {
+        DrawItemStats item;
+        item.plot = items3D[i].PlotTitle;
+        item.label = items3D[i].Label;
+        item.is3D = true;
+        item.vtxCount = items3D[i].VtxCount;
+        item.idxCount = items3D[i].IdxCount;
+        m_Items.push_back(std::move(item));
+    }
+    std::sort(m_Items.begin(), m_Items.end(),
+        [](const DrawItemStats& a, const DrawItemStats& b) { return a.vtxCount > b.vtxCount; });
+
+    m_Frame++;
+}
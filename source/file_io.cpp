@@ -0,0 +1,260 @@
+/********************************************************************
+MIT License
+
+Copyright (c) 2025 loong22
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*********************************************************************/
+
+#include "../include/file_io.h"
+#include <algorithm>
+#include <cstring>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <cerrno>
+#include <cstdio>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+// 每次系统调用读写的字节数，也是进度回调的粒度
+constexpr size_t kIoChunkBytes = 8 * 1024 * 1024;
+
+#ifdef _WIN32
+std::wstring ToWidePath(const std::string& filePath) {
+    int size_needed = MultiByteToWideChar(CP_UTF8, 0, filePath.c_str(), -1, NULL, 0);
+    std::wstring widePath(size_needed, 0);
+    MultiByteToWideChar(CP_UTF8, 0, filePath.c_str(), -1, &widePath[0], size_needed);
+    if (!widePath.empty() && widePath.back() == 0) {
+        widePath.pop_back();
+    }
+    return widePath;
+}
+#endif
+
+// 保存时使用的临时文件，与目标文件位于同一目录，保证重命名不跨文件系统
+std::string GetTempPath(const std::string& filePath) {
+    return filePath + ".saving";
+}
+
+} // namespace
+
+#ifdef _WIN32
+
+bool LoadFile(const std::string& filePath, std::string& content, const FileProgressCallback& onProgress) {
+    content.clear();
+    HANDLE file = CreateFileW(ToWidePath(filePath).c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE,
+        nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize)) {
+        CloseHandle(file);
+        return false;
+    }
+    const uint64_t total = static_cast<uint64_t>(fileSize.QuadPart);
+    content.resize(static_cast<size_t>(total));
+
+    uint64_t processed = 0;
+    bool ok = true;
+    while (processed < total) {
+        const DWORD request = static_cast<DWORD>(std::min<uint64_t>(kIoChunkBytes, total - processed));
+        DWORD bytesRead = 0;
+        if (!ReadFile(file, &content[static_cast<size_t>(processed)], request, &bytesRead, nullptr)) {
+            ok = false;
+            break;
+        }
+        if (bytesRead == 0) break;   // 文件在读取期间变短
+        processed += bytesRead;
+        if (onProgress && !onProgress(processed, total)) {
+            ok = false;
+            break;
+        }
+    }
+    CloseHandle(file);
+
+    if (!ok) {
+        std::string().swap(content);
+        return false;
+    }
+    content.resize(static_cast<size_t>(processed));
+    return true;
+}
+
+bool SaveFile(const std::string& filePath, const std::string& content, const FileProgressCallback& onProgress) {
+    const std::wstring targetPath = ToWidePath(filePath);
+    const std::wstring tempPath = ToWidePath(GetTempPath(filePath));
+    HANDLE file = CreateFileW(tempPath.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS,
+        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+
+    const uint64_t total = content.size();
+    uint64_t processed = 0;
+    bool ok = true;
+    while (ok && processed < total) {
+        const DWORD request = static_cast<DWORD>(std::min<uint64_t>(kIoChunkBytes, total - processed));
+        DWORD bytesWritten = 0;
+        ok = WriteFile(file, content.data() + processed, request, &bytesWritten, nullptr) && bytesWritten == request;
+        processed += bytesWritten;
+        if (ok && onProgress) ok = onProgress(processed, total);
+    }
+    // 重命名之前先把数据刷到磁盘，避免断电后留下已替换但内容不完整的文件
+    ok = ok && FlushFileBuffers(file);
+    CloseHandle(file);
+
+    ok = ok && MoveFileExW(tempPath.c_str(), targetPath.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH);
+    if (!ok) {
+        DeleteFileW(tempPath.c_str());
+    }
+    return ok;
+}
+
+#else
+
+bool LoadFile(const std::string& filePath, std::string& content, const FileProgressCallback& onProgress) {
+    content.clear();
+    int fd = open(filePath.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat fileInfo;
+    if (fstat(fd, &fileInfo) != 0) {
+        close(fd);
+        return false;
+    }
+#ifdef POSIX_FADV_SEQUENTIAL
+    posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+    const uint64_t total = static_cast<uint64_t>(fileInfo.st_size);
+    content.resize(static_cast<size_t>(total));
+
+    uint64_t processed = 0;
+    bool ok = true;
+    while (processed < total) {
+        const size_t request = static_cast<size_t>(std::min<uint64_t>(kIoChunkBytes, total - processed));
+        ssize_t bytesRead = read(fd, &content[static_cast<size_t>(processed)], request);
+        if (bytesRead < 0 && errno == EINTR) continue;
+        if (bytesRead < 0) {
+            ok = false;
+            break;
+        }
+        if (bytesRead == 0) break;   // 文件在读取期间变短
+        processed += static_cast<uint64_t>(bytesRead);
+        if (onProgress && !onProgress(processed, total)) {
+            ok = false;
+            break;
+        }
+    }
+    close(fd);
+
+    if (!ok) {
+        std::string().swap(content);
+        return false;
+    }
+    content.resize(static_cast<size_t>(processed));
+    return true;
+}
+
+bool SaveFile(const std::string& filePath, const std::string& content, const FileProgressCallback& onProgress) {
+    // 沿用原文件的权限，新文件按默认权限创建
+    struct stat targetInfo;
+    const bool targetExists = stat(filePath.c_str(), &targetInfo) == 0;
+    const std::string tempPath = GetTempPath(filePath);
+    int fd = open(tempPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    if (fd < 0) return false;
+    if (targetExists) {
+        fchmod(fd, targetInfo.st_mode & 07777);
+    }
+
+    const uint64_t total = content.size();
+    uint64_t processed = 0;
+    bool ok = true;
+    while (ok && processed < total) {
+        const size_t request = static_cast<size_t>(std::min<uint64_t>(kIoChunkBytes, total - processed));
+        ssize_t bytesWritten = write(fd, content.data() + processed, request);
+        if (bytesWritten < 0 && errno == EINTR) continue;
+        ok = bytesWritten > 0;
+        if (!ok) break;
+        processed += static_cast<uint64_t>(bytesWritten);
+        if (onProgress) ok = onProgress(processed, total);
+    }
+    // 重命名之前先把数据刷到磁盘，避免断电后留下已替换但内容不完整的文件
+    ok = ok && fsync(fd) == 0;
+    ok = (close(fd) == 0) && ok;
+
+    ok = ok && rename(tempPath.c_str(), filePath.c_str()) == 0;
+    if (!ok) {
+        unlink(tempPath.c_str());
+    }
+    return ok;
+}
+
+#endif
+
+LineEnding NormalizeLineEndings(std::string& content) {
+    size_t newlines = 0;
+    for (size_t pos = content.find('\n'); pos != std::string::npos; pos = content.find('\n', pos + 1)) {
+        if (pos == 0 || content[pos - 1] != '\r') return LineEnding::LF;
+        newlines++;
+    }
+    if (newlines == 0) return LineEnding::LF;
+
+    // 逐段前移，每段以 \r\n 结束，只丢掉其中的 \r
+    char* data = &content[0];
+    const size_t size = content.size();
+    size_t in = 0, out = 0;
+    while (in < size) {
+        const char* newline = static_cast<const char*>(memchr(data + in, '\n', size - in));
+        const size_t segmentEnd = newline ? static_cast<size_t>(newline - data) - 1 : size;
+        memmove(data + out, data + in, segmentEnd - in);
+        out += segmentEnd - in;
+        if (!newline) break;
+        data[out++] = '\n';
+        in = segmentEnd + 2;
+    }
+    content.resize(out);
+    return LineEnding::CRLF;
+}
+
+void RestoreLineEndings(const std::string& content, LineEnding lineEnding, std::string& out) {
+    if (lineEnding == LineEnding::LF) {
+        out = content;
+        return;
+    }
+    out.clear();
+    out.reserve(content.size() + static_cast<size_t>(std::count(content.begin(), content.end(), '\n')));
+    size_t pos = 0;
+    while (pos < content.size()) {
+        const size_t newline = content.find('\n', pos);
+        if (newline == std::string::npos) {
+            out.append(content, pos, std::string::npos);
+            break;
+        }
+        out.append(content, pos, newline - pos);
+        out += "\r\n";
+        pos = newline + 1;
+    }
+}
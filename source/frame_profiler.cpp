@@ -0,0 +1,140 @@
+/********************************************************************
+MIT License
+
+Copyright (c) 2025 loong22
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*********************************************************************/
+
+#include "../include/frame_profiler.h"
+#include "../include/file_io.h"
+#include <chrono>
+#include <cstdio>
+
+FrameProfiler::FrameProfiler()
+    : m_Frames(kFrameCapacity)
+    , m_Samples(static_cast<size_t>(kFrameCapacity) * kSampleCapacity) {
+    m_Origin = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+FrameProfiler& GetFrameProfiler() {
+    static FrameProfiler profiler;
+    return profiler;
+}
+
+int64_t FrameProfiler::Now() const {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count() - m_Origin;
+}
+
+void FrameProfiler::BeginFrame() {
+    if (m_Paused) return;
+    ProfileFrame& frame = m_Frames[m_FrameIndex % kFrameCapacity];
+    frame.index = m_FrameIndex;
+    frame.begin = Now();
+    frame.end = frame.begin;
+    frame.sampleCount = 0;
+    frame.droppedCount = 0;
+    m_Depth = 0;
+    m_InFrame = true;
+}
+
+void FrameProfiler::EndFrame() {
+    if (!m_InFrame) return;
+    const size_t slot = m_FrameIndex % kFrameCapacity;
+    ProfileFrame& frame = m_Frames[slot];
+    frame.end = Now();
+    // 没有正常结束的区段截止到帧尾
+    ProfileSample* samples = &m_Samples[slot * kSampleCapacity];
+    for (int i = 0; i < frame.sampleCount; i++) {
+        if (samples[i].end < samples[i].begin) samples[i].end = frame.end - frame.begin;
+    }
+    m_InFrame = false;
+    m_FrameIndex++;
+    m_Completed.store(m_FrameIndex, std::memory_order_release);
+}
+
+int FrameProfiler::BeginSample(const char* name) {
+    if (!m_InFrame) return -1;
+    ProfileFrame& frame = m_Frames[m_FrameIndex % kFrameCapacity];
+    const int depth = m_Depth++;
+    if (frame.sampleCount == kSampleCapacity) {
+        // 仍然计入嵌套层数，让之后的区段深度正确
+        frame.droppedCount++;
+        return kSampleCapacity;
+    }
+    const int index = frame.sampleCount++;
+    ProfileSample& sample = m_Samples[(m_FrameIndex % kFrameCapacity) * kSampleCapacity + index];
+    sample.name = name;
+    sample.depth = depth;
+    sample.begin = Now() - frame.begin;
+    sample.end = -1;
+    return index;
+}
+
+void FrameProfiler::EndSample(int slot) {
+    if (slot < 0 || !m_InFrame) return;
+    m_Depth--;
+    if (slot == kSampleCapacity) return;
+    const ProfileFrame& frame = m_Frames[m_FrameIndex % kFrameCapacity];
+    m_Samples[(m_FrameIndex % kFrameCapacity) * kSampleCapacity + slot].end = Now() - frame.begin;
+}
+
+int FrameProfiler::GetFrameCount() const {
+    const uint64_t completed = m_Completed.load(std::memory_order_acquire);
+    return static_cast<int>(completed < kFrameCapacity - 1 ? completed : kFrameCapacity - 1);
+}
+
+int FrameProfiler::GetSlot(int age) const {
+    const uint64_t completed = m_Completed.load(std::memory_order_acquire);
+    return static_cast<int>((completed - 1 - static_cast<uint64_t>(age)) % kFrameCapacity);
+}
+
+const ProfileFrame& FrameProfiler::GetFrame(int age) const {
+    return m_Frames[GetSlot(age)];
+}
+
+const ProfileSample* FrameProfiler::GetSamples(int age) const {
+    return &m_Samples[static_cast<size_t>(GetSlot(age)) * kSampleCapacity];
+}
+
+bool FrameProfiler::ExportCsv(const std::string& filePath, std::string& error) const {
+    std::string csv = "frame,frame_begin_ms,frame_ms,name,depth,begin_ms,duration_ms\n";
+    char line[256];
+    // 从旧到新输出
+    for (int age = GetFrameCount() - 1; age >= 0; age--) {
+        const ProfileFrame& frame = GetFrame(age);
+        const ProfileSample* samples = GetSamples(age);
+        const double frameBegin = frame.begin * 1e-6;
+        const double frameMs = (frame.end - frame.begin) * 1e-6;
+        for (int i = 0; i < frame.sampleCount; i++) {
+            const ProfileSample& sample = samples[i];
+            snprintf(line, sizeof(line), "%llu,%.3f,%.3f,\"%s\",%d,%.3f,%.3f\n",
+                static_cast<unsigned long long>(frame.index), frameBegin, frameMs, sample.name, sample.depth,
+                sample.begin * 1e-6, (sample.end - sample.begin) * 1e-6);
+            csv += line;
+        }
+    }
+    if (!SaveFile(filePath, csv)) {
+        error = u8"无法写入文件: " + filePath;
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,668 @@
+/********************************************************************
+MIT License
+
+Copyright (c) 2025 loong22
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*********************************************************************/
+
+// 无界面运行程序：CPU 光栅化后端 + 脚本输入的空平台层，在没有 GPU 的 Linux 构建机上渲染界面，
+// 用于性能测试和截图比对。
+//
+// 用法: SU2GUI_Headless [选项]
+//   --size WxH           画面大小，默认 1280x720
+//   --frames N           渲染帧数，默认取脚本最后一帧 + 1（至少 3 帧，让窗口布局稳定）
+//   --threads N          光栅化线程数，0 为按 CPU 核数
+//   --plot-threads N     ImPlot 生成图元的线程数，0 为按 CPU 核数，默认 1（单线程）
+//   --script FILE        输入脚本，格式见 imgui_impl_null.h
+//   --scene NAME         imgui / implot / implot3d / su2 / all，默认 all
+//   --font FILE [SIZE]   使用 TTF 字体（例如中文字体），默认使用内置字体
+//   --log FILE           读取 SU2 屏幕输出日志或 history.csv，显示日志并绘制收敛曲线
+//   --mesh FILE          读取 .su2 网格
+//   --out FILE.ppm       保存最后一帧
+//   --compare FILE.ppm   与参考图比较，不一致时返回 2
+//   --tolerance N        比较时每个通道允许的差值，默认 0
+//   --max-diff N         允许不一致的像素数，默认 0
+//   --diff FILE.ppm      保存差异图（不一致的像素为红色）
+//   --bench              输出每帧界面和光栅化耗时
+//   --profile FILE.csv   导出各阶段的逐帧耗时（最多保留最近 240 帧）
+//   --bench-transform    测量线性、对数、对称对数和时间坐标轴上逐点与批量（各 SIMD 指令集）坐标变换的速度后退出
+//   --bench-heatmap      测量大矩阵在 PlotHeatmap 与 PlotHeatmapPyramid（数据版本不变 / 每帧改变）下逐步放大时的每帧耗时后退出
+//   --bench-histogram    测量 BinHistogram / BinHistogram2D 在固定范围、自动范围、Scott 分箱和缓存命中时的耗时后退出
+//   --bench-density      测量大量散点按标记绘制与按 ImPlotScatterFlags_Density 密度图绘制（有无数据版本、平移）的每帧耗时后退出
+
+#include "imgui.h"
+#include "imgui_impl_null.h"
+#include "imgui_impl_soft.h"
+#include "implot.h"
+#include "implot3d.h"
+#include "implot_internal.h"
+#include "../../include/app_views.h"
+#include "../../include/frame_profiler.h"
+#include "../../include/su2_history.h"
+#include "../../include/su2_mesh.h"
+#include "../../include/worker_pool.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct HeadlessOptions {
+    int width = 1280;
+    int height = 720;
+    int frames = -1;
+    int threads = 0;
+    int plotThreads = 1;
+    std::string script;
+    std::string scene = "all";
+    std::string font;
+    float fontSize = 15.0f;
+    std::string logFile;
+    std::string meshFile;
+    std::string outFile;
+    std::string compareFile;
+    std::string diffFile;
+    std::string profileFile;
+    int tolerance = 0;
+    long maxDiffPixels = 0;
+    bool bench = false;
+    bool benchTransform = false;
+    bool benchHeatmap = false;
+    bool benchHistogram = false;
+    bool benchDensity = false;
+};
+
+// ImPlot 的纹理交给软件渲染后端
+ImTextureID CreatePlotTexture(const ImU32* pixels, int width, int height, void*) {
+    return ImGui_ImplSoft_CreateTexture(pixels, width, height);
+}
+
+void UpdatePlotTexture(ImTextureID texId, const ImU32* pixels, int width, int height, void*) {
+    ImGui_ImplSoft_UpdateTexture(texId, pixels, width, height);
+}
+
+void DestroyPlotTexture(ImTextureID texId, void*) {
+    ImGui_ImplSoft_DestroyTexture(texId);
+}
+
+struct HeadlessScene {
+    LogSource log;
+    LogSearcher searcher;   // 不启动搜索，日志按普通模式显示
+    Su2History history;
+    Su2Mesh mesh;
+};
+
+void PrintUsage() {
+    printf("Usage: SU2GUI_Headless [--size WxH] [--frames N] [--threads N] [--plot-threads N] [--script FILE]\n"
+           "                       [--scene imgui|implot|implot3d|su2|all] [--font FILE [SIZE]] [--log FILE]\n"
+           "                       [--mesh FILE] [--out FILE.ppm] [--compare FILE.ppm] [--tolerance N]\n"
+           "                       [--max-diff N] [--diff FILE.ppm] [--bench] [--profile FILE.csv]\n"
+           "                       [--bench-transform] [--bench-heatmap] [--bench-histogram]\n"
+           "                       [--bench-density]\n");
+}
+
+bool ParseOptions(int argc, char** argv, HeadlessOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (arg == "--size" && hasValue) {
+            if (sscanf(argv[++i], "%dx%d", &options.width, &options.height) != 2 || options.width <= 0 || options.height <= 0) return false;
+        } else if (arg == "--frames" && hasValue) {
+            options.frames = atoi(argv[++i]);
+        } else if (arg == "--threads" && hasValue) {
+            options.threads = atoi(argv[++i]);
+        } else if (arg == "--plot-threads" && hasValue) {
+            options.plotThreads = atoi(argv[++i]);
+        } else if (arg == "--script" && hasValue) {
+            options.script = argv[++i];
+        } else if (arg == "--scene" && hasValue) {
+            options.scene = argv[++i];
+        } else if (arg == "--font" && hasValue) {
+            options.font = argv[++i];
+            if (i + 1 < argc && argv[i + 1][0] != '-') options.fontSize = (float)atof(argv[++i]);
+        } else if (arg == "--log" && hasValue) {
+            options.logFile = argv[++i];
+        } else if (arg == "--mesh" && hasValue) {
+            options.meshFile = argv[++i];
+        } else if (arg == "--out" && hasValue) {
+            options.outFile = argv[++i];
+        } else if (arg == "--compare" && hasValue) {
+            options.compareFile = argv[++i];
+        } else if (arg == "--diff" && hasValue) {
+            options.diffFile = argv[++i];
+        } else if (arg == "--tolerance" && hasValue) {
+            options.tolerance = atoi(argv[++i]);
+        } else if (arg == "--max-diff" && hasValue) {
+            options.maxDiffPixels = atol(argv[++i]);
+        } else if (arg == "--profile" && hasValue) {
+            options.profileFile = argv[++i];
+        } else if (arg == "--bench") {
+            options.bench = true;
+        } else if (arg == "--bench-transform") {
+            options.benchTransform = true;
+        } else if (arg == "--bench-heatmap") {
+            options.benchHeatmap = true;
+        } else if (arg == "--bench-histogram") {
+            options.benchHistogram = true;
+        } else if (arg == "--bench-density") {
+            options.benchDensity = true;
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+// 坐标变换的微基准：每种坐标轴上比较逐点的 PlotToPixels 与各指令集的 PlotToPixelsBatch。
+// 线性和时间坐标轴上批量结果应与逐点结果逐位一致，对数坐标轴上的向量化对数只有浮点舍入级的差别，输出最大像素误差
+
+void RunTransformBenchmark() {
+    constexpr int kPointCount = 1 << 20;
+    constexpr int kRepeats = 20;
+    struct AxisCase {
+        const char* name;
+        ImPlotScale scale;
+        double min, max;
+    };
+    const AxisCase cases[] = {
+        {"linear", ImPlotScale_Linear, -1.0e3, 1.0e3},
+        {"log10", ImPlotScale_Log10, 1.0e-3, 1.0e6},
+        {"symlog", ImPlotScale_SymLog, -1.0e4, 1.0e4},
+        {"time", ImPlotScale_Time, 1.7e9, 1.7e9 + 86400.0},
+    };
+    std::vector<double> xs(kPointCount), ys(kPointCount);
+    std::vector<ImVec2> expected(kPointCount), pixels(kPointCount);
+
+    ImGui_ImplSoft_NewFrame();
+    ImGui_ImplNull_NewFrame();
+    ImGui::NewFrame();
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(800, 600));
+    ImGui::Begin("Transform benchmark");
+    printf("%-8s %-8s %10s %12s\n", "axis", "kernel", "ms", "Mpoints/s");
+    for (const AxisCase& axis : cases) {
+        for (int i = 0; i < kPointCount; i++) {
+            const double t = (i + 0.5) / kPointCount;
+            xs[i] = axis.scale == ImPlotScale_Log10 ? axis.min * pow(axis.max / axis.min, t) : axis.min + (axis.max - axis.min) * t;
+            ys[i] = sin(i * 0.001) * 0.9;
+        }
+        if (!ImPlot::BeginPlot(axis.name, ImVec2(-1, 150))) continue;
+        ImPlot::SetupAxisScale(ImAxis_X1, axis.scale);
+        ImPlot::SetupAxesLimits(axis.min, axis.max, -1.0, 1.0, ImPlotCond_Always);
+        ImPlot::SetupFinish();
+
+        auto report = [&](const char* kernel, double ms) {
+            printf("%-8s %-8s %10.2f %12.1f\n", axis.name, kernel, ms, kPointCount / (ms * 1000.0));
+        };
+        auto start = std::chrono::steady_clock::now();
+        for (int r = 0; r < kRepeats; r++) {
+            for (int i = 0; i < kPointCount; i++) {
+                expected[i] = ImPlot::PlotToPixels(xs[i], ys[i]);
+            }
+        }
+        report("point", std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / kRepeats);
+
+        const ImPlotSimd best = ImPlot::GetSimdSupport();
+        for (ImPlotSimd simd = ImPlotSimd_None; simd <= best; simd++) {
+            if (simd != ImPlotSimd_None && simd != best && !(best == ImPlotSimd_AVX2 && simd == ImPlotSimd_SSE2)) continue;
+            const ImPlotSimd previous = ImPlot::SetTransformSimd(simd);
+            start = std::chrono::steady_clock::now();
+            for (int r = 0; r < kRepeats; r++) {
+                ImPlot::PlotToPixelsBatch(xs.data(), ys.data(), kPointCount, pixels.data());
+            }
+            const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / kRepeats;
+            ImPlot::SetTransformSimd(previous);
+            report(ImPlot::GetSimdName(simd), ms);
+            if (memcmp(pixels.data(), expected.data(), pixels.size() * sizeof(ImVec2)) != 0) {
+                float maxError = 0.0f;
+                for (int i = 0; i < kPointCount; i++) {
+                    maxError = std::max(maxError, std::max(fabsf(pixels[i].x - expected[i].x), fabsf(pixels[i].y - expected[i].y)));
+                }
+                printf("  %s results differ from PlotToPixels by up to %g px\n", ImPlot::GetSimdName(simd), maxError);
+            }
+        }
+        ImPlot::EndPlot();
+    }
+    ImGui::End();
+    ImGui::EndFrame();
+}
+
+// 基准测试中渲染一帧：plot 在占满画面的窗口里的一张图表中绘制，累加界面与光栅化耗时
+template <typename PlotFn>
+void RenderBenchmarkFrame(const char* title, PlotFn plot, double& uiMs, double& rasterMs) {
+    const auto frameStart = std::chrono::steady_clock::now();
+    ImGui_ImplSoft_NewFrame();
+    ImGui_ImplNull_NewFrame();
+    ImGui::NewFrame();
+    const ImGuiIO& io = ImGui::GetIO();
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(io.DisplaySize);
+    ImGui::Begin(title);
+    if (ImPlot::BeginPlot(title, ImVec2(-1, -1))) {
+        plot();
+        ImPlot::EndPlot();
+    }
+    ImGui::End();
+    ImGui::Render();
+    const auto rasterStart = std::chrono::steady_clock::now();
+    ImGui_ImplSoft_ClearFramebuffer(IM_COL32(0, 0, 0, 255));
+    ImGui_ImplSoft_RenderDrawData(ImGui::GetDrawData());
+    const auto frameEnd = std::chrono::steady_clock::now();
+    uiMs += std::chrono::duration<double, std::milli>(rasterStart - frameStart).count();
+    rasterMs += std::chrono::duration<double, std::milli>(frameEnd - rasterStart).count();
+}
+
+// 热力图的基准：4096x4096 的矩阵从全图放大到 1/256 的区域。PlotHeatmap 每帧为整个矩阵生成纹理，
+// PlotHeatmapPyramid 只绘制可见的瓦片；数据版本每帧改变时金字塔每帧重建，用来衡量原地修改数据的代价
+void RunHeatmapBenchmark() {
+    constexpr int kSize = 4096;
+    constexpr int kFrames = 60;
+    std::vector<float> values(static_cast<size_t>(kSize) * kSize);
+    for (int r = 0; r < kSize; r++) {
+        for (int c = 0; c < kSize; c++) {
+            values[static_cast<size_t>(r) * kSize + c] = (float)(sin(r * 0.01) * cos(c * 0.013) + 0.1 * sin((r + c) * 0.2));
+        }
+    }
+    enum Mode { Heatmap, Pyramid, PyramidEdit };
+    const char* names[] = {"heatmap", "pyramid", "pyramid-edit"};
+    printf("%-14s %10s %10s %8s\n", "mode", "ui ms", "raster ms", "tiles");
+    for (int mode = Heatmap; mode <= PyramidEdit; mode++) {
+        double uiMs = 0.0, rasterMs = 0.0;
+        for (int frame = 0; frame < kFrames; frame++) {
+            // 可见区域的边长每帧缩小相同的比例，最后为全图的 1/16
+            const double half = 0.5 * pow(1.0 / 16.0, frame / (kFrames - 1.0));
+            RenderBenchmarkFrame(names[mode], [&] {
+                ImPlot::SetupAxesLimits(0.5 - half, 0.5 + half, 0.5 - half, 0.5 + half, ImPlotCond_Always);
+                if (mode == Heatmap) {
+                    ImPlot::PlotHeatmap("values", values.data(), kSize, kSize, -1.1, 1.1, nullptr);
+                } else {
+                    ImPlot::SetNextItemDataVersion(mode == PyramidEdit ? (ImU64)frame : 0);
+                    ImPlot::PlotHeatmapPyramid("values", values.data(), kSize, kSize, -1.1, 1.1);
+                }
+            }, uiMs, rasterMs);
+        }
+        printf("%-14s %10.2f %10.2f %8d\n", names[mode], uiMs / kFrames, rasterMs / kFrames, GImPlot->HeatmapTiles.GetAliveCount());
+    }
+}
+
+// 直方图分箱的基准：每次调用换一个数据版本，使结果不能从缓存取得；cached 一行的版本不变，测量缓存命中。
+// 固定范围和 Sturges 分箱不需要统计最小值、最大值，比自动范围和 Scott 分箱少一遍数据
+void RunHistogramBenchmark() {
+    constexpr int kCount = 1 << 24;
+    constexpr int kRepeats = 10;
+    std::vector<double> xs(kCount), ys(kCount);
+    for (int i = 0; i < kCount; i++) {
+        // 两组近似正态分布的样本
+        const double u = (i + 0.5) / kCount;
+        xs[i] = sin(i * 0.7548776662) + sin(i * 0.5698402910) + sin(i * 0.3247179572);
+        ys[i] = xs[i] * 0.5 + cos(u * 6283.185307);
+    }
+    struct HistogramCase {
+        const char* name;
+        bool twoDimensional;
+        int bins;
+        ImPlotRect range;
+        bool cached;
+    };
+    const HistogramCase cases[] = {
+        {"range", false, 256, ImPlotRect(-3.0, 3.0, 0.0, 0.0), false},
+        {"sturges", false, ImPlotBin_Sturges, ImPlotRect(-3.0, 3.0, 0.0, 0.0), false},
+        {"auto", false, 256, ImPlotRect(), false},
+        {"scott", false, ImPlotBin_Scott, ImPlotRect(), false},
+        {"cached", false, ImPlotBin_Scott, ImPlotRect(), true},
+        {"2d-range", true, 256, ImPlotRect(-3.0, 3.0, -3.0, 3.0), false},
+        {"2d-auto", true, 256, ImPlotRect(), false},
+        {"2d-scott", true, ImPlotBin_Scott, ImPlotRect(), false},
+    };
+
+    ImGui_ImplSoft_NewFrame();
+    ImGui_ImplNull_NewFrame();
+    ImGui::NewFrame();
+    printf("%-10s %10s %10s %12s %10s\n", "case", "ms", "Msamples/s", "bins", "counted");
+    ImU64 version = 0;
+    for (const HistogramCase& c : cases) {
+        ImPlotHistogramBins bins;
+        const auto start = std::chrono::steady_clock::now();
+        for (int r = 0; r < kRepeats; r++) {
+            if (!c.cached) version++;
+            bins = c.twoDimensional
+                ? ImPlot::BinHistogram2D(xs.data(), ys.data(), kCount, version, c.bins, c.bins, c.range)
+                : ImPlot::BinHistogram(xs.data(), kCount, version, c.bins, c.range.X);
+        }
+        const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / kRepeats;
+        char binText[32];
+        snprintf(binText, sizeof(binText), c.twoDimensional ? "%dx%d" : "%d", bins.XBins, bins.YBins);
+        printf("%-10s %10.3f %10.1f %12s %10d\n", c.name, ms, kCount / (ms * 1000.0), binText, bins.Counted);
+    }
+    ImGui::EndFrame();
+}
+
+// 散点密度图的基准：同一组点按标记绘制，和按密度图在每帧重新计数（无数据版本）、坐标轴不变时取缓存、
+// 坐标轴每帧平移时重新计数三种情况下绘制，输出平均每帧耗时和绘制的顶点数
+void RunDensityBenchmark() {
+    constexpr int kCount = 1 << 21;
+    constexpr int kFrames = 30;
+    std::vector<double> xs(kCount), ys(kCount);
+    for (int i = 0; i < kCount; i++) {
+        const double r = sqrt((i + 0.5) / kCount);
+        const double angle = i * 2.3999632297;   // 黄金角，点在圆盘内均匀分布
+        xs[i] = r * cos(angle) + 0.2 * sin(i * 0.001);
+        ys[i] = r * sin(angle) * 0.6;
+    }
+    enum Mode { Markers, Density, DensityCached, DensityPan };
+    const char* names[] = {"markers", "density", "density-cached", "density-pan"};
+    printf("%-16s %10s %10s %10s\n", "mode", "ui ms", "raster ms", "vertices");
+    for (int mode = Markers; mode <= DensityPan; mode++) {
+        double uiMs = 0.0, rasterMs = 0.0;
+        for (int frame = 0; frame < kFrames; frame++) {
+            const double offset = mode == DensityPan ? 0.01 * frame : 0.0;
+            RenderBenchmarkFrame(names[mode], [&] {
+                ImPlot::SetupAxesLimits(-1.5 + offset, 1.5 + offset, -1.0, 1.0, ImPlotCond_Always);
+                if (mode != Markers && mode != Density) ImPlot::SetNextItemDataVersion(0);
+                ImPlot::PlotScatter("points", xs.data(), ys.data(), kCount, mode == Markers ? 0 : ImPlotScatterFlags_Density);
+            }, uiMs, rasterMs);
+        }
+        printf("%-16s %10.2f %10.2f %10d\n", names[mode], uiMs / kFrames, rasterMs / kFrames, ImGui::GetDrawData()->TotalVtxCount);
+    }
+}
+
+// 与主程序一样为日志建立行索引，并把读到的内容交给收敛历史解析器
+bool LoadLog(const std::string& filePath, HeadlessScene& scene) {
+    if (!scene.log.Open(filePath)) return false;
+    Su2HistoryParser parser;
+    Su2HistoryUpdate update;
+    const bool ok = scene.log.Refresh([&](uint64_t offset, const char* data, size_t size) {
+        parser.FeedChunk(offset, data, size, update);
+    });
+    scene.history.Apply(update);
+    return ok;
+}
+
+// PPM（P6）只保存 RGB，比较时同样忽略 alpha
+bool WritePpm(const std::string& filePath, const ImU32* pixels, int width, int height) {
+    FILE* file = fopen(filePath.c_str(), "wb");
+    if (!file) return false;
+    fprintf(file, "P6\n%d %d\n255\n", width, height);
+    std::vector<unsigned char> row(static_cast<size_t>(width) * 3);
+    for (int y = 0; y < height; y++) {
+        const ImU32* src = pixels + static_cast<size_t>(y) * width;
+        for (int x = 0; x < width; x++) {
+            row[x * 3 + 0] = (unsigned char)((src[x] >> IM_COL32_R_SHIFT) & 0xFF);
+            row[x * 3 + 1] = (unsigned char)((src[x] >> IM_COL32_G_SHIFT) & 0xFF);
+            row[x * 3 + 2] = (unsigned char)((src[x] >> IM_COL32_B_SHIFT) & 0xFF);
+        }
+        fwrite(row.data(), 1, row.size(), file);
+    }
+    return fclose(file) == 0;
+}
+
+bool ReadPpm(const std::string& filePath, std::vector<unsigned char>& rgb, int& width, int& height) {
+    FILE* file = fopen(filePath.c_str(), "rb");
+    if (!file) return false;
+    int maxValue = 0;
+    bool ok = fscanf(file, "P6 %d %d %d", &width, &height, &maxValue) == 3 && maxValue == 255 && fgetc(file) != EOF;
+    if (ok) {
+        rgb.resize(static_cast<size_t>(width) * height * 3);
+        ok = fread(rgb.data(), 1, rgb.size(), file) == rgb.size();
+    }
+    fclose(file);
+    return ok;
+}
+
+// 返回不一致的像素数，尺寸不同时返回 -1
+long CompareWithReference(const HeadlessOptions& options, const ImU32* pixels, int width, int height) {
+    std::vector<unsigned char> reference;
+    int refWidth = 0, refHeight = 0;
+    if (!ReadPpm(options.compareFile, reference, refWidth, refHeight)) {
+        fprintf(stderr, "cannot read reference image '%s'\n", options.compareFile.c_str());
+        return -1;
+    }
+    if (refWidth != width || refHeight != height) {
+        fprintf(stderr, "reference image is %dx%d, frame is %dx%d\n", refWidth, refHeight, width, height);
+        return -1;
+    }
+
+    std::vector<ImU32> diff;
+    if (!options.diffFile.empty()) diff.assign(static_cast<size_t>(width) * height, IM_COL32(0, 0, 0, 255));
+    long diffPixels = 0;
+    int maxDelta = 0;
+    for (size_t i = 0, n = static_cast<size_t>(width) * height; i < n; i++) {
+        int delta = 0;
+        for (int c = 0; c < 3; c++) {
+            const int value = (pixels[i] >> (c * 8)) & 0xFF;
+            delta = std::max(delta, abs(value - reference[i * 3 + c]));
+        }
+        maxDelta = std::max(maxDelta, delta);
+        if (delta > options.tolerance) {
+            diffPixels++;
+            if (!diff.empty()) diff[i] = IM_COL32(255, 0, 0, 255);
+        } else if (!diff.empty()) {
+            // 一致的像素以灰度淡化显示，便于定位
+            const ImU32 p = pixels[i];
+            const int gray = (((p & 0xFF) + ((p >> 8) & 0xFF) + ((p >> 16) & 0xFF)) / 3) / 3;
+            diff[i] = IM_COL32(gray, gray, gray, 255);
+        }
+    }
+    printf("compare: %ld pixels differ (tolerance %d, max channel delta %d)\n", diffPixels, options.tolerance, maxDelta);
+    if (!diff.empty()) WritePpm(options.diffFile, diff.data(), width, height);
+    return diffPixels;
+}
+
+// 收敛曲线和日志正文直接调用主程序的窗口内容（app_views.h），网格另行绘制
+void ShowSu2Window(HeadlessScene& scene) {
+    ImGui::SetNextWindowPos(ImVec2(20, 20), ImGuiCond_FirstUseEver);
+    ImGui::SetNextWindowSize(ImVec2(640, 640), ImGuiCond_FirstUseEver);
+    if (ImGui::Begin("SU2")) {
+        ShowConvergencePlots(scene.history, 600.0f);
+        const Su2Mesh& mesh = scene.mesh;
+        if (!mesh.triangles.empty() && ImPlot3D::BeginPlot("Mesh", ImVec2(-1, -1))) {
+            ImPlot3D::SetupAxesLimits(mesh.boundsMin.x, mesh.boundsMax.x, mesh.boundsMin.y, mesh.boundsMax.y,
+                mesh.boundsMin.z, mesh.boundsMax.z + 1e-3f, ImPlot3DCond_Once);
+            ImPlot3D::PlotMesh("SU2", mesh.points.data(), mesh.triangles.data(), (int)mesh.points.size(), (int)mesh.triangles.size());
+            PROFILE_SCOPE("ImPlot3D::EndPlot");
+            ImPlot3D::EndPlot();
+        }
+    }
+    ImGui::End();
+
+    if (!scene.log.IsOpen()) return;
+    ImGui::SetNextWindowPos(ImVec2(680, 360), ImGuiCond_FirstUseEver);
+    ImGui::SetNextWindowSize(ImVec2(560, 320), ImGuiCond_FirstUseEver);
+    if (ImGui::Begin("Log")) {
+        ImGui::BeginChild("LogContent", ImVec2(0, 0), true, ImGuiWindowFlags_HorizontalScrollbar);
+        RenderLogContent(scene.log, scene.searcher, true, false, 0.0f, false, -1, false);
+        ImGui::EndChild();
+    }
+    ImGui::End();
+}
+
+void ShowScene(const HeadlessOptions& options, HeadlessScene& scene) {
+    const bool all = options.scene == "all";
+    if (all || options.scene == "imgui") {
+        PROFILE_SCOPE("ImGui::ShowDemoWindow");
+        ImGui::SetNextWindowPos(ImVec2(680, 20), ImGuiCond_FirstUseEver);
+        ImGui::ShowDemoWindow();
+    }
+    if (all || options.scene == "implot") {
+        PROFILE_SCOPE("ImPlot::ShowDemoWindow");
+        ImGui::SetNextWindowPos(ImVec2(60, 60), ImGuiCond_FirstUseEver);
+        ImPlot::ShowDemoWindow();
+    }
+    if (all || options.scene == "implot3d") {
+        PROFILE_SCOPE("ImPlot3D::ShowDemoWindow");
+        ImGui::SetNextWindowPos(ImVec2(100, 100), ImGuiCond_FirstUseEver);
+        ImPlot3D::ShowDemoWindow();
+    }
+    if (all || options.scene == "su2") {
+        PROFILE_SCOPE("ShowSu2Window");
+        ShowSu2Window(scene);
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    HeadlessOptions options;
+    if (!ParseOptions(argc, argv, options)) {
+        PrintUsage();
+        return 1;
+    }
+
+    HeadlessScene scene;
+    if (!options.logFile.empty() && !LoadLog(options.logFile, scene)) {
+        fprintf(stderr, "cannot read log '%s'\n", options.logFile.c_str());
+        return 1;
+    }
+    if (!options.meshFile.empty()) {
+        Su2LoadStats stats;
+        std::string error;
+        if (!LoadSu2Mesh(options.meshFile, scene.mesh, stats, error)) {
+            fprintf(stderr, "%s\n", error.c_str());
+            return 1;
+        }
+        printf("mesh: %zu points, %zu triangles, %.1f MB/s\n", scene.mesh.points.size(), scene.mesh.triangles.size() / 3, stats.GetMegabytesPerSecond());
+    }
+
+    IMGUI_CHECKVERSION();
+    ImGui::CreateContext();
+    ImPlot::CreateContext();
+    ImPlot3D::CreateContext();
+    ImPlot::SetTextureBackend(&CreatePlotTexture, &UpdatePlotTexture, &DestroyPlotTexture, nullptr);
+    WorkerPool plotWorkers;
+    if (options.plotThreads != 1) {
+        plotWorkers.Start(options.plotThreads);
+        ImPlot::SetParallelFor(&WorkerPool::ParallelForCallback, &plotWorkers, plotWorkers.GetThreadCount());
+    }
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = nullptr;   // 每次运行布局一致
+    io.LogFilename = nullptr;
+    ImGui::StyleColorsDark();
+    if (!options.font.empty() && !io.Fonts->AddFontFromFileTTF(options.font.c_str(), options.fontSize, nullptr, io.Fonts->GetGlyphRangesChineseFull())) {
+        fprintf(stderr, "cannot load font '%s'\n", options.font.c_str());
+        return 1;
+    }
+
+    ImGui_ImplNull_Init(options.width, options.height);
+    ImGui_ImplSoft_Init(options.width, options.height, options.threads);
+    if (!options.script.empty()) {
+        char error[256] = "";
+        if (!ImGui_ImplNull_LoadScript(options.script.c_str(), error, sizeof(error))) {
+            fprintf(stderr, "script: %s\n", error);
+            return 1;
+        }
+    }
+    if (options.benchTransform) {
+        RunTransformBenchmark();
+    }
+    if (options.benchHeatmap) {
+        RunHeatmapBenchmark();
+    }
+    if (options.benchHistogram) {
+        RunHistogramBenchmark();
+    }
+    if (options.benchDensity) {
+        RunDensityBenchmark();
+    }
+    if (options.benchTransform || options.benchHeatmap || options.benchHistogram || options.benchDensity) {
+        ImGui_ImplSoft_Shutdown();
+        ImGui_ImplNull_Shutdown();
+        ImPlot3D::DestroyContext();
+        ImPlot::DestroyContext();
+        ImGui::DestroyContext();
+        return 0;
+    }
+    int frames = options.frames;
+    if (frames < 0) frames = std::max(3, ImGui_ImplNull_GetLastScriptedFrame() + 1);
+
+    const ImU32 clearColor = IM_COL32(115, 140, 153, 255);
+    double totalUiMs = 0.0, totalRasterMs = 0.0;
+    for (int frame = 0; frame < frames; frame++) {
+        const auto frameStart = std::chrono::steady_clock::now();
+        GetFrameProfiler().BeginFrame();
+        {
+            PROFILE_SCOPE("NewFrame");
+            ImGui_ImplSoft_NewFrame();
+            ImGui_ImplNull_NewFrame();
+            ImGui::NewFrame();
+        }
+        ShowScene(options, scene);
+        {
+            PROFILE_SCOPE("ImGui::Render");
+            ImGui::Render();
+        }
+        const auto rasterStart = std::chrono::steady_clock::now();
+
+        {
+            PROFILE_SCOPE("ImGui_ImplSoft_RenderDrawData");
+            // 脚本可以改变显示大小，帧缓冲跟随
+            ImGui_ImplSoft_SetFramebufferSize((int)io.DisplaySize.x, (int)io.DisplaySize.y);
+            ImGui_ImplSoft_ClearFramebuffer(clearColor);
+            ImGui_ImplSoft_RenderDrawData(ImGui::GetDrawData());
+        }
+        GetFrameProfiler().EndFrame();
+        const auto frameEnd = std::chrono::steady_clock::now();
+
+        const double uiMs = std::chrono::duration<double, std::milli>(rasterStart - frameStart).count();
+        const double rasterMs = std::chrono::duration<double, std::milli>(frameEnd - rasterStart).count();
+        totalUiMs += uiMs;
+        totalRasterMs += rasterMs;
+        if (options.bench) {
+            const ImDrawData* drawData = ImGui::GetDrawData();
+            printf("frame %d: ui %.2f ms, raster %.2f ms, %d vertices, %d indices\n",
+                frame, uiMs, rasterMs, drawData->TotalVtxCount, drawData->TotalIdxCount);
+        }
+    }
+    if (options.bench && frames > 0) {
+        printf("average: ui %.2f ms, raster %.2f ms over %d frames\n", totalUiMs / frames, totalRasterMs / frames, frames);
+    }
+
+    int result = 0;
+    if (!options.profileFile.empty()) {
+        std::string error;
+        if (!GetFrameProfiler().ExportCsv(options.profileFile, error)) {
+            fprintf(stderr, "cannot write '%s'\n", options.profileFile.c_str());
+            result = 1;
+        }
+    }
+
+    int width = 0, height = 0;
+    const ImU32* pixels = ImGui_ImplSoft_GetFramebuffer(&width, &height);
+    if (!options.outFile.empty() && !WritePpm(options.outFile, pixels, width, height)) {
+        fprintf(stderr, "cannot write '%s'\n", options.outFile.c_str());
+        result = 1;
+    }
+    if (!options.compareFile.empty()) {
+        const long diffPixels = CompareWithReference(options, pixels, width, height);
+        if (diffPixels < 0) result = 1;
+        else if (diffPixels > options.maxDiffPixels) result = 2;
+    }
+
+    ImGui_ImplSoft_Shutdown();
+    ImGui_ImplNull_Shutdown();
+    ImPlot3D::DestroyContext();
+    ImPlot::DestroyContext();
+    ImGui::DestroyContext();
+    return result;
+}
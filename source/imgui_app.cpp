@@ -23,11 +23,16 @@ SOFTWARE.
 *********************************************************************/
 
 #include "../include/imgui_app.h"
+#include "../include/frame_profiler.h"
 #include "imgui.h"
 #include "imgui_internal.h"
+#include "imgui_impl_dx11.h"
 #include "implot.h"
 #include "implot3d.h"
+#include <algorithm>
+#include <cstring>
 #include <fstream>
+#include <memory>
 #include <sstream>
 #include <vector>
 #include <sys/stat.h>
@@ -36,32 +41,6 @@ SOFTWARE.
 // ===== 应用程序核心功能实现 =====
 
 // 文件操作函数
-bool SaveFile(const std::string& filePath, const std::string& content) {
-    std::ofstream file(filePath);
-    if (!file.is_open()) {
-        return false;
-    }
-    file << content;
-    file.close();
-    return true;
-}
-
-bool LoadFile(const std::string& filePath, std::string& content) {
-    std::ifstream file(filePath);
-    if (!file.is_open()) {
-        return false;
-    }
-    
-    content.clear();
-    std::string line;
-    while (std::getline(file, line)) {
-        content += line + "\n";
-    }
-    
-    file.close();
-    return true;
-}
-
 std::time_t GetFileLastModifiedTime(const std::string& filePath) {
     struct stat result;
     if (stat(filePath.c_str(), &result) == 0) {
@@ -70,6 +49,68 @@ std::time_t GetFileLastModifiedTime(const std::string& filePath) {
     return 0;
 }
 
+static std::string GetFileName(const std::string& filePath) {
+    size_t separator = filePath.find_last_of("/\\");
+    return separator == std::string::npos ? filePath : filePath.substr(separator + 1);
+}
+
+void OpenFileAsync(const std::string& filePath) {
+    if (g_AppState.fileJob != 0) return;
+
+    struct Result {
+        std::string content;
+        LineEnding lineEnding = LineEnding::LF;
+        bool ok = false;
+    };
+    auto result = std::make_shared<Result>();
+    g_AppState.fileJob = g_AppState.jobs.Submit(u8"打开 " + GetFileName(filePath),
+        [filePath, result](JobContext& context) {
+            result->ok = LoadFile(filePath, result->content, context.GetProgressCallback());
+            if (result->ok) result->lineEnding = NormalizeLineEndings(result->content);
+        },
+        [filePath, result](bool completed) {
+            g_AppState.fileJob = 0;
+            if (!completed) return;
+            if (!result->ok) {
+                g_AppState.jobMessage = u8"无法打开文件: " + filePath;
+                return;
+            }
+            g_AppState.currentFilePath = filePath;
+            g_AppState.fileContent.swap(result->content);
+            g_AppState.fileLineEnding = result->lineEnding;
+        });
+}
+
+void SaveFileAsync(const std::string& filePath) {
+    if (g_AppState.fileJob != 0) return;
+
+    // 保存提交时的内容快照，保存期间界面仍可修改 fileContent
+    // 编辑器中的换行都是 \n，按打开时的换行符写回，CRLF 文件不会混入单独的 \n
+    auto content = std::make_shared<const std::string>(g_AppState.fileContent);
+    const LineEnding lineEnding = g_AppState.fileLineEnding;
+    auto ok = std::make_shared<bool>(false);
+    g_AppState.fileJob = g_AppState.jobs.Submit(u8"保存 " + GetFileName(filePath),
+        [filePath, content, lineEnding, ok](JobContext& context) {
+            if (lineEnding == LineEnding::LF) {
+                *ok = SaveFile(filePath, *content, context.GetProgressCallback());
+                return;
+            }
+            std::string fileData;
+            RestoreLineEndings(*content, lineEnding, fileData);
+            *ok = SaveFile(filePath, fileData, context.GetProgressCallback());
+        },
+        [filePath, ok](bool completed) {
+            g_AppState.fileJob = 0;
+            if (!completed) return;
+            if (!*ok) {
+                g_AppState.jobMessage = u8"保存失败: " + filePath;
+                return;
+            }
+            // 与打开文件一样，只有写入成功后才切换当前文件
+            g_AppState.currentFilePath = filePath;
+        });
+}
+
 // 窗口约束函数
 void ConstrainWindowsToMainViewport() {
     ImGuiViewport* viewport = ImGui::GetMainViewport();
@@ -116,15 +157,96 @@ void ConstrainWindowsToMainViewport() {
     }
 }
 
+// 后台任务进度，固定显示在主视口右下角
+void ShowJobProgressWindow() {
+    static std::vector<JobStatus> jobs;
+    g_AppState.jobs.GetStatus(jobs);
+    if (jobs.empty() && g_AppState.jobMessage.empty()) return;
+
+    const ImGuiViewport* viewport = ImGui::GetMainViewport();
+    const float padding = 10.0f;
+    ImGui::SetNextWindowPos(ImVec2(viewport->WorkPos.x + viewport->WorkSize.x - padding,
+        viewport->WorkPos.y + viewport->WorkSize.y - padding), ImGuiCond_Always, ImVec2(1.0f, 1.0f));
+    ImGui::SetNextWindowBgAlpha(0.9f);
+    ImGuiWindowFlags flags = ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_AlwaysAutoResize |
+        ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoFocusOnAppearing | ImGuiWindowFlags_NoNav | ImGuiWindowFlags_NoMove;
+    if (ImGui::Begin("##JobProgress", nullptr, flags)) {
+        for (const JobStatus& job : jobs) {
+            ImGui::PushID(static_cast<int>(job.id));
+            ImGui::TextUnformatted(job.name.c_str());
+
+            char overlay[64];
+            float fraction = 0.0f;
+            const double megabytes = 1.0 / (1024.0 * 1024.0);
+            if (!job.running) {
+                snprintf(overlay, sizeof(overlay), u8"等待中");
+            } else if (job.total > 0) {
+                fraction = static_cast<float>(static_cast<double>(job.processed) / job.total);
+                snprintf(overlay, sizeof(overlay), "%.1f / %.1f MB", job.processed * megabytes, job.total * megabytes);
+            } else {
+                // 总量未知时显示来回移动的进度条
+                fraction = -1.0f * static_cast<float>(ImGui::GetTime());
+                snprintf(overlay, sizeof(overlay), "%.1f MB", job.processed * megabytes);
+            }
+            ImGui::ProgressBar(fraction, ImVec2(260.0f, 0.0f), overlay);
+            ImGui::SameLine();
+            ImGui::BeginDisabled(job.cancelRequested);
+            if (ImGui::Button(u8"取消")) {
+                g_AppState.jobs.Cancel(job.id);
+            }
+            ImGui::EndDisabled();
+            ImGui::PopID();
+        }
+
+        if (!g_AppState.jobMessage.empty()) {
+            ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.4f, 1.0f), "%s", g_AppState.jobMessage.c_str());
+            ImGui::SameLine();
+            if (ImGui::SmallButton(u8"关闭")) {
+                g_AppState.jobMessage.clear();
+            }
+        }
+    }
+    ImGui::End();
+}
+
+// ImPlot 通过 DX11 后端创建的纹理（大热力图整体绘制为一张纹理）
+static ImTextureID CreatePlotTexture(const ImU32* pixels, int width, int height, void*) {
+    return ImGui_ImplDX11_CreateTexture(pixels, width, height);
+}
+
+static void UpdatePlotTexture(ImTextureID texId, const ImU32* pixels, int width, int height, void*) {
+    ImGui_ImplDX11_UpdateTexture(texId, pixels, width, height);
+}
+
+static void DestroyPlotTexture(ImTextureID texId, void*) {
+    ImGui_ImplDX11_DestroyTexture(texId);
+}
+
 // ImPlot 初始化和清理
 void InitializeImPlot() {
     ImPlot::CreateContext();
     ImPlot3D::CreateContext();
+    ImPlot::SetTextureBackend(&CreatePlotTexture, &UpdatePlotTexture, &DestroyPlotTexture, nullptr);
+    ApplyParallelPlotting();
 }
 
 void CleanupImPlot() {
     ImPlot::DestroyContext();
     ImPlot3D::DestroyContext();
+    g_AppState.plotWorkers.Stop();
+}
+
+// 按 parallelPlotting 启动或停止图元生成线程
+void ApplyParallelPlotting() {
+    if (g_AppState.parallelPlotting) {
+        if (g_AppState.plotWorkers.GetThreadCount() == 1) {
+            g_AppState.plotWorkers.Start();
+        }
+        ImPlot::SetParallelFor(&WorkerPool::ParallelForCallback, &g_AppState.plotWorkers, g_AppState.plotWorkers.GetThreadCount());
+    } else {
+        ImPlot::SetParallelFor(nullptr, nullptr, 0);
+        g_AppState.plotWorkers.Stop();
+    }
 }
 
 // Direct3D 相关函数
@@ -223,12 +345,15 @@ void ShowNavigationBar() {
 
 // 文件菜单实现
 void ShowFileMenu() {
-    if (ImGui::MenuItem(u8"新建", "Ctrl+N")) {
+    // 打开或保存尚未完成时不能再发起新的文件操作
+    const bool fileIdle = g_AppState.fileJob == 0;
+    if (ImGui::MenuItem(u8"新建", "Ctrl+N", false, fileIdle)) {
         g_AppState.currentFilePath.clear();
         g_AppState.fileContent.clear();
+        g_AppState.fileLineEnding = LineEnding::LF;
     }
 
-    if (ImGui::MenuItem(u8"打开", "Ctrl+O")) {
+    if (ImGui::MenuItem(u8"打开", "Ctrl+O", false, fileIdle)) {
         OPENFILENAMEW ofn;
         wchar_t szFile[260] = { 0 };
         ZeroMemory(&ofn, sizeof(ofn));
@@ -247,14 +372,13 @@ void ShowFileMenu() {
             if (!path.empty() && path.back() == 0) {
                 path.pop_back();
             }
-            g_AppState.currentFilePath = path;
-            LoadFile(g_AppState.currentFilePath, g_AppState.fileContent);
+            OpenFileAsync(path);
         }
     }
 
-    if (ImGui::MenuItem(u8"保存", "Ctrl+S")) {
+    if (ImGui::MenuItem(u8"保存", "Ctrl+S", false, fileIdle)) {
         if (!g_AppState.currentFilePath.empty()) {
-            SaveFile(g_AppState.currentFilePath, g_AppState.fileContent);
+            SaveFileAsync(g_AppState.currentFilePath);
         } else {
             OPENFILENAMEW ofn;
             wchar_t szFile[260] = { 0 };
@@ -275,8 +399,7 @@ void ShowFileMenu() {
                 if (!path.empty() && path.back() == 0) {
                     path.pop_back();
                 }
-                g_AppState.currentFilePath = path;
-                SaveFile(g_AppState.currentFilePath, g_AppState.fileContent);
+                SaveFileAsync(path);
             }
         }
     }
@@ -295,6 +418,12 @@ void ShowSettingsMenu() {
     if (ImGui::MenuItem(u8"颜色主题")) {
         g_AppState.showThemeWindow = true;
     }
+    ImGui::Separator();
+    ImGui::MenuItem(u8"性能分析", nullptr, &g_AppState.showProfilerWindow);
+    ImGui::MenuItem(u8"绘制统计", nullptr, &g_AppState.showDrawStatsWindow);
+    if (ImGui::MenuItem(u8"多线程生成图元", nullptr, &g_AppState.parallelPlotting)) {
+        ApplyParallelPlotting();
+    }
 }
 
 // 帮助菜单实现
@@ -352,6 +481,8 @@ void ShowPreferencesWindow(bool* p_open) {
             ImGui::Checkbox(u8"显示工具栏", &show_toolbar);
             static bool confirm_exit = true;
             ImGui::Checkbox(u8"退出前确认", &confirm_exit);
+            ImGui::Checkbox(u8"空闲时暂停刷新", &g_AppState.powerSaving);
+            if (ImGui::IsItemHovered()) ImGui::SetTooltip(u8"没有输入和新数据时不再重绘界面，降低 CPU/GPU 占用");
             ImGui::EndTabItem();
         }
         
@@ -426,6 +557,7 @@ void ShowHelpWindow(bool* p_open) {
         ImGui::Separator();
         ImGui::Text(u8"图表功能说明:");
         ImGui::BulletText(u8"2D图表支持折线图和散点图");
+        ImGui::BulletText(u8"'收敛历史'页实时绘制日志中解析出的残差和气动系数");
         ImGui::BulletText(u8"3D图表支持多种网格模型展示");
     }
     ImGui::End();
@@ -446,6 +578,7 @@ void ShowUpdateCheckWindow(bool* p_open) {
                 progress = 0.0f;
             }
         } else {
+            g_AppState.animationRequested = true;
             progress += ImGui::GetIO().DeltaTime * 0.5f;
             if (progress > 1.0f) {
                 progress = 1.0f;
@@ -490,58 +623,69 @@ void ShowUpdateCheckWindow(bool* p_open) {
 
 // ===== 日志功能实现 =====
 
-bool LoadLogFileIncremental(const std::string& filePath, std::string& content, std::streampos& lastPos) {
-    if (filePath.empty()) return false;
-
-    struct stat fileInfo;
-    if (stat(filePath.c_str(), &fileInfo) != 0) return false;
-
-    std::time_t currentModTime = fileInfo.st_mtime;
-    bool fileModified = (currentModTime != g_AppState.logFileLastModified);
-    g_AppState.logFileLastModified = currentModTime;
-
-    std::ifstream file(filePath, std::ios::in | std::ios::binary);
-    if (!file.is_open()) return false;
-
-    file.seekg(0, std::ios::end);
-    std::streampos fileSize = file.tellg();
-    file.seekg(0, std::ios::beg);
-
-    if (fileSize == 0) {
-        content.clear();
-        lastPos = 0;
-        file.close();
-        return true;
-    }
-
-    bool fileReset = false;
-    if (fileSize < lastPos || fileModified || lastPos == 0) {
-        lastPos = 0;
-        content.clear();
-        fileReset = true;
-    }
-
-    if (lastPos == fileSize && !fileReset) {
-        file.close();
-        return true;
-    }
-
-    file.seekg(lastPos);
-    std::vector<char> buffer(4096);
-    std::string newContent;
-
-    while (!file.eof()) {
-        file.read(&buffer[0], buffer.size());
-        std::streamsize bytesRead = file.gcount();
-        if (bytesRead > 0) {
-            newContent.append(&buffer[0], bytesRead);
-        }
-    }
+void RefreshLogFileAsync() {
+    if (g_AppState.logRefreshJob != 0 || !g_AppState.logSource.IsOpen()) return;
+
+    // 工作线程在收敛历史解析器的副本上继续解析，完成后连同新的行索引一起交回；
+    // 期间界面切换了日志、清空了显示或开启了自动刷新时丢弃结果
+    struct Result {
+        uint64_t jobId = 0;
+        LogLineBatch batch;
+        Su2HistoryParser historyParser;
+    };
+    auto result = std::make_shared<Result>();
+    result->historyParser = g_AppState.historyParser;
+    const std::string filePath = g_AppState.logFilePath;
+    const uint64_t indexedSize = g_AppState.logSource.GetIndexedSize();
+
+    g_AppState.logRefreshJob = g_AppState.jobs.Submit(u8"读取日志 " + GetFileName(filePath),
+        [filePath, indexedSize, result](JobContext& context) {
+            LogLineBatch& batch = result->batch;
+            batch.fileAvailable = LogSource::QueryFileInfo(filePath, batch.fileSize, batch.lastModified);
+            batch.begin = batch.end = indexedSize;
+            if (!batch.fileAvailable) return;
+
+            // 日志只会追加写入；文件变短说明被截断或重新生成，需要从头建立索引
+            if (batch.fileSize < indexedSize) {
+                batch.begin = batch.end = 0;
+                batch.reset = true;
+                result->historyParser.Reset();
+                batch.history.MarkReset();
+            }
 
-    lastPos = fileSize;
-    content += newContent;
-    file.close();
-    return true;
+            // 分段建立索引，段与段之间汇报进度并检查是否已取消
+            constexpr uint64_t kStepBytes = 16ull * 1024 * 1024;
+            while (batch.end < batch.fileSize && !context.IsCancelled()) {
+                const uint64_t stepEnd = std::min(batch.end + kStepBytes, batch.fileSize);
+                const uint64_t indexedEnd = LogSource::IndexRange(filePath, batch.end, stepEnd, batch.lineOffsets,
+                    [&result, &batch](uint64_t offset, const char* data, size_t size) {
+                        result->historyParser.FeedChunk(offset, data, size, batch.history);
+                    });
+                batch.end = indexedEnd;
+                context.SetProgress(batch.end - batch.begin, batch.fileSize - batch.begin);
+                if (indexedEnd != stepEnd) break;
+            }
+        },
+        [filePath, result](bool completed) {
+            if (g_AppState.logRefreshJob == result->jobId) {
+                g_AppState.logRefreshJob = 0;
+            }
+            if (!completed || filePath != g_AppState.logFilePath || g_AppState.logTailer.IsRunning()) return;
+
+            LogLineBatch& batch = result->batch;
+            const bool reset = batch.reset;
+            const bool applied = g_AppState.logSource.ApplyBatch(batch);
+            if (applied || reset) {
+                g_AppState.historyParser = std::move(result->historyParser);
+                g_AppState.convergenceHistory.Apply(batch.history);
+                g_AppState.logContentCleared = false;
+            }
+            if (reset) {
+                RestartLogSearch();
+            }
+            g_AppState.logFileLastModified = g_AppState.logSource.GetLastModified();
+        });
+    result->jobId = g_AppState.logRefreshJob;
 }
 
 void OpenLogFile() {
@@ -567,73 +711,89 @@ void OpenLogFile() {
         }
 
         g_AppState.logFilePath = newFilePath;
-        g_AppState.logContent.clear();
-        g_AppState.lastReadPosition = 0;
         g_AppState.logFileLastModified = 0;
         g_AppState.logContentCleared = false;
         
-        g_AppState.logFileLastModified = GetFileLastModifiedTime(g_AppState.logFilePath);
-        LoadLogFileIncremental(g_AppState.logFilePath, g_AppState.logContent, g_AppState.lastReadPosition);
+        g_AppState.logTailer.Stop();
+        // 上一个日志还没读完时作废其结果
+        if (g_AppState.logRefreshJob != 0) {
+            g_AppState.jobs.Cancel(g_AppState.logRefreshJob);
+            g_AppState.logRefreshJob = 0;
+        }
+        g_AppState.historyParser.Reset();
+        g_AppState.convergenceHistory.Clear();
+        g_AppState.logSource.Open(g_AppState.logFilePath);
+        if (g_AppState.autoRefreshLog) {
+            StartLogTailer();
+        } else {
+            RefreshLogFileAsync();
+        }
     }
 }
 
 void ClearLogContent() {
-    g_AppState.logContent.clear();
+    g_AppState.logSource.Reset();
     g_AppState.logContentCleared = true;
-    g_AppState.lastReadPosition = 0;
+    if (g_AppState.logTailer.IsRunning()) {
+        g_AppState.logTailer.RequestRescan();
+    }
+    RestartLogSearch();
 }
 
-void RenderLogContent(const std::string& content, bool showLineNumbers, bool wrapText, float wrapWidth) {
-    if (content.empty()) {
-        ImGui::TextColored(ImVec4(0.5f, 0.5f, 0.5f, 1.0f), u8"暂无日志内容");
-        return;
-    }
+void StartLogTailer() {
+    // 从当前已索引的位置继续跟踪，已显示的内容不必重新扫描
+    g_AppState.logTailer.Start(g_AppState.logFilePath, g_AppState.logSource.GetIndexedSize(), g_AppState.refreshInterval,
+        &g_AppState.historyParser);
+}
 
-    float effectiveWrapWidth = wrapWidth;
-    if (effectiveWrapWidth <= 0.0f) {
-        effectiveWrapWidth = ImGui::GetContentRegionAvail().x;
-        if (showLineNumbers) effectiveWrapWidth -= 50.0f;
+void PollLogTailer() {
+    LogLineBatch batch;
+    bool reset = false;
+    while (g_AppState.logTailer.Poll(batch)) {
+        reset |= batch.reset;
+        if (g_AppState.logSource.ApplyBatch(batch)) {
+            g_AppState.logContentCleared = false;
+        }
+        g_AppState.convergenceHistory.Apply(batch.history);
+    }
+    if (reset) {
+        RestartLogSearch();
     }
+    UpdateLogSearch();
+}
 
-    std::istringstream stream(content);
-    std::string line;
-    int lineNumber = 1;
+void RestartLogSearch() {
+    LogSearchOptions options;
+    options.pattern = g_AppState.logSearchText;
+    options.regex = g_AppState.logSearchRegex;
+    options.caseSensitive = g_AppState.logSearchCaseSensitive;
+    g_AppState.logSearcher.Start(g_AppState.logFilePath, options, g_AppState.logSource.GetIndexedSize());
+    g_AppState.logSearchCursor = -1;
+}
 
-    if (showLineNumbers) {
-        ImGui::BeginTable("LogContentTable", 2, ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_SizingFixedFit);
-        ImGui::TableSetupColumn("LineNumbers", ImGuiTableColumnFlags_WidthFixed, 50.0f);
-        ImGui::TableSetupColumn("Content", ImGuiTableColumnFlags_WidthStretch);
-    }
+void UpdateLogSearch() {
+    LogSearcher& searcher = g_AppState.logSearcher;
+    searcher.Poll();
+    if (!searcher.IsActive()) return;
 
-    while (std::getline(stream, line)) {
-        if (showLineNumbers) {
-            ImGui::TableNextRow();
-            ImGui::TableSetColumnIndex(0);
-            ImGui::TextColored(ImVec4(0.5f, 0.5f, 0.5f, 1.0f), "%d", lineNumber);
-            ImGui::TableSetColumnIndex(1);
-
-            if (wrapText) {
-                ImGui::PushTextWrapPos(ImGui::GetCursorPos().x + effectiveWrapWidth);
-                ImGui::TextUnformatted(line.c_str());
-                ImGui::PopTextWrapPos();
-            } else {
-                ImGui::TextUnformatted(line.c_str());
-            }
-        } else {
-            if (wrapText) {
-                ImGui::PushTextWrapPos(ImGui::GetCursorPos().x + effectiveWrapWidth);
-                ImGui::TextUnformatted(line.c_str());
-                ImGui::PopTextWrapPos();
-            } else {
-                ImGui::TextUnformatted(line.c_str());
-            }
-        }
-        lineNumber++;
+    // 换了日志文件或文件被截断后从头搜索，否则只搜索新追加的内容
+    const uint64_t indexedSize = g_AppState.logSource.GetIndexedSize();
+    if (searcher.GetPath() != g_AppState.logFilePath || indexedSize < searcher.GetTargetEnd()) {
+        RestartLogSearch();
+    } else {
+        searcher.Extend(indexedSize);
     }
+}
 
-    if (showLineNumbers) {
-        ImGui::EndTable();
+void JumpToLogMatch(bool forward) {
+    int fromLine = g_AppState.logSearchCursor;
+    if (fromLine < 0 && !forward) {
+        fromLine = g_AppState.logSource.GetLineCount();
     }
+    const int line = g_AppState.logSearcher.FindNextMatch(fromLine, forward);
+    if (line < 0) return;
+    g_AppState.logSearchCursor = line;
+    g_AppState.logSearchScrollPending = true;
 }
 
 void ShowLogWindow(bool* p_open) {
@@ -654,39 +814,28 @@ void ShowLogWindow(bool* p_open) {
     if (prevAutoRefresh != g_AppState.autoRefreshLog) {
         g_AppState.logContentCleared = false;
         if (g_AppState.autoRefreshLog && !g_AppState.logFilePath.empty()) {
-            LoadLogFileIncremental(g_AppState.logFilePath, g_AppState.logContent, g_AppState.lastReadPosition);
-            g_AppState.lastRefreshTime = ImGui::GetTime();
+            StartLogTailer();
+        } else {
+            g_AppState.logTailer.Stop();
         }
     }
 
     if (g_AppState.autoRefreshLog) {
         ImGui::SameLine();
         ImGui::PushItemWidth(100.0f);
-        ImGui::SliderFloat(u8"刷新间隔(秒)", &g_AppState.refreshInterval, 0.1f, 5.0f);
-        ImGui::PopItemWidth();
-
-        float currentTime = ImGui::GetTime();
-        if (currentTime - g_AppState.lastRefreshTime >= g_AppState.refreshInterval) {
-            if (!g_AppState.logFilePath.empty()) {
-                if (g_AppState.logContentCleared) {
-                    g_AppState.logContent.clear();
-                    g_AppState.lastReadPosition = 0;
-                    g_AppState.logContentCleared = false;
-                }
-                LoadLogFileIncremental(g_AppState.logFilePath, g_AppState.logContent, g_AppState.lastReadPosition);
-            }
-            g_AppState.lastRefreshTime = currentTime;
+        if (ImGui::SliderFloat(u8"刷新间隔(秒)", &g_AppState.refreshInterval, 0.1f, 5.0f)) {
+            g_AppState.logTailer.SetInterval(g_AppState.refreshInterval);
         }
+        ImGui::PopItemWidth();
     } else {
         ImGui::SameLine();
-        if (ImGui::Button(u8"刷新")) {
+        ImGui::BeginDisabled(g_AppState.logRefreshJob != 0);
+        const bool refreshClicked = ImGui::Button(u8"刷新");
+        ImGui::EndDisabled();
+        if (refreshClicked) {
             if (!g_AppState.logFilePath.empty()) {
-                if (g_AppState.logContentCleared) {
-                    g_AppState.logContent.clear();
-                    g_AppState.lastReadPosition = 0;
-                    g_AppState.logContentCleared = false;
-                }
-                LoadLogFileIncremental(g_AppState.logFilePath, g_AppState.logContent, g_AppState.lastReadPosition);
+                g_AppState.logContentCleared = false;
+                RefreshLogFileAsync();
             }
         }
     }
@@ -704,29 +853,81 @@ void ShowLogWindow(bool* p_open) {
         ImGui::PopItemWidth();
     }
 
+    // 搜索栏：输入即在后台重新搜索，回车或 F3 跳到下一个匹配，Shift+F3 跳到上一个
+    const bool logWindowFocused = ImGui::IsWindowFocused(ImGuiFocusedFlags_RootAndChildWindows);
+    if (logWindowFocused && ImGui::IsKeyChordPressed(ImGuiMod_Ctrl | ImGuiKey_F)) {
+        ImGui::SetKeyboardFocusHere();
+    }
+    ImGui::PushItemWidth(260.0f);
+    bool searchSubmitted = ImGui::InputTextWithHint("##LogSearch", u8"搜索日志 (Ctrl+F)", g_AppState.logSearchText,
+        IM_ARRAYSIZE(g_AppState.logSearchText), ImGuiInputTextFlags_EnterReturnsTrue);
+    bool searchChanged = ImGui::IsItemEdited();
+    if (searchSubmitted) {
+        ImGui::SetKeyboardFocusHere(-1);
+    }
+    ImGui::PopItemWidth();
+    ImGui::SameLine();
+    searchChanged |= ImGui::Checkbox(u8"正则", &g_AppState.logSearchRegex);
+    ImGui::SameLine();
+    searchChanged |= ImGui::Checkbox(u8"区分大小写", &g_AppState.logSearchCaseSensitive);
+    if (searchChanged) {
+        RestartLogSearch();
+    }
+    ImGui::SameLine();
+    ImGui::Checkbox(u8"仅显示匹配行", &g_AppState.logShowOnlyMatches);
+    ImGui::SameLine();
+    if (ImGui::ArrowButton("##PrevMatch", ImGuiDir_Up)) {
+        JumpToLogMatch(false);
+    }
+    ImGui::SameLine();
+    if (ImGui::ArrowButton("##NextMatch", ImGuiDir_Down) || searchSubmitted) {
+        JumpToLogMatch(true);
+    }
+    if (logWindowFocused && ImGui::IsKeyPressed(ImGuiKey_F3)) {
+        JumpToLogMatch(!ImGui::GetIO().KeyShift);
+    }
+
+    const LogSearcher& searcher = g_AppState.logSearcher;
+    ImGui::SameLine();
+    if (!searcher.GetError().empty()) {
+        ImGui::TextColored(ImVec4(1.0f, 0.0f, 0.0f, 1.0f), u8"正则表达式无效: %s", searcher.GetError().c_str());
+    } else if (searcher.IsActive()) {
+        if (searcher.IsSearching()) {
+            const double progress = searcher.GetTargetEnd() > 0 ?
+                100.0 * searcher.GetScannedEnd() / searcher.GetTargetEnd() : 0.0;
+            ImGui::Text(u8"匹配 %d 行，已搜索 %.0f%%", searcher.GetMatchCount(), progress);
+        } else {
+            ImGui::Text(u8"匹配 %d 行", searcher.GetMatchCount());
+        }
+    }
+
     ImGui::Separator();
 
     if (!g_AppState.logFilePath.empty()) {
-        struct stat fileInfo;
-        bool fileExists = (stat(g_AppState.logFilePath.c_str(), &fileInfo) == 0);
-
-        if (fileExists) {
+        // 文件状态由后台跟踪线程（或手动刷新）更新，界面线程不再每帧调用 stat()
+        const LogSource& source = g_AppState.logSource;
+        if (source.IsFileAvailable()) {
+            const long long fileSize = static_cast<long long>(source.GetFileSize());
+            std::time_t lastModified = source.GetLastModified();
             std::string sizeStr;
-            if (fileInfo.st_size < 1024) {
-                sizeStr = std::to_string(fileInfo.st_size) + " B";
-            } else if (fileInfo.st_size < 1024 * 1024) {
-                sizeStr = std::to_string(fileInfo.st_size / 1024) + " KB";
+            if (fileSize < 1024) {
+                sizeStr = std::to_string(fileSize) + " B";
+            } else if (fileSize < 1024 * 1024) {
+                sizeStr = std::to_string(fileSize / 1024) + " KB";
             } else {
-                sizeStr = std::to_string(fileInfo.st_size / (1024 * 1024)) + " MB";
+                sizeStr = std::to_string(fileSize / (1024 * 1024)) + " MB";
             }
 
             char timeBuffer[64];
             std::strftime(timeBuffer, sizeof(timeBuffer), "%Y-%m-%d %H:%M:%S",
-                std::localtime(&fileInfo.st_mtime));
+                std::localtime(&lastModified));
 
             ImGui::TextWrapped(u8"当前日志文件: %s", g_AppState.logFilePath.c_str());
             ImGui::TextWrapped(u8"文件大小: %s | 最后修改: %s", sizeStr.c_str(), timeBuffer);
-            ImGui::TextWrapped(u8"已读取位置: %lld / %lld", (long long)g_AppState.lastReadPosition, (long long)fileInfo.st_size);
+            ImGui::TextWrapped(u8"已读取位置: %lld / %lld | 驻留窗口: %.1f MB (%s)",
+                (long long)source.GetIndexedSize(), fileSize,
+                source.GetResidentBytes() / (1024.0 * 1024.0),
+                source.IsMemoryMapped() ? u8"内存映射" : u8"读取");
 
             if (g_AppState.logContentCleared) {
                 ImGui::TextColored(ImVec4(1.0f, 0.5f, 0.0f, 1.0f), 
@@ -743,10 +944,14 @@ void ShowLogWindow(bool* p_open) {
     ImGui::Separator();
 
     ImGui::BeginChild("LogContent", ImVec2(0, 0), true, ImGuiWindowFlags_HorizontalScrollbar);
-    RenderLogContent(g_AppState.logContent, g_AppState.showLineNumbers,
-        g_AppState.wrapLogLines, g_AppState.logLineWidth);
-
-    if (!g_AppState.logContentCleared && ImGui::GetScrollY() >= ImGui::GetScrollMaxY() - 20.0f)
+    const bool scrollToCursor = g_AppState.logSearchScrollPending;
+    g_AppState.logSearchScrollPending = false;
+    RenderLogContent(g_AppState.logSource, g_AppState.logSearcher, g_AppState.showLineNumbers,
+        g_AppState.wrapLogLines, g_AppState.logLineWidth, g_AppState.logShowOnlyMatches,
+        g_AppState.logSearchCursor, scrollToCursor);
+
+    // 刚跳转到匹配行时不要被跟随到底部的滚动覆盖
+    if (!scrollToCursor && !g_AppState.logContentCleared && ImGui::GetScrollY() >= ImGui::GetScrollMaxY() - 20.0f)
         ImGui::SetScrollHereY(1.0f);
 
     ImGui::EndChild();
@@ -756,51 +961,64 @@ void ShowLogWindow(bool* p_open) {
 
 void ShowPlotWindow(bool* p_open) {
     if (ImGui::Begin(u8"图表窗口", p_open)) {
-        static float xs[100], ys1[100], ys2[100];
-        static bool init = true;
-        if (init) {
-            init = false;
-            for (int i = 0; i < 100; ++i) {
-                xs[i] = i * 0.01f;
-                ys1[i] = sinf(xs[i] * 10.0f);
-                ys2[i] = cosf(xs[i] * 10.0f);
-            }
-        }
-
-        static bool animate = true;
-        static float refresh_time = 0;
-        if (animate) {
-            refresh_time += ImGui::GetIO().DeltaTime;
-            for (int i = 0; i < 100; ++i) {
-                ys1[i] = sinf(xs[i] * 10.0f + refresh_time);
-                ys2[i] = cosf(xs[i] * 10.0f + refresh_time);
-            }
-        }
-        
-        ImGui::Checkbox(u8"动态更新", &animate);
-        ImGui::SameLine();
-        
-        static int plot_type = 0;
-        ImGui::RadioButton(u8"折线图", &plot_type, 0);
-        ImGui::SameLine();
-        ImGui::RadioButton(u8"散点图", &plot_type, 1);
-        
         // 根据窗口大小动态调整图表区域
         ImVec2 content_region = ImGui::GetContentRegionAvail();
         float plot_area_height = content_region.y - 120.0f; // 预留控件空间
         if (plot_area_height < 200.0f) plot_area_height = 200.0f;
-        
-        if (ImPlot::BeginPlot(u8"我的图表", ImVec2(-1, plot_area_height))) {
-            ImPlot::SetupAxes(u8"X轴", u8"Y轴");
-            
-            if (plot_type == 0) {
-                ImPlot::PlotLine(u8"正弦波", xs, ys1, 100);
-                ImPlot::PlotLine(u8"余弦波", xs, ys2, 100);
-            } else {
-                ImPlot::PlotScatter(u8"正弦波", xs, ys1, 100);
-                ImPlot::PlotScatter(u8"余弦波", xs, ys2, 100);
+
+        if (ImGui::BeginTabBar("PlotTabBar")) {
+            if (ImGui::BeginTabItem(u8"收敛历史")) {
+                ShowConvergencePlots(g_AppState.convergenceHistory, plot_area_height);
+                ImGui::EndTabItem();
             }
-            ImPlot::EndPlot();
+
+            if (ImGui::BeginTabItem(u8"示例曲线")) {
+                static float xs[100], ys1[100], ys2[100];
+                static bool init = true;
+                if (init) {
+                    init = false;
+                    for (int i = 0; i < 100; ++i) {
+                        xs[i] = i * 0.01f;
+                        ys1[i] = sinf(xs[i] * 10.0f);
+                        ys2[i] = cosf(xs[i] * 10.0f);
+                    }
+                }
+
+                static bool animate = true;
+                static float refresh_time = 0;
+                if (animate) {
+                    g_AppState.animationRequested = true;
+                    refresh_time += ImGui::GetIO().DeltaTime;
+                    for (int i = 0; i < 100; ++i) {
+                        ys1[i] = sinf(xs[i] * 10.0f + refresh_time);
+                        ys2[i] = cosf(xs[i] * 10.0f + refresh_time);
+                    }
+                }
+
+                ImGui::Checkbox(u8"动态更新", &animate);
+                ImGui::SameLine();
+
+                static int plot_type = 0;
+                ImGui::RadioButton(u8"折线图", &plot_type, 0);
+                ImGui::SameLine();
+                ImGui::RadioButton(u8"散点图", &plot_type, 1);
+
+                if (ImPlot::BeginPlot(u8"我的图表", ImVec2(-1, plot_area_height))) {
+                    ImPlot::SetupAxes(u8"X轴", u8"Y轴");
+
+                    if (plot_type == 0) {
+                        ImPlot::PlotLine(u8"正弦波", xs, ys1, 100);
+                        ImPlot::PlotLine(u8"余弦波", xs, ys2, 100);
+                    } else {
+                        ImPlot::PlotScatter(u8"正弦波", xs, ys1, 100);
+                        ImPlot::PlotScatter(u8"余弦波", xs, ys2, 100);
+                    }
+                    PROFILE_SCOPE("ImPlot::EndPlot");
+                    ImPlot::EndPlot();
+                }
+                ImGui::EndTabItem();
+            }
+            ImGui::EndTabBar();
         }
         
         ImGui::Separator();
@@ -829,10 +1047,221 @@ void ShowPlotWindow(bool* p_open) {
     ImGui::End();
 }
 
+// 弹出打开文件对话框，选中的路径以 UTF-8 返回
+static bool ShowOpenFileDialog(const wchar_t* filter, std::string& filePath) {
+    OPENFILENAMEW ofn;
+    wchar_t szFile[260] = { 0 };
+    ZeroMemory(&ofn, sizeof(ofn));
+    ofn.lStructSize = sizeof(ofn);
+    ofn.hwndOwner = GetActiveWindow();
+    ofn.lpstrFile = szFile;
+    ofn.nMaxFile = sizeof(szFile) / sizeof(wchar_t);
+    ofn.lpstrFilter = filter;
+    ofn.nFilterIndex = 1;
+    ofn.Flags = OFN_PATHMUSTEXIST | OFN_FILEMUSTEXIST | OFN_NOCHANGEDIR;
+
+    if (GetOpenFileNameW(&ofn) != TRUE) {
+        return false;
+    }
+    int size_needed = WideCharToMultiByte(CP_UTF8, 0, ofn.lpstrFile, -1, NULL, 0, NULL, NULL);
+    filePath.assign(size_needed, 0);
+    WideCharToMultiByte(CP_UTF8, 0, ofn.lpstrFile, -1, &filePath[0], size_needed, NULL, NULL);
+    if (!filePath.empty() && filePath.back() == 0) {
+        filePath.pop_back();
+    }
+    return !filePath.empty();
+}
+
+// 弹出保存文件对话框，defaultExt 为不带点的默认扩展名
+static bool ShowSaveFileDialog(const wchar_t* filter, const wchar_t* defaultExt, std::string& filePath) {
+    OPENFILENAMEW ofn;
+    wchar_t szFile[260] = { 0 };
+    ZeroMemory(&ofn, sizeof(ofn));
+    ofn.lStructSize = sizeof(ofn);
+    ofn.hwndOwner = GetActiveWindow();
+    ofn.lpstrFile = szFile;
+    ofn.nMaxFile = sizeof(szFile) / sizeof(wchar_t);
+    ofn.lpstrFilter = filter;
+    ofn.nFilterIndex = 1;
+    ofn.Flags = OFN_PATHMUSTEXIST | OFN_OVERWRITEPROMPT | OFN_NOCHANGEDIR;
+    ofn.lpstrDefExt = defaultExt;
+
+    if (GetSaveFileNameW(&ofn) != TRUE) {
+        return false;
+    }
+    int size_needed = WideCharToMultiByte(CP_UTF8, 0, ofn.lpstrFile, -1, NULL, 0, NULL, NULL);
+    filePath.assign(size_needed, 0);
+    WideCharToMultiByte(CP_UTF8, 0, ofn.lpstrFile, -1, &filePath[0], size_needed, NULL, NULL);
+    if (!filePath.empty() && filePath.back() == 0) {
+        filePath.pop_back();
+    }
+    return !filePath.empty();
+}
+
+void OpenMeshFile() {
+    std::string filePath;
+    if (g_AppState.meshJob != 0 || !ShowOpenFileDialog(L"SU2 网格*.su2\0*.su2\0所有文件\0*.*\0", filePath)) {
+        return;
+    }
+
+    struct Result {
+        Su2Mesh mesh;
+        Su2LoadStats stats;
+        std::string error;
+        bool ok = false;
+    };
+    auto result = std::make_shared<Result>();
+    g_AppState.meshError.clear();
+    g_AppState.meshJob = g_AppState.jobs.Submit(u8"读取网格 " + GetFileName(filePath),
+        [filePath, result](JobContext& context) {
+            result->ok = LoadSu2Mesh(filePath, result->mesh, result->stats, result->error, context.GetProgressCallback());
+        },
+        [filePath, result](bool completed) {
+            g_AppState.meshJob = 0;
+            if (!completed) return;
+            g_AppState.meshFilePath = filePath;
+            g_AppState.mesh = std::move(result->mesh);
+            g_AppState.meshStats = result->stats;
+            g_AppState.meshError = result->error;
+            g_AppState.surfaceSolution.Clear();
+            g_AppState.solutionFilePath.clear();
+            g_AppState.solutionField = -1;
+            g_AppState.meshScalars.clear();
+            g_AppState.meshVersion++;
+            if (result->ok) {
+                g_AppState.meshFitPending = true;
+            }
+        });
+}
+
+void OpenSurfaceSolutionFile() {
+    std::string filePath;
+    if (g_AppState.meshJob != 0 || !ShowOpenFileDialog(L"表面解*.csv\0*.csv\0所有文件\0*.*\0", filePath)) {
+        return;
+    }
+
+    struct Result {
+        Su2SurfaceSolution solution;
+        Su2LoadStats stats;
+        std::string error;
+        bool ok = false;
+    };
+    auto result = std::make_shared<Result>();
+    g_AppState.meshError.clear();
+    g_AppState.meshJob = g_AppState.jobs.Submit(u8"读取表面解 " + GetFileName(filePath),
+        [filePath, result](JobContext& context) {
+            result->ok = LoadSu2SurfaceSolution(filePath, result->solution, result->stats, result->error,
+                context.GetProgressCallback());
+        },
+        [filePath, result](bool completed) {
+            g_AppState.meshJob = 0;
+            if (!completed) return;
+            g_AppState.solutionFilePath = filePath;
+            g_AppState.surfaceSolution = std::move(result->solution);
+            g_AppState.solutionStats = result->stats;
+            g_AppState.meshError = result->error;
+            g_AppState.solutionField = -1;
+            g_AppState.meshScalars.clear();
+            g_AppState.meshVersion++;
+            if (result->ok) {
+                // 默认用压力系数着色
+                int field = g_AppState.surfaceSolution.FindField("Pressure_Coefficient");
+                if (field < 0) field = g_AppState.surfaceSolution.FindField("Cp");
+                SelectSurfaceField(field);
+            }
+        });
+}
+
+void SelectSurfaceField(int field) {
+    g_AppState.solutionField = field;
+    g_AppState.meshVersion++;
+    if (!MapSurfaceField(g_AppState.mesh, g_AppState.surfaceSolution, field, g_AppState.meshScalars)) {
+        g_AppState.solutionField = -1;
+        g_AppState.meshScalars.clear();
+    }
+}
+
+// 网格包围盒转成坐标轴范围：各轴取相同的跨度，避免二维网格 z 方向范围为零
+static void SetupMeshAxesLimits(const Su2Mesh& mesh) {
+    ImPlot3DPoint center = (mesh.boundsMin + mesh.boundsMax) * 0.5f;
+    ImPlot3DPoint extent = mesh.boundsMax - mesh.boundsMin;
+    float half = 0.5f * ImMax(extent.x, ImMax(extent.y, extent.z));
+    if (half <= 0.0f) half = 1.0f;
+    ImPlot3D::SetupAxesLimits(center.x - half, center.x + half, center.y - half, center.y + half, center.z - half, center.z + half, ImPlot3DCond_Always);
+}
+
 void DemoMeshPlots(bool* p_open) {
     if (ImGui::Begin(u8"3D图表窗口", p_open)) {
         static int mesh_id = 0;
-        ImGui::Combo("Mesh", &mesh_id, "Duck\0Sphere\0Cube\0\0");
+        static bool reset_limits = false;
+        static ImPlot3DColormap field_colormap = ImPlot3DColormap_Jet;
+        if (ImGui::Combo("Mesh", &mesh_id, u8"Duck\0Sphere\0Cube\0SU2 网格\0\0")) {
+            if (mesh_id == 3)
+                g_AppState.meshFitPending = !g_AppState.mesh.points.empty();
+            else
+                reset_limits = true;
+        }
+
+        if (mesh_id == 3) {
+            // 网格或表面解读取完成之前不能再打开新的文件
+            ImGui::BeginDisabled(g_AppState.meshJob != 0);
+            if (ImGui::Button(u8"打开网格...")) {
+                OpenMeshFile();
+            }
+            ImGui::EndDisabled();
+            ImGui::SameLine();
+            ImGui::BeginDisabled(g_AppState.mesh.points.empty() || g_AppState.meshJob != 0);
+            if (ImGui::Button(u8"打开表面解...")) {
+                OpenSurfaceSolutionFile();
+            }
+            ImGui::EndDisabled();
+
+            const Su2Mesh& mesh = g_AppState.mesh;
+            if (!g_AppState.meshError.empty()) {
+                ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.4f, 1.0f), "%s", g_AppState.meshError.c_str());
+            }
+            if (!mesh.points.empty()) {
+                const Su2LoadStats& stats = g_AppState.meshStats;
+                ImGui::Text(u8"%dD 网格: %zu 个点, %llu 个单元, %zu 个三角形, %zu 个边界",
+                    mesh.dimension, mesh.points.size(), (unsigned long long)mesh.elementCount,
+                    mesh.triangles.size() / 3, mesh.markers.size());
+                ImGui::Text(u8"读取 %.1f MB, %.3f 秒, %.1f MB/s",
+                    stats.bytes / (1024.0 * 1024.0), stats.seconds, stats.GetMegabytesPerSecond());
+            }
+            if (g_AppState.surfaceSolution.GetRowCount() > 0) {
+                const Su2LoadStats& stats = g_AppState.solutionStats;
+                ImGui::Text(u8"表面解: %d 行, %zu 个变量, %.1f MB/s",
+                    g_AppState.surfaceSolution.GetRowCount(), g_AppState.surfaceSolution.fieldNames.size(),
+                    stats.GetMegabytesPerSecond());
+            }
+
+            const Su2SurfaceSolution& solution = g_AppState.surfaceSolution;
+            if (!solution.fieldNames.empty()) {
+                const int field = g_AppState.solutionField;
+                ImGui::SetNextItemWidth(200.0f);
+                if (ImGui::BeginCombo(u8"着色变量", field >= 0 ? solution.fieldNames[field].c_str() : u8"单色")) {
+                    if (ImGui::Selectable(u8"单色", field < 0)) {
+                        SelectSurfaceField(-1);
+                    }
+                    for (int i = 0; i < (int)solution.fieldNames.size(); i++) {
+                        if (ImGui::Selectable(solution.fieldNames[i].c_str(), i == field)) {
+                            SelectSurfaceField(i);
+                        }
+                    }
+                    ImGui::EndCombo();
+                }
+                ImGui::SameLine();
+                ImGui::SetNextItemWidth(150.0f);
+                if (ImGui::BeginCombo(u8"色图", ImPlot3D::GetColormapName(field_colormap))) {
+                    for (int i = 0; i < ImPlot3D::GetColormapCount(); i++) {
+                        if (ImGui::Selectable(ImPlot3D::GetColormapName(i), i == field_colormap)) {
+                            field_colormap = i;
+                        }
+                    }
+                    ImGui::EndCombo();
+                }
+            }
+        }
 
         static bool set_fill_color = true;
         static ImVec4 fill_color = ImVec4(0.8f, 0.8f, 0.2f, 0.6f);
@@ -856,7 +1285,13 @@ void DemoMeshPlots(bool* p_open) {
         if (plot3d_area_height < 250.0f) plot3d_area_height = 250.0f;
 
         if (ImPlot3D::BeginPlot("Mesh Plots", ImVec2(-1, plot3d_area_height))) {
-            ImPlot3D::SetupAxesLimits(-1, 1, -1, 1, -1, 1);
+            if (mesh_id == 3 && g_AppState.meshFitPending) {
+                SetupMeshAxesLimits(g_AppState.mesh);
+                g_AppState.meshFitPending = false;
+            } else if (mesh_id != 3) {
+                ImPlot3D::SetupAxesLimits(-1, 1, -1, 1, -1, 1, reset_limits ? ImPlot3DCond_Always : ImPlot3DCond_Once);
+                reset_limits = false;
+            }
 
             if (set_fill_color)
                 ImPlot3D::SetNextFillStyle(fill_color);
@@ -866,13 +1301,35 @@ void DemoMeshPlots(bool* p_open) {
             if (set_line_color)
                 ImPlot3D::SetNextLineStyle(line_color);
 
+            // 网格数据只在读入文件或切换着色变量时改变，视角和样式不变时直接重放上一帧生成的三角形
+            ImPlot3D::SetNextItemDataVersion(mesh_id == 3 ? g_AppState.meshVersion : 0);
             if (mesh_id == 0)
                 ImPlot3D::PlotMesh("Duck", ImPlot3D::duck_vtx, ImPlot3D::duck_idx, ImPlot3D::DUCK_VTX_COUNT, ImPlot3D::DUCK_IDX_COUNT);
             else if (mesh_id == 1)
                 ImPlot3D::PlotMesh("Sphere", ImPlot3D::sphere_vtx, ImPlot3D::sphere_idx, ImPlot3D::SPHERE_VTX_COUNT, ImPlot3D::SPHERE_IDX_COUNT);
             else if (mesh_id == 2)
                 ImPlot3D::PlotMesh("Cube", ImPlot3D::cube_vtx, ImPlot3D::cube_idx, ImPlot3D::CUBE_VTX_COUNT, ImPlot3D::CUBE_IDX_COUNT);
+            else if (mesh_id == 3 && !g_AppState.mesh.triangles.empty()) {
+                const Su2Mesh& mesh = g_AppState.mesh;
+                if (g_AppState.meshScalars.size() == mesh.points.size()) {
+                    // 逐顶点着色：整个标量场作为一个图元绘制
+                    ImPlot3D::PushColormap(field_colormap);
+                    ImPlot3D::PlotMesh("SU2", mesh.points.data(), mesh.triangles.data(), g_AppState.meshScalars.data(),
+                        (int)mesh.points.size(), (int)mesh.triangles.size());
+                    ImPlot3D::PopColormap();
+                } else {
+                    ImPlot3D::PlotMesh("SU2", mesh.points.data(), mesh.triangles.data(), (int)mesh.points.size(), (int)mesh.triangles.size());
+                }
+            }
+
+            const Su2SurfaceSolution& solution = g_AppState.surfaceSolution;
+            if (mesh_id == 3 && solution.GetRowCount() > 0) {
+                const ImPlot3DPoint* points = solution.points.data();
+                ImPlot3D::SetNextItemDataVersion(g_AppState.meshVersion);
+                ImPlot3D::PlotScatter(u8"表面解", &points[0].x, &points[0].y, &points[0].z, solution.GetRowCount(), 0, 0, sizeof(ImPlot3DPoint));
+            }
 
+            PROFILE_SCOPE("ImPlot3D::EndPlot");
             ImPlot3D::EndPlot();
         }
         
@@ -886,4 +1343,341 @@ void DemoMeshPlots(bool* p_open) {
         ImGui::BulletText(u8"滚轮: 缩放视图");
     }
     ImGui::End();
-}
\ No newline at end of file
+}
+
+// 同名区段在时间线和火焰图中使用相同的颜色
+static ImU32 GetProfileSampleColor(const char* name) {
+    const ImGuiID hash = ImHashStr(name);
+    return ImColor::HSV(static_cast<float>(hash % 360) / 360.0f, 0.5f, 0.8f);
+}
+
+// 帧耗时分析窗口
+// 上方时间线每一列是一帧，按最外层区段堆叠；点击某一帧后，下方显示它的火焰图和各区段的统计
+void ShowProfilerWindow(bool* p_open) {
+    FrameProfiler& profiler = GetFrameProfiler();
+    static uint64_t selectedFrame = UINT64_MAX;   // 选中的帧序号，UINT64_MAX 表示跟随最近一帧
+    static float timelineScaleMs = 33.3f;
+    static std::string exportMessage;
+
+    ImGui::SetNextWindowSize(ImVec2(760, 560), ImGuiCond_FirstUseEver);
+    if (!ImGui::Begin(u8"性能分析", p_open)) {
+        ImGui::End();
+        return;
+    }
+
+    bool paused = profiler.IsPaused();
+    if (ImGui::Checkbox(u8"暂停记录", &paused)) {
+        profiler.SetPaused(paused);
+    }
+    ImGui::SameLine();
+    ImGui::SetNextItemWidth(160.0f);
+    ImGui::SliderFloat(u8"时间线高度", &timelineScaleMs, 5.0f, 200.0f, "%.0f ms", ImGuiSliderFlags_Logarithmic);
+    ImGui::SameLine();
+    if (ImGui::Button(u8"导出 CSV")) {
+        std::string path;
+        if (ShowSaveFileDialog(L"CSV 文件(*.csv)\0*.csv\0所有文件\0*.*\0", L"csv", path)) {
+            std::string error;
+            exportMessage = profiler.ExportCsv(path, error) ? u8"已导出: " + path : error;
+        }
+    }
+    if (!exportMessage.empty()) {
+        ImGui::SameLine();
+        ImGui::TextUnformatted(exportMessage.c_str());
+    }
+
+    const int frameCount = profiler.GetFrameCount();
+    if (frameCount == 0) {
+        ImGui::TextDisabled(u8"暂无数据");
+        ImGui::End();
+        return;
+    }
+
+    // 选中的帧已被覆盖时回到跟随最近一帧
+    int selectedAge = 0;
+    if (selectedFrame != UINT64_MAX) {
+        const uint64_t latest = profiler.GetFrame(0).index;
+        if (selectedFrame <= latest && latest - selectedFrame < static_cast<uint64_t>(frameCount)) {
+            selectedAge = static_cast<int>(latest - selectedFrame);
+        } else {
+            selectedFrame = UINT64_MAX;
+        }
+    }
+
+    ImDrawList* drawList = ImGui::GetWindowDrawList();
+    const float width = ImMax(ImGui::GetContentRegionAvail().x, 100.0f);
+
+    // 时间线：最新的帧在最右侧
+    ImGui::SeparatorText(u8"时间线（点击选择帧，右键跟随最近一帧）");
+    {
+        const float height = 100.0f;
+        const ImVec2 origin = ImGui::GetCursorScreenPos();
+        ImGui::InvisibleButton("##Timeline", ImVec2(width, height), ImGuiButtonFlags_MouseButtonLeft | ImGuiButtonFlags_MouseButtonRight);
+        const bool hovered = ImGui::IsItemHovered();
+        const float bottom = origin.y + height;
+        drawList->AddRectFilled(origin, ImVec2(origin.x + width, bottom), ImGui::GetColorU32(ImGuiCol_FrameBg));
+
+        const float barWidth = width / FrameProfiler::kFrameCapacity;
+        const float pixelsPerMs = height / timelineScaleMs;
+        const ImU32 frameColor = ImGui::GetColorU32(ImGuiCol_TextDisabled);
+        int hoveredAge = -1;
+        for (int age = 0; age < frameCount; age++) {
+            const ProfileFrame& frame = profiler.GetFrame(age);
+            const ProfileSample* samples = profiler.GetSamples(age);
+            const float x1 = origin.x + width - age * barWidth;
+            const float x0 = x1 - ImMax(barWidth - 1.0f, 1.0f);
+            const float frameMs = (frame.end - frame.begin) * 1e-6f;
+            drawList->AddRectFilled(ImVec2(x0, ImMax(bottom - frameMs * pixelsPerMs, origin.y)), ImVec2(x1, bottom), frameColor);
+            float y = bottom;
+            for (int i = 0; i < frame.sampleCount && y > origin.y; i++) {
+                if (samples[i].depth != 0) continue;
+                const float h = (samples[i].end - samples[i].begin) * 1e-6f * pixelsPerMs;
+                drawList->AddRectFilled(ImVec2(x0, ImMax(y - h, origin.y)), ImVec2(x1, y), GetProfileSampleColor(samples[i].name));
+                y -= h;
+            }
+            if (age == selectedAge) {
+                drawList->AddRect(ImVec2(x0 - 1.0f, origin.y), ImVec2(x1 + 1.0f, bottom), IM_COL32(255, 255, 255, 255));
+            }
+            if (hovered && ImGui::GetIO().MousePos.x >= x0 - 1.0f && ImGui::GetIO().MousePos.x < x1) {
+                hoveredAge = age;
+            }
+        }
+
+        // 60 Hz 参考线
+        const float budgetY = bottom - 1000.0f / 60.0f * pixelsPerMs;
+        if (budgetY > origin.y) {
+            drawList->AddLine(ImVec2(origin.x, budgetY), ImVec2(origin.x + width, budgetY), IM_COL32(255, 96, 96, 160));
+        }
+
+        if (hoveredAge >= 0) {
+            const ProfileFrame& frame = profiler.GetFrame(hoveredAge);
+            ImGui::SetTooltip(u8"帧 %llu: %.2f ms", static_cast<unsigned long long>(frame.index), (frame.end - frame.begin) * 1e-6);
+            if (ImGui::IsMouseClicked(ImGuiMouseButton_Left)) {
+                selectedFrame = frame.index;
+                selectedAge = hoveredAge;
+            }
+        }
+        if (hovered && ImGui::IsMouseClicked(ImGuiMouseButton_Right)) {
+            selectedFrame = UINT64_MAX;
+            selectedAge = 0;
+        }
+    }
+
+    // 火焰图：横轴为帧内时间，纵轴为嵌套层数
+    const ProfileFrame& frame = profiler.GetFrame(selectedAge);
+    const ProfileSample* samples = profiler.GetSamples(selectedAge);
+    char title[128];
+    snprintf(title, sizeof(title), u8"帧 %llu: %.2f ms%s", static_cast<unsigned long long>(frame.index),
+        (frame.end - frame.begin) * 1e-6, selectedFrame == UINT64_MAX ? u8"（最近一帧）" : "");
+    ImGui::SeparatorText(title);
+    if (frame.droppedCount > 0) {
+        ImGui::TextDisabled(u8"有 %d 个区段超出每帧容量未记录", frame.droppedCount);
+    }
+    {
+        int maxDepth = 0;
+        for (int i = 0; i < frame.sampleCount; i++) maxDepth = ImMax(maxDepth, samples[i].depth);
+        const float rowHeight = ImGui::GetTextLineHeight() + 4.0f;
+        const ImVec2 origin = ImGui::GetCursorScreenPos();
+        ImGui::InvisibleButton("##Flame", ImVec2(width, rowHeight * (maxDepth + 1)));
+        const bool hovered = ImGui::IsItemHovered();
+        const double pixelsPerNs = width / static_cast<double>(ImMax<int64_t>(frame.end - frame.begin, 1));
+        const ImVec2 mouse = ImGui::GetIO().MousePos;
+        int hoveredSample = -1;
+        for (int i = 0; i < frame.sampleCount; i++) {
+            const ProfileSample& sample = samples[i];
+            const float x0 = origin.x + static_cast<float>(sample.begin * pixelsPerNs);
+            const float x1 = ImMax(origin.x + static_cast<float>(sample.end * pixelsPerNs), x0 + 1.0f);
+            const float y0 = origin.y + sample.depth * rowHeight;
+            const float y1 = y0 + rowHeight - 1.0f;
+            drawList->AddRectFilled(ImVec2(x0, y0), ImVec2(x1, y1), GetProfileSampleColor(sample.name));
+            if (x1 - x0 > 20.0f) {
+                char label[128];
+                snprintf(label, sizeof(label), "%s %.2f ms", sample.name, (sample.end - sample.begin) * 1e-6);
+                drawList->PushClipRect(ImVec2(x0, y0), ImVec2(x1, y1), true);
+                drawList->AddText(ImVec2(x0 + 3.0f, y0 + 2.0f), IM_COL32(0, 0, 0, 255), label);
+                drawList->PopClipRect();
+            }
+            if (hovered && mouse.x >= x0 && mouse.x < x1 && mouse.y >= y0 && mouse.y < y1) {
+                hoveredSample = i;
+            }
+        }
+        if (hoveredSample >= 0) {
+            const ProfileSample& sample = samples[hoveredSample];
+            ImGui::SetTooltip(u8"%s\n开始: %.3f ms\n耗时: %.3f ms", sample.name, sample.begin * 1e-6, (sample.end - sample.begin) * 1e-6);
+        }
+    }
+
+    // 各区段统计：选中帧的耗时，以及缓冲中所有帧的平均和最大值
+    struct SampleStats {
+        const char* name;
+        double selectedMs;
+        double totalMs;
+        double maxMs;
+        int calls;
+    };
+    static std::vector<SampleStats> stats;
+    stats.clear();
+    for (int age = 0; age < frameCount; age++) {
+        const ProfileFrame& statsFrame = profiler.GetFrame(age);
+        const ProfileSample* statsSamples = profiler.GetSamples(age);
+        for (int i = 0; i < statsFrame.sampleCount; i++) {
+            const ProfileSample& sample = statsSamples[i];
+            const double ms = (sample.end - sample.begin) * 1e-6;
+            auto it = std::find_if(stats.begin(), stats.end(), [&](const SampleStats& s) { return strcmp(s.name, sample.name) == 0; });
+            if (it == stats.end()) {
+                stats.push_back({ sample.name, 0.0, 0.0, 0.0, 0 });
+                it = stats.end() - 1;
+            }
+            if (age == selectedAge) it->selectedMs += ms;
+            it->totalMs += ms;
+            it->maxMs = ImMax(it->maxMs, ms);
+            it->calls++;
+        }
+    }
+    std::sort(stats.begin(), stats.end(), [](const SampleStats& a, const SampleStats& b) { return a.totalMs > b.totalMs; });
+
+    ImGui::SeparatorText(u8"区段统计");
+    const ImGuiTableFlags tableFlags = ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders | ImGuiTableFlags_ScrollY | ImGuiTableFlags_Resizable;
+    if (ImGui::BeginTable("##ProfileStats", 5, tableFlags)) {
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn(u8"区段", ImGuiTableColumnFlags_WidthStretch);
+        ImGui::TableSetupColumn(u8"选中帧 (ms)", ImGuiTableColumnFlags_WidthFixed);
+        ImGui::TableSetupColumn(u8"平均 (ms)", ImGuiTableColumnFlags_WidthFixed);
+        ImGui::TableSetupColumn(u8"最大 (ms)", ImGuiTableColumnFlags_WidthFixed);
+        ImGui::TableSetupColumn(u8"每帧次数", ImGuiTableColumnFlags_WidthFixed);
+        ImGui::TableHeadersRow();
+        for (const SampleStats& entry : stats) {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::ColorButton("##Color", ImColor(GetProfileSampleColor(entry.name)), ImGuiColorEditFlags_NoTooltip, ImVec2(ImGui::GetTextLineHeight(), ImGui::GetTextLineHeight()));
+            ImGui::SameLine();
+            ImGui::TextUnformatted(entry.name);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", entry.selectedMs);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", entry.totalMs / frameCount);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", entry.maxMs);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.2f", static_cast<double>(entry.calls) / frameCount);
+        }
+        ImGui::EndTable();
+    }
+    ImGui::End();
+}
+
+// 绘制数据统计窗口：总量和后端缓冲的历史曲线，以及每个绘制列表和图表项的几何量
+void ShowDrawStatsWindow(bool* p_open) {
+    const DrawStats& stats = g_AppState.drawStats;
+    static int vertexBudget = 1000000;
+
+    ImGui::SetNextWindowSize(ImVec2(760, 640), ImGuiCond_FirstUseEver);
+    if (!ImGui::Begin(u8"绘制统计", p_open)) {
+        ImGui::End();
+        return;
+    }
+
+    const DrawBackendStats& backend = stats.GetBackend();
+    const bool overBudget = stats.GetVtxCount() > vertexBudget;
+    ImGui::TextColored(overBudget ? ImVec4(1.0f, 0.4f, 0.4f, 1.0f) : ImGui::GetStyleColorVec4(ImGuiCol_Text),
+        u8"本帧: %d 个绘制列表, %d 顶点, %d 索引, %d 绘制命令",
+        static_cast<int>(stats.GetDrawLists().size()), stats.GetVtxCount(), stats.GetIdxCount(), stats.GetCmdCount());
+    ImGui::Text(u8"后端缓冲: 顶点 %d (重分配 %d 次), 索引 %d (重分配 %d 次)",
+        backend.vertexCapacity, backend.vertexReallocs, backend.indexCapacity, backend.indexReallocs);
+    ImGui::Text(u8"本帧上传 %d 顶点, 沿用 %d 顶点 (%d 个绘制列表保留在 GPU)",
+        backend.uploadedVertices, backend.reusedVertices, backend.retainedLists);
+    ImGui::SetNextItemWidth(160.0f);
+    ImGui::InputInt(u8"顶点预算", &vertexBudget, 10000, 100000);
+    vertexBudget = ImMax(vertexBudget, 1);
+
+    // 历史曲线，横轴为距今的帧数
+    const int historyLength = DrawStats::kHistoryLength;
+    const int offset = stats.GetHistoryOffset();
+    const double xStart = -(historyLength - 1);
+    if (ImPlot::BeginPlot(u8"几何量", ImVec2(-1, 180))) {
+        ImPlot::SetupAxes(u8"帧", nullptr, ImPlotAxisFlags_AutoFit, ImPlotAxisFlags_AutoFit);
+        ImPlot::PlotLine(u8"顶点", stats.GetVtxHistory().data(), historyLength, 1.0, xStart, 0, offset);
+        ImPlot::PlotLine(u8"索引", stats.GetIdxHistory().data(), historyLength, 1.0, xStart, 0, offset);
+        const double budget = static_cast<double>(vertexBudget);
+        ImPlot::SetNextLineStyle(ImVec4(1.0f, 0.4f, 0.4f, 1.0f));
+        ImPlot::PlotInfLines(u8"顶点预算", &budget, 1, ImPlotInfLinesFlags_Horizontal | ImPlotItemFlags_NoFit);
+        PROFILE_SCOPE("ImPlot::EndPlot");
+        ImPlot::EndPlot();
+    }
+    if (ImPlot::BeginPlot(u8"绘制命令与缓冲重分配", ImVec2(-1, 150))) {
+        ImPlot::SetupAxes(u8"帧", u8"绘制命令", ImPlotAxisFlags_AutoFit, ImPlotAxisFlags_AutoFit);
+        ImPlot::SetupAxis(ImAxis_Y2, u8"重分配", ImPlotAxisFlags_AuxDefault | ImPlotAxisFlags_AutoFit);
+        ImPlot::PlotLine(u8"绘制命令", stats.GetCmdHistory().data(), historyLength, 1.0, xStart, 0, offset);
+        ImPlot::SetAxes(ImAxis_X1, ImAxis_Y2);
+        ImPlot::PlotBars(u8"重分配", stats.GetReallocHistory().data(), historyLength, 0.8, xStart, 0, offset);
+        PROFILE_SCOPE("ImPlot::EndPlot");
+        ImPlot::EndPlot();
+    }
+
+    const ImGuiTableFlags tableFlags = ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders | ImGuiTableFlags_ScrollY | ImGuiTableFlags_Resizable;
+    const float tableHeight = ImMax((ImGui::GetContentRegionAvail().y - ImGui::GetFrameHeightWithSpacing() * 2.0f) * 0.5f, 120.0f);
+    ImGui::SeparatorText(u8"绘制列表");
+    if (ImGui::BeginTable("##DrawLists", 6, tableFlags, ImVec2(0, tableHeight))) {
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn(u8"名称", ImGuiTableColumnFlags_WidthStretch);
+        ImGui::TableSetupColumn(u8"顶点", ImGuiTableColumnFlags_WidthFixed);
+        ImGui::TableSetupColumn(u8"索引", ImGuiTableColumnFlags_WidthFixed);
+        ImGui::TableSetupColumn(u8"命令", ImGuiTableColumnFlags_WidthFixed);
+        ImGui::TableSetupColumn(u8"峰值顶点", ImGuiTableColumnFlags_WidthFixed);
+        ImGui::TableSetupColumn(u8"顶点历史", ImGuiTableColumnFlags_WidthFixed, 160.0f);
+        ImGui::TableHeadersRow();
+        for (const DrawListStats& list : stats.GetDrawLists()) {
+            ImGui::PushID(list.name.c_str());
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(list.name.empty() ? u8"（未命名）" : list.name.c_str());
+            ImGui::TableNextColumn();
+            ImGui::Text("%d", list.vtxCount);
+            ImGui::TableNextColumn();
+            ImGui::Text("%d", list.idxCount);
+            ImGui::TableNextColumn();
+            ImGui::Text("%d", list.cmdCount);
+            ImGui::TableNextColumn();
+            ImGui::Text("%d", list.peakVtxCount);
+            ImGui::TableNextColumn();
+            ImGui::PlotLines("##History", list.vtxHistory.data(), historyLength, offset, nullptr, 0.0f, FLT_MAX,
+                ImVec2(-FLT_MIN, ImGui::GetTextLineHeight()));
+            ImGui::PopID();
+        }
+        ImGui::EndTable();
+    }
+
+    ImGui::SeparatorText(u8"图表项（上一帧）");
+    if (ImGui::BeginTable("##PlotItems", 6, tableFlags)) {
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn(u8"图表", ImGuiTableColumnFlags_WidthStretch);
+        ImGui::TableSetupColumn(u8"图表项", ImGuiTableColumnFlags_WidthStretch);
+        ImGui::TableSetupColumn(u8"类型", ImGuiTableColumnFlags_WidthFixed);
+        ImGui::TableSetupColumn(u8"顶点", ImGuiTableColumnFlags_WidthFixed);
+        ImGui::TableSetupColumn(u8"索引", ImGuiTableColumnFlags_WidthFixed);
+        ImGui::TableSetupColumn(u8"命令", ImGuiTableColumnFlags_WidthFixed);
+        ImGui::TableHeadersRow();
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(stats.GetItems().size()));
+        while (clipper.Step()) {
+            for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++) {
+                const DrawItemStats& item = stats.GetItems()[row];
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(item.plot.empty() ? u8"（无标题）" : item.plot.c_str());
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(item.label.c_str());
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(item.is3D ? "3D" : "2D");
+                ImGui::TableNextColumn();
+                ImGui::Text("%d", item.vtxCount);
+                ImGui::TableNextColumn();
+                ImGui::Text("%d", item.idxCount);
+                ImGui::TableNextColumn();
+                if (item.is3D) ImGui::TextDisabled("-");
+                else ImGui::Text("%d", item.cmdCount);
+            }
+        }
+        ImGui::EndTable();
+    }
+    ImGui::End();
+}
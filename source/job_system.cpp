@@ -0,0 +1,157 @@
+/********************************************************************
+MIT License
+
+Copyright (c) 2025 loong22
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*********************************************************************/
+
+#include "../include/job_system.h"
+#include <algorithm>
+
+namespace {
+
+// 任务以磁盘 I/O 为主，两个线程足以让读取和写入互不等待
+constexpr int kWorkerThreadCount = 2;
+
+} // namespace
+
+JobSystem::~JobSystem() {
+    Stop();
+}
+
+uint64_t JobSystem::Submit(const std::string& name, JobWork work, JobFinish finish) {
+    auto job = std::make_shared<Job>();
+    job->name = name;
+    job->work = std::move(work);
+    job->finish = std::move(finish);
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    job->id = m_NextId++;
+    m_Queue.push_back(job);
+    m_Jobs.push_back(job);
+    if (m_Threads.empty()) {
+        m_StopRequested = false;
+        for (int i = 0; i < kWorkerThreadCount; i++) {
+            m_Threads.emplace_back(&JobSystem::ThreadMain, this);
+        }
+    }
+    m_Condition.notify_one();
+    return job->id;
+}
+
+void JobSystem::Cancel(uint64_t jobId) {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    for (const std::shared_ptr<Job>& job : m_Jobs) {
+        if (job->id == jobId) {
+            job->context.m_Cancelled.store(true);
+            break;
+        }
+    }
+}
+
+void JobSystem::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (m_Threads.empty()) return;
+        m_StopRequested = true;
+        for (const std::shared_ptr<Job>& job : m_Jobs) {
+            job->context.m_Cancelled.store(true);
+        }
+    }
+    m_Condition.notify_all();
+    for (std::thread& thread : m_Threads) {
+        thread.join();
+    }
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Threads.clear();
+    m_Queue.clear();
+    m_Jobs.clear();
+    m_Finished.clear();
+}
+
+void JobSystem::Poll() {
+    std::vector<std::shared_ptr<Job>> finished;
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (m_Finished.empty()) return;
+        finished.swap(m_Finished);
+        m_Jobs.erase(std::remove_if(m_Jobs.begin(), m_Jobs.end(),
+            [&finished](const std::shared_ptr<Job>& job) {
+                return std::find(finished.begin(), finished.end(), job) != finished.end();
+            }), m_Jobs.end());
+    }
+
+    // finish 可能再提交新任务，因此在锁外按完成顺序执行
+    for (const std::shared_ptr<Job>& job : finished) {
+        if (job->finish) {
+            job->finish(job->completed && !job->context.IsCancelled());
+        }
+    }
+}
+
+bool JobSystem::HasJobs() const {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return !m_Jobs.empty();
+}
+
+void JobSystem::GetStatus(std::vector<JobStatus>& jobs) const {
+    jobs.clear();
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    for (const std::shared_ptr<Job>& job : m_Jobs) {
+        JobStatus status;
+        status.id = job->id;
+        status.name = job->name;
+        status.processed = job->context.m_Processed.load(std::memory_order_relaxed);
+        status.total = job->context.m_Total.load(std::memory_order_relaxed);
+        status.running = job->running;
+        status.cancelRequested = job->context.IsCancelled();
+        jobs.push_back(status);
+    }
+}
+
+void JobSystem::ThreadMain() {
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    while (true) {
+        m_Condition.wait(lock, [this] { return m_StopRequested || !m_Queue.empty(); });
+        if (m_StopRequested) break;
+
+        std::shared_ptr<Job> job = m_Queue.front();
+        m_Queue.pop_front();
+        job->running = true;
+        lock.unlock();
+
+        bool completed = false;
+        if (!job->context.IsCancelled()) {
+            try {
+                job->work(job->context);
+                completed = true;
+            } catch (...) {
+                // 例如读取超大文件时内存不足，按未完成处理，由 finish 决定如何提示
+            }
+        }
+        // 工作线程不再持有任务捕获的数据，结果由 finish 在界面线程中取用
+        job->work = nullptr;
+
+        lock.lock();
+        job->completed = completed;
+        m_Finished.push_back(job);
+    }
+}
@@ -0,0 +1,573 @@
+/********************************************************************
+MIT License
+
+Copyright (c) 2025 loong22
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*********************************************************************/
+
+#include "../include/log_search.h"
+#include "../include/log_source.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <regex>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define LOG_SEARCH_SSE2
+#include <emmintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+namespace {
+
+// 每次映射并搜索的字节数，也是界面上搜索进度的更新粒度
+constexpr uint64_t kSearchChunkBytes = 32ull * 1024 * 1024;
+// 小于该大小的内容不再切分给多个线程
+constexpr size_t kMinSliceBytes = 1024 * 1024;
+constexpr int kMaxSearchThreads = 8;
+// 结果队列已满时重新提交的间隔
+constexpr int kRetryIntervalMs = 10;
+// 块末尾尚未结束的行最多保存的字节数，超出后只保留可能与后续内容组成匹配的末尾部分
+constexpr size_t kMaxPartialLineBytes = 1024 * 1024;
+
+inline bool IsAsciiUpper(char c) { return c >= 'A' && c <= 'Z'; }
+inline bool IsAsciiLetter(char c) { return IsAsciiUpper(c) || (c >= 'a' && c <= 'z'); }
+inline char FoldAscii(char c) { return IsAsciiUpper(c) ? static_cast<char>(c + ('a' - 'A')) : c; }
+
+#ifdef LOG_SEARCH_SSE2
+inline int CountTrailingZeros(unsigned int mask) {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<int>(index);
+#else
+    return __builtin_ctz(mask);
+#endif
+}
+#endif
+
+int CountNewlines(const char* begin, const char* end) {
+    int count = 0;
+    const char* cursor = begin;
+#ifdef LOG_SEARCH_SSE2
+    const __m128i newline = _mm_set1_epi8('\n');
+    while (end - cursor >= 16) {
+        // 每个字节的计数最多累加 255 次，之后用 SAD 横向求和
+        const char* blockEnd = cursor + std::min<ptrdiff_t>((end - cursor) / 16, 255) * 16;
+        __m128i counts = _mm_setzero_si128();
+        for (; cursor < blockEnd; cursor += 16) {
+            counts = _mm_sub_epi8(counts, _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor)), newline));
+        }
+        const __m128i sums = _mm_sad_epu8(counts, _mm_setzero_si128());
+        count += _mm_cvtsi128_si32(sums) + _mm_cvtsi128_si32(_mm_srli_si128(sums, 8));
+    }
+#endif
+    while (cursor < end) {
+        const char* found = static_cast<const char*>(memchr(cursor, '\n', end - cursor));
+        if (found == nullptr) break;
+        count++;
+        cursor = found + 1;
+    }
+    return count;
+}
+
+inline bool IsRegexSpecial(char c) {
+    return strchr("\\^$.|?*+()[]{}", c) != nullptr;
+}
+
+// 取出正则表达式中每个匹配都必然包含的最长一段普通字符，用作子串预筛选；找不到时返回空串。
+// 只做保守的分析：含有 | 时放弃，括号和方括号内的内容、后跟 ? * { 的字符都不计入
+std::string GetRequiredLiteral(const std::string& pattern) {
+    if (pattern.find('|') != std::string::npos) return std::string();
+
+    std::string best;
+    std::string run;
+    auto finishRun = [&]() {
+        if (run.size() > best.size()) best = run;
+        run.clear();
+    };
+    int groupDepth = 0;
+    for (size_t i = 0; i < pattern.size(); i++) {
+        const char c = pattern[i];
+        if (c == '\\') {
+            finishRun();
+            i++;
+        } else if (c == '[') {
+            finishRun();
+            // 跳过字符集合，] 紧跟在 [ 或 [^ 之后时是普通字符
+            size_t close = i + 1;
+            if (close < pattern.size() && pattern[close] == '^') close++;
+            if (close < pattern.size() && pattern[close] == ']') close++;
+            while (close < pattern.size() && pattern[close] != ']') {
+                if (pattern[close] == '\\') close++;
+                close++;
+            }
+            i = close;
+        } else if (c == '(') {
+            finishRun();
+            groupDepth++;
+        } else if (c == ')') {
+            finishRun();
+            groupDepth = std::max(0, groupDepth - 1);
+        } else if (c == '?' || c == '*' || c == '{') {
+            if (!run.empty()) run.pop_back();
+            finishRun();
+            if (c == '{') {
+                const size_t close = pattern.find('}', i);
+                i = (close == std::string::npos) ? pattern.size() : close;
+            }
+        } else if (IsRegexSpecial(c) || groupDepth > 0) {
+            finishRun();
+        } else {
+            run.push_back(c);
+        }
+    }
+    finishRun();
+    return best;
+}
+
+class LineMatcher {
+public:
+    bool Compile(const LogSearchOptions& options, std::string& error) {
+        m_IgnoreCase = !options.caseSensitive;
+        m_UseRegex = options.regex &&
+            std::any_of(options.pattern.begin(), options.pattern.end(), IsRegexSpecial);
+        m_Needle = m_UseRegex ? GetRequiredLiteral(options.pattern) : options.pattern;
+        if (m_UseRegex) {
+            try {
+                auto flags = std::regex::ECMAScript | std::regex::optimize;
+                if (m_IgnoreCase) flags |= std::regex::icase;
+                m_Regex = std::regex(options.pattern, flags);
+            } catch (const std::regex_error& e) {
+                error = e.what();
+                return false;
+            }
+        }
+        if (m_IgnoreCase) {
+            std::transform(m_Needle.begin(), m_Needle.end(), m_Needle.begin(), FoldAscii);
+        }
+        return true;
+    }
+
+    // [begin, end) 是一行，不含换行符
+    bool MatchLine(const char* begin, const char* end) const {
+        if (!m_Needle.empty() && FindLiteral(begin, end) == nullptr) {
+            return false;
+        }
+        if (!m_UseRegex) {
+            return true;
+        }
+        if (end > begin && end[-1] == '\r') end--;
+        return std::regex_search(begin, end, m_Regex);
+    }
+
+    // 长行截断后需要保留的末尾字节数：子串查找时少于子串长度的末尾才可能与后续内容组成匹配；
+    // 正则表达式无法确定，保留一半上限，跨越更远的匹配（以及行首锚点）在超长的行上会被漏掉或误判
+    size_t GetPartialLineTail() const {
+        return m_UseRegex ? kMaxPartialLineBytes / 2 : m_Needle.size() - 1;
+    }
+
+    // [begin, end) 由完整的行组成（以换行符结尾），匹配行的序号（从 0 起）追加到 matches，返回行数
+    int SearchLines(const char* begin, const char* end, std::vector<int>& matches) const {
+        int line = 0;
+        const char* cursor = begin;
+        if (m_Needle.empty()) {
+            while (cursor < end) {
+                const char* newline = static_cast<const char*>(memchr(cursor, '\n', end - cursor));
+                const char* lineEnd = newline ? newline : end;
+                if (MatchLine(cursor, lineEnd)) matches.push_back(line);
+                line++;
+                cursor = lineEnd + 1;
+            }
+            return line;
+        }
+
+        // 不逐行进行：直接在整段内容中找下一个子串命中，再数出其间的换行符确定行号；
+        // 正则表达式只需要在含有必需子串的行上执行
+        while (cursor < end) {
+            const char* hit = FindLiteral(cursor, end);
+            if (hit == nullptr) break;
+            line += CountNewlines(cursor, hit);
+            const char* newline = static_cast<const char*>(memchr(hit, '\n', end - hit));
+            const char* lineEnd = newline ? newline : end;
+            if (m_UseRegex) {
+                const char* lineBegin = hit;
+                while (lineBegin > cursor && lineBegin[-1] != '\n') lineBegin--;
+                const char* matchEnd = (lineEnd > lineBegin && lineEnd[-1] == '\r') ? lineEnd - 1 : lineEnd;
+                if (std::regex_search(lineBegin, matchEnd, m_Regex)) matches.push_back(line);
+            } else {
+                matches.push_back(line);
+            }
+            cursor = newline ? newline + 1 : end;
+            line++;
+        }
+        return line + CountNewlines(cursor, end);
+    }
+
+private:
+    bool EqualsAt(const char* text) const {
+        if (!m_IgnoreCase) {
+            return memcmp(text, m_Needle.data(), m_Needle.size()) == 0;
+        }
+        for (size_t i = 0; i < m_Needle.size(); i++) {
+            if (FoldAscii(text[i]) != m_Needle[i]) return false;
+        }
+        return true;
+    }
+
+    const char* FindLiteral(const char* begin, const char* end) const {
+        const size_t needleSize = m_Needle.size();
+        if (needleSize == 0 || static_cast<size_t>(end - begin) < needleSize) return nullptr;
+        const char* lastStart = end - needleSize;
+        const char* cursor = begin;
+
+#ifdef LOG_SEARCH_SSE2
+        // 同时比较候选位置的首字符和尾字符，16 个位置一组，两者都相同时才逐字节确认。
+        // 忽略大小写时把字母的 0x20 位置 1 后再比较，误判的非字母字符由 EqualsAt() 排除
+        const char first = m_Needle[0];
+        const char last = m_Needle[needleSize - 1];
+        const __m128i firstChar = _mm_set1_epi8(first);
+        const __m128i lastChar = _mm_set1_epi8(last);
+        const __m128i firstFold = _mm_set1_epi8((m_IgnoreCase && IsAsciiLetter(first)) ? 0x20 : 0);
+        const __m128i lastFold = _mm_set1_epi8((m_IgnoreCase && IsAsciiLetter(last)) ? 0x20 : 0);
+        for (; cursor + 15 <= lastStart; cursor += 16) {
+            const __m128i blockFirst = _mm_or_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor)), firstFold);
+            const __m128i blockLast = _mm_or_si128(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor + needleSize - 1)), lastFold);
+            unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(
+                _mm_and_si128(_mm_cmpeq_epi8(blockFirst, firstChar), _mm_cmpeq_epi8(blockLast, lastChar))));
+            while (mask != 0) {
+                const char* candidate = cursor + CountTrailingZeros(mask);
+                if (EqualsAt(candidate)) return candidate;
+                mask &= mask - 1;
+            }
+        }
+#endif
+
+        if (!m_IgnoreCase) {
+            while (cursor <= lastStart) {
+                const char* candidate = static_cast<const char*>(memchr(cursor, m_Needle[0], lastStart - cursor + 1));
+                if (candidate == nullptr) return nullptr;
+                if (EqualsAt(candidate)) return candidate;
+                cursor = candidate + 1;
+            }
+            return nullptr;
+        }
+        for (; cursor <= lastStart; cursor++) {
+            if (EqualsAt(cursor)) return cursor;
+        }
+        return nullptr;
+    }
+
+    std::string m_Needle;        // 子串查找的内容或正则表达式的必需子串，忽略大小写时已转为小写
+    bool m_IgnoreCase = false;
+    bool m_UseRegex = false;
+    std::regex m_Regex;
+};
+
+// 上一块末尾尚未以换行结束的行。行很长时不再整行保存：已经匹配的只记住结果，否则只保留末尾
+// GetPartialLineTail() 字节，内存不会随一行的长度增长
+struct PartialLine {
+    std::string text;
+    bool matched = false;
+
+    bool IsEmpty() const { return text.empty() && !matched; }
+
+    void Clear() {
+        text.clear();
+        matched = false;
+    }
+
+    void Append(const LineMatcher& matcher, const char* begin, const char* end) {
+        if (matched) return;
+        text.append(begin, end);
+        if (text.size() <= kMaxPartialLineBytes) return;
+        if (matcher.MatchLine(text.data(), text.data() + text.size())) {
+            matched = true;
+            text.clear();
+            text.shrink_to_fit();
+            return;
+        }
+        text.erase(0, text.size() - matcher.GetPartialLineTail());
+    }
+
+    bool Match(const LineMatcher& matcher) const {
+        return matched || matcher.MatchLine(text.data(), text.data() + text.size());
+    }
+};
+
+// SearchLinesParallel 中每段交给 WorkerPool 的一个任务
+struct SearchSliceTask {
+    const LineMatcher* matcher;
+    const char* const* bounds;
+    std::vector<int>* sliceMatches;
+    int* sliceLines;
+
+    static void Run(int slice, void* data) {
+        SearchSliceTask& task = *static_cast<SearchSliceTask*>(data);
+        task.sliceLines[slice] = task.matcher->SearchLines(task.bounds[slice], task.bounds[slice + 1], task.sliceMatches[slice]);
+    }
+};
+
+// 把完整的行 [begin, end) 在换行处切成若干段，由搜索线程和 workers 并行搜索，
+// 匹配行号加上 firstLine 后追加到 matches，返回行数
+int SearchLinesParallel(const LineMatcher& matcher, const char* begin, const char* end, int firstLine,
+    std::vector<int>& matches, WorkerPool& workers) {
+    const size_t size = static_cast<size_t>(end - begin);
+    const int sliceCount = static_cast<int>(std::max<size_t>(1, std::min<size_t>(size / kMinSliceBytes, workers.GetThreadCount())));
+
+    std::vector<const char*> bounds(sliceCount + 1);
+    bounds[0] = begin;
+    bounds[sliceCount] = end;
+    for (int slice = 1; slice < sliceCount; slice++) {
+        const char* split = std::max(begin + size * slice / sliceCount, bounds[slice - 1]);
+        const char* newline = static_cast<const char*>(memchr(split, '\n', end - split));
+        bounds[slice] = newline ? newline + 1 : end;
+    }
+
+    std::vector<std::vector<int>> sliceMatches(sliceCount);
+    std::vector<int> sliceLines(sliceCount, 0);
+    SearchSliceTask task = {&matcher, bounds.data(), sliceMatches.data(), sliceLines.data()};
+    workers.ParallelFor(sliceCount, &SearchSliceTask::Run, &task);
+
+    // 按段的顺序合并，行号保持递增
+    int lineCount = 0;
+    for (int slice = 0; slice < sliceCount; slice++) {
+        for (int line : sliceMatches[slice]) {
+            matches.push_back(firstLine + lineCount + line);
+        }
+        lineCount += sliceLines[slice];
+    }
+    return lineCount;
+}
+
+} // namespace
+
+LogSearcher::~LogSearcher() {
+    Stop();
+}
+
+void LogSearcher::Start(const std::string& filePath, const LogSearchOptions& options, uint64_t endOffset) {
+    m_Path = filePath;
+    m_Options = options;
+    m_Error.clear();
+    m_TargetEnd = options.pattern.empty() ? 0 : endOffset;
+    m_ScannedEnd = 0;
+    m_LineCount = 0;
+    m_MatchBits.clear();
+    m_MatchLines.clear();
+    m_TailMatch = false;
+
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Generation = m_JobGeneration.load() + 1;
+        m_JobGeneration.store(m_Generation);
+        m_JobPath = m_Path;
+        m_JobOptions = m_Options;
+        m_JobEnd = m_TargetEnd;
+    }
+    if (!m_Thread.joinable() && !options.pattern.empty()) {
+        m_Thread = std::thread(&LogSearcher::ThreadMain, this);
+    }
+    m_Condition.notify_all();
+}
+
+void LogSearcher::Extend(uint64_t endOffset) {
+    if (!IsActive() || endOffset <= m_TargetEnd) return;
+    m_TargetEnd = endOffset;
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_JobEnd = endOffset;
+    }
+    m_Condition.notify_all();
+}
+
+void LogSearcher::Clear() {
+    Start(std::string(), LogSearchOptions(), 0);
+}
+
+void LogSearcher::Stop() {
+    if (!m_Thread.joinable()) return;
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_StopRequested = true;
+        m_JobGeneration.store(m_JobGeneration.load() + 1);
+    }
+    m_Condition.notify_all();
+    m_Thread.join();
+    m_StopRequested = false;
+
+    // 生产者已经停止，丢弃遗留的批次
+    LogSearchBatch staleBatch;
+    while (m_Batches.Pop(staleBatch)) {}
+}
+
+void LogSearcher::Poll() {
+    LogSearchBatch batch;
+    while (m_Batches.Pop(batch)) {
+        if (batch.generation != m_Generation) continue;
+        if (!batch.error.empty()) {
+            m_Error = batch.error;
+            continue;
+        }
+
+        // 多留一位给末尾尚未结束的行
+        m_MatchBits.resize(static_cast<size_t>(batch.lineCount) / 64 + 1, 0);
+        for (int line : batch.matchLines) {
+            m_MatchBits[static_cast<size_t>(line) >> 6] |= 1ull << (line & 63);
+        }
+        m_MatchLines.insert(m_MatchLines.end(), batch.matchLines.begin(), batch.matchLines.end());
+        m_LineCount = batch.lineCount;
+        m_ScannedEnd = batch.scannedEnd;
+        m_TailMatch = batch.tailMatch;
+    }
+}
+
+int LogSearcher::GetMatchLine(int matchIndex) const {
+    if (matchIndex < static_cast<int>(m_MatchLines.size())) {
+        return m_MatchLines[matchIndex];
+    }
+    return m_LineCount;
+}
+
+bool LogSearcher::IsMatch(int lineIndex) const {
+    if (lineIndex < 0 || lineIndex > m_LineCount) return false;
+    if (lineIndex == m_LineCount) return m_TailMatch;
+    return (m_MatchBits[static_cast<size_t>(lineIndex) >> 6] >> (lineIndex & 63)) & 1;
+}
+
+int LogSearcher::LowerBoundMatch(int lineIndex) const {
+    int matchIndex = static_cast<int>(std::lower_bound(m_MatchLines.begin(), m_MatchLines.end(), lineIndex) - m_MatchLines.begin());
+    if (matchIndex == static_cast<int>(m_MatchLines.size()) && m_TailMatch && m_LineCount < lineIndex) {
+        matchIndex++;
+    }
+    return matchIndex;
+}
+
+int LogSearcher::FindNextMatch(int lineIndex, bool forward) const {
+    const int matchCount = GetMatchCount();
+    if (matchCount == 0) return -1;
+    int matchIndex = forward ? LowerBoundMatch(lineIndex + 1) : LowerBoundMatch(lineIndex) - 1;
+    if (matchIndex >= matchCount) matchIndex = 0;
+    if (matchIndex < 0) matchIndex = matchCount - 1;
+    return GetMatchLine(matchIndex);
+}
+
+bool LogSearcher::PushBatch(LogSearchBatch& batch, uint64_t generation) {
+    while (!m_Batches.Push(std::move(batch))) {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_Condition.wait_for(lock, std::chrono::milliseconds(kRetryIntervalMs));
+        if (m_StopRequested || m_JobGeneration.load() != generation) return false;
+    }
+    return true;
+}
+
+void LogSearcher::ThreadMain() {
+    // 分段搜索的线程在搜索线程的生命周期内常驻，不再为每块内容创建和回收线程
+    const int threadCount = std::max(1, std::min(kMaxSearchThreads, static_cast<int>(std::thread::hardware_concurrency())));
+    m_Workers.Start(threadCount);
+    LineMatcher matcher;
+    uint64_t generation = 0;
+    std::string path;
+    bool searchable = false;
+    uint64_t scannedEnd = 0;
+    uint64_t waitEnd = 0;           // 读取失败（文件被截断）后等到范围再次增长时才重试
+    int lineCount = 0;
+    PartialLine carry;              // 上一块末尾尚未以换行结束的行
+
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    while (true) {
+        m_Condition.wait(lock, [&] {
+            return m_StopRequested || m_JobGeneration.load() != generation || (searchable && m_JobEnd > waitEnd);
+        });
+        if (m_StopRequested) break;
+
+        if (m_JobGeneration.load() != generation) {
+            generation = m_JobGeneration.load();
+            path = m_JobPath;
+            const LogSearchOptions options = m_JobOptions;
+            scannedEnd = waitEnd = 0;
+            lineCount = 0;
+            carry.Clear();
+            searchable = false;
+            if (options.pattern.empty()) continue;
+
+            LogSearchBatch batch;
+            batch.generation = generation;
+            searchable = matcher.Compile(options, batch.error);
+            if (!searchable) {
+                lock.unlock();
+                PushBatch(batch, generation);
+                lock.lock();
+                continue;
+            }
+        }
+        const uint64_t end = m_JobEnd;
+        lock.unlock();
+
+        while (scannedEnd < end && m_JobGeneration.load() == generation) {
+            const uint64_t chunkEnd = std::min(scannedEnd + kSearchChunkBytes, end);
+            LogSearchBatch batch;
+            batch.generation = generation;
+            const uint64_t readEnd = LogSource::ReadRange(path, scannedEnd, chunkEnd,
+                [&](uint64_t, const char* data, size_t size) {
+                    const char* cursor = data;
+                    const char* dataEnd = data + size;
+                    if (!carry.IsEmpty()) {
+                        const char* newline = static_cast<const char*>(memchr(cursor, '\n', size));
+                        if (newline == nullptr) {
+                            carry.Append(matcher, cursor, dataEnd);
+                            return;
+                        }
+                        carry.Append(matcher, cursor, newline);
+                        if (carry.Match(matcher)) {
+                            batch.matchLines.push_back(lineCount);
+                        }
+                        lineCount++;
+                        carry.Clear();
+                        cursor = newline + 1;
+                    }
+
+                    // 最后一个换行符之后的内容留到下一块，与后续内容拼成完整的行再搜索
+                    const char* bodyEnd = dataEnd;
+                    while (bodyEnd > cursor && bodyEnd[-1] != '\n') bodyEnd--;
+                    lineCount += SearchLinesParallel(matcher, cursor, bodyEnd, lineCount, batch.matchLines, m_Workers);
+                    carry.Append(matcher, bodyEnd, dataEnd);
+                });
+            if (readEnd != chunkEnd) {
+                waitEnd = end;
+                break;
+            }
+            scannedEnd = waitEnd = chunkEnd;
+
+            batch.scannedEnd = scannedEnd;
+            batch.lineCount = lineCount;
+            if (scannedEnd == end && !carry.IsEmpty()) {
+                batch.tailMatch = carry.Match(matcher);
+            }
+            if (!PushBatch(batch, generation)) break;
+        }
+        lock.lock();
+    }
+    lock.unlock();
+    m_Workers.Stop();
+}
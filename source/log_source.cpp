@@ -0,0 +1,325 @@
+/********************************************************************
+MIT License
+
+Copyright (c) 2025 loong22
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*********************************************************************/
+
+#include "../include/log_source.h"
+#include <algorithm>
+#include <cstring>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+// 建立行索引时每次映射的字节数，扫描完即解除映射
+constexpr uint64_t kScanChunkBytes = 64ull * 1024 * 1024;
+// 界面显示使用的驻留窗口大小
+constexpr uint64_t kResidentWindowBytes = 8ull * 1024 * 1024;
+
+#ifdef _WIN32
+std::wstring ToWidePath(const std::string& filePath) {
+    int size_needed = MultiByteToWideChar(CP_UTF8, 0, filePath.c_str(), -1, NULL, 0);
+    std::wstring widePath(size_needed, 0);
+    MultiByteToWideChar(CP_UTF8, 0, filePath.c_str(), -1, &widePath[0], size_needed);
+    if (!widePath.empty() && widePath.back() == 0) {
+        widePath.pop_back();
+    }
+    return widePath;
+}
+#endif
+
+} // namespace
+
+// 使用 64 位接口，超过 2 GB 的日志也能取得正确大小
+bool LogSource::QueryFileInfo(const std::string& filePath, uint64_t& fileSize, std::time_t& lastModified) {
+#ifdef _WIN32
+    struct _stat64 fileInfo;
+    if (_wstat64(ToWidePath(filePath).c_str(), &fileInfo) != 0) return false;
+#else
+    struct stat fileInfo;
+    if (stat(filePath.c_str(), &fileInfo) != 0) return false;
+#endif
+    fileSize = static_cast<uint64_t>(fileInfo.st_size);
+    lastModified = fileInfo.st_mtime;
+    return true;
+}
+
+uint64_t LogSource::ReadRange(const std::string& filePath, uint64_t begin, uint64_t end, const LogChunkCallback& onChunk) {
+    uint64_t readEnd = begin;
+    Region chunk;
+    while (readEnd < end) {
+        const uint64_t chunkBegin = readEnd;
+        const uint64_t chunkEnd = std::min(chunkBegin + kScanChunkBytes, end);
+        if (!MapRegion(filePath, chunkBegin, chunkEnd, chunk)) {
+            break;
+        }
+        onChunk(chunkBegin, chunk.data, static_cast<size_t>(chunkEnd - chunkBegin));
+        readEnd = chunkEnd;
+    }
+    UnmapRegion(chunk);
+    return readEnd;
+}
+
+uint64_t LogSource::IndexRange(const std::string& filePath, uint64_t begin, uint64_t end, std::vector<uint64_t>& lineOffsets,
+    const LogChunkCallback& onChunk) {
+    if (begin == 0 && end > 0 && lineOffsets.empty()) {
+        lineOffsets.push_back(0);
+    }
+
+    return ReadRange(filePath, begin, end, [&lineOffsets, &onChunk](uint64_t chunkBegin, const char* data, size_t size) {
+        const char* cursor = data;
+        const char* dataEnd = data + size;
+        while (cursor < dataEnd) {
+            const char* newline = static_cast<const char*>(memchr(cursor, '\n', dataEnd - cursor));
+            if (newline == nullptr) {
+                break;
+            }
+            lineOffsets.push_back(chunkBegin + static_cast<uint64_t>(newline - data) + 1);
+            cursor = newline + 1;
+        }
+        if (onChunk) {
+            onChunk(chunkBegin, data, size);
+        }
+    });
+}
+
+LogSource::~LogSource() {
+    Close();
+}
+
+bool LogSource::Open(const std::string& filePath) {
+    Close();
+    m_Path = filePath;
+    m_FileAvailable = QueryFileInfo(m_Path, m_FileSize, m_LastModified);
+    return m_FileAvailable;
+}
+
+void LogSource::Close() {
+    Reset();
+    m_Path.clear();
+    m_FileSize = 0;
+    m_LastModified = 0;
+    m_FileAvailable = false;
+}
+
+void LogSource::Reset() {
+    UnmapRegion(m_Window);
+    m_LineOffsets.clear();
+    m_IndexedSize = 0;
+}
+
+bool LogSource::Refresh(const LogChunkCallback& onChunk) {
+    if (!IsOpen()) return false;
+    m_FileAvailable = QueryFileInfo(m_Path, m_FileSize, m_LastModified);
+    if (!m_FileAvailable) return false;
+
+    // 日志只会追加写入；文件变短说明被截断或重新生成，需要从头建立索引
+    if (m_FileSize < m_IndexedSize) {
+        Reset();
+    }
+
+    m_IndexedSize = IndexRange(m_Path, m_IndexedSize, m_FileSize, m_LineOffsets, onChunk);
+    return m_IndexedSize == m_FileSize;
+}
+
+bool LogSource::ApplyBatch(LogLineBatch& batch) {
+    m_FileSize = batch.fileSize;
+    m_LastModified = batch.lastModified;
+    m_FileAvailable = batch.fileAvailable;
+
+    if (batch.reset) {
+        Reset();
+    }
+    if (batch.begin != m_IndexedSize || batch.end <= batch.begin) {
+        return false;
+    }
+
+    if (m_LineOffsets.empty()) {
+        m_LineOffsets.swap(batch.lineOffsets);
+    } else {
+        m_LineOffsets.insert(m_LineOffsets.end(), batch.lineOffsets.begin(), batch.lineOffsets.end());
+    }
+    m_IndexedSize = batch.end;
+    return true;
+}
+
+int LogSource::GetLineCount() const {
+    if (m_LineOffsets.empty()) return 0;
+    // 以换行符结尾时最后一个行首偏移指向已索引内容的末尾，不计为一行
+    int lineCount = static_cast<int>(m_LineOffsets.size());
+    if (m_LineOffsets.back() >= m_IndexedSize) {
+        lineCount--;
+    }
+    return lineCount;
+}
+
+uint64_t LogSource::GetLineEnd(int lineIndex) const {
+    if (lineIndex + 1 < static_cast<int>(m_LineOffsets.size())) {
+        return m_LineOffsets[lineIndex + 1] - 1;
+    }
+    return m_IndexedSize;
+}
+
+bool LogSource::MapLines(int firstLine, int lastLine) {
+    if (firstLine >= lastLine) return true;
+
+    const uint64_t begin = m_LineOffsets[firstLine];
+    const uint64_t end = GetLineEnd(lastLine - 1);
+    if (m_Window.data != nullptr && begin >= m_Window.begin && end <= m_Window.end) {
+        return true;
+    }
+
+    // 在可见范围前后都留出余量，小幅滚动时不必重新映射
+    const uint64_t margin = kResidentWindowBytes / 4;
+    const uint64_t windowBegin = begin > margin ? begin - margin : 0;
+    const uint64_t windowEnd = std::max(end, std::min(windowBegin + kResidentWindowBytes, m_IndexedSize));
+    return MapRegion(m_Path, windowBegin, windowEnd, m_Window);
+}
+
+std::string_view LogSource::GetLine(int lineIndex) const {
+    const uint64_t begin = m_LineOffsets[lineIndex];
+    const uint64_t end = GetLineEnd(lineIndex);
+    if (m_Window.data == nullptr || begin < m_Window.begin || end > m_Window.end) {
+        return std::string_view();
+    }
+
+    const char* lineBegin = m_Window.data + (begin - m_Window.begin);
+    size_t length = static_cast<size_t>(end - begin);
+    if (length > 0 && lineBegin[length - 1] == '\r') {
+        length--;
+    }
+    return std::string_view(lineBegin, length);
+}
+
+bool LogSource::MapRegion(const std::string& filePath, uint64_t begin, uint64_t end, Region& region) {
+    UnmapRegion(region);
+    if (end <= begin) return false;
+    const size_t length = static_cast<size_t>(end - begin);
+
+#ifdef _WIN32
+    HANDLE file = CreateFileW(ToWidePath(filePath).c_str(), GENERIC_READ,
+        FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+
+    SYSTEM_INFO systemInfo;
+    GetSystemInfo(&systemInfo);
+    const uint64_t alignedBegin = begin - begin % systemInfo.dwAllocationGranularity;
+    const size_t mapSize = static_cast<size_t>(end - alignedBegin);
+
+    // 映射对象的大小取 end，文件已被截断时创建会失败并走读文件回退
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY,
+        static_cast<DWORD>(end >> 32), static_cast<DWORD>(end & 0xFFFFFFFFu), nullptr);
+    if (mapping != nullptr) {
+        void* view = MapViewOfFile(mapping, FILE_MAP_READ,
+            static_cast<DWORD>(alignedBegin >> 32), static_cast<DWORD>(alignedBegin & 0xFFFFFFFFu), mapSize);
+        CloseHandle(mapping);
+        if (view != nullptr) {
+            region.mapBase = view;
+            region.mapSize = mapSize;
+            region.data = static_cast<const char*>(view) + (begin - alignedBegin);
+        }
+    }
+
+    if (region.mapBase == nullptr) {
+        region.buffer.resize(length);
+        LARGE_INTEGER offset;
+        offset.QuadPart = static_cast<LONGLONG>(begin);
+        DWORD bytesRead = 0;
+        bool readOk = SetFilePointerEx(file, offset, nullptr, FILE_BEGIN) &&
+            ReadFile(file, region.buffer.data(), static_cast<DWORD>(length), &bytesRead, nullptr) &&
+            bytesRead == length;
+        if (!readOk) {
+            CloseHandle(file);
+            region.buffer.clear();
+            return false;
+        }
+        region.data = region.buffer.data();
+    }
+    CloseHandle(file);
+#else
+    int fd = open(filePath.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    // 映射超出文件末尾的页在访问时会触发 SIGBUS，先确认文件没有被截断
+    struct stat fileInfo;
+    if (fstat(fd, &fileInfo) != 0 || static_cast<uint64_t>(fileInfo.st_size) < end) {
+        close(fd);
+        return false;
+    }
+
+    const uint64_t pageSize = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    const uint64_t alignedBegin = begin - begin % pageSize;
+    const size_t mapSize = static_cast<size_t>(end - alignedBegin);
+    void* view = mmap(nullptr, mapSize, PROT_READ, MAP_SHARED, fd, static_cast<off_t>(alignedBegin));
+    if (view != MAP_FAILED) {
+        region.mapBase = view;
+        region.mapSize = mapSize;
+        region.data = static_cast<const char*>(view) + (begin - alignedBegin);
+    } else {
+        region.buffer.resize(length);
+        size_t totalRead = 0;
+        while (totalRead < length) {
+            ssize_t bytesRead = pread(fd, region.buffer.data() + totalRead, length - totalRead,
+                static_cast<off_t>(begin + totalRead));
+            if (bytesRead <= 0) break;
+            totalRead += static_cast<size_t>(bytesRead);
+        }
+        if (totalRead != length) {
+            close(fd);
+            region.buffer.clear();
+            return false;
+        }
+        region.data = region.buffer.data();
+    }
+    close(fd);
+#endif
+
+    region.begin = begin;
+    region.end = end;
+    return true;
+}
+
+void LogSource::UnmapRegion(Region& region) {
+    if (region.mapBase != nullptr) {
+#ifdef _WIN32
+        UnmapViewOfFile(region.mapBase);
+#else
+        munmap(region.mapBase, region.mapSize);
+#endif
+    }
+    region.mapBase = nullptr;
+    region.mapSize = 0;
+    region.data = nullptr;
+    region.begin = 0;
+    region.end = 0;
+    std::vector<char>().swap(region.buffer);
+}
@@ -0,0 +1,267 @@
+/********************************************************************
+MIT License
+
+Copyright (c) 2025 loong22
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*********************************************************************/
+
+
+#include "../include/log_tailer.h"
+#include <algorithm>
+#include <chrono>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__linux__)
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+// 每批最多建立索引的字节数，首次打开大日志时界面可以逐批显示
+constexpr uint64_t kBatchBytes = 16ull * 1024 * 1024;
+// 队列已满时重新提交的间隔
+constexpr int kRetryIntervalMs = 10;
+
+std::string GetDirectory(const std::string& filePath) {
+    size_t separator = filePath.find_last_of("/\\");
+    if (separator == std::string::npos) return ".";
+    if (separator == 0) return filePath.substr(0, 1);
+    return filePath.substr(0, separator);
+}
+
+#ifdef _WIN32
+std::wstring ToWidePath(const std::string& filePath) {
+    int size_needed = MultiByteToWideChar(CP_UTF8, 0, filePath.c_str(), -1, NULL, 0);
+    std::wstring widePath(size_needed, 0);
+    MultiByteToWideChar(CP_UTF8, 0, filePath.c_str(), -1, &widePath[0], size_needed);
+    if (!widePath.empty() && widePath.back() == 0) {
+        widePath.pop_back();
+    }
+    return widePath;
+}
+#endif
+
+} // namespace
+
+LogTailer::~LogTailer() {
+    Stop();
+}
+
+void LogTailer::Start(const std::string& filePath, uint64_t startOffset, float intervalSeconds, Su2HistoryParser* historyParser) {
+    Stop();
+
+    // 生产者已经停止，丢弃上一次跟踪遗留的批次
+    LogLineBatch staleBatch;
+    while (m_Batches.Pop(staleBatch)) {}
+
+    m_Path = filePath;
+    m_HistoryParser = historyParser;
+    m_StopRequested.store(false);
+    m_RescanRequested.store(false);
+    SetInterval(intervalSeconds);
+    OpenWatcher();
+    m_Thread = std::thread(&LogTailer::ThreadMain, this, startOffset);
+}
+
+void LogTailer::Stop() {
+    if (!m_Thread.joinable()) return;
+    m_StopRequested.store(true);
+    Wake();
+    m_Thread.join();
+    CloseWatcher();
+}
+
+void LogTailer::SetInterval(float intervalSeconds) {
+    m_IntervalMs.store(std::max(10, static_cast<int>(intervalSeconds * 1000.0f)));
+}
+
+void LogTailer::ThreadMain(uint64_t startOffset) {
+    uint64_t scannedSize = startOffset;
+    uint64_t lastFileSize = 0;
+    std::time_t lastModified = 0;
+    bool lastAvailable = false;
+    bool firstPass = true;
+    LogLineBatch pending;
+    bool hasPending = false;
+
+    while (!m_StopRequested.load()) {
+        if (!firstPass) {
+            WaitForChange(hasPending ? kRetryIntervalMs : m_IntervalMs.load());
+            if (m_StopRequested.load()) break;
+        }
+
+        // 界面线程还没有取走上一批，先把它交出去再继续扫描，保证批次顺序
+        if (hasPending) {
+            if (!m_Batches.Push(std::move(pending))) continue;
+            hasPending = false;
+            if (m_OnBatch) m_OnBatch();
+        }
+
+        LogLineBatch batch;
+        batch.fileAvailable = LogSource::QueryFileInfo(m_Path, batch.fileSize, batch.lastModified);
+        if (m_RescanRequested.exchange(false) || (batch.fileAvailable && batch.fileSize < scannedSize)) {
+            scannedSize = 0;
+            batch.reset = true;
+            if (m_HistoryParser) {
+                m_HistoryParser->Reset();
+                batch.history.MarkReset();
+            }
+        }
+        batch.begin = batch.end = scannedSize;
+
+        // 文件状态变化时即使没有新内容也要通知界面，用于显示大小、修改时间和文件是否存在
+        bool statusChanged = firstPass || batch.reset || batch.fileAvailable != lastAvailable ||
+            batch.fileSize != lastFileSize || batch.lastModified != lastModified;
+        lastAvailable = batch.fileAvailable;
+        lastFileSize = batch.fileSize;
+        lastModified = batch.lastModified;
+        firstPass = false;
+
+        while (true) {
+            if (batch.fileAvailable && scannedSize < batch.fileSize) {
+                const uint64_t batchEnd = std::min(scannedSize + kBatchBytes, batch.fileSize);
+                batch.end = LogSource::IndexRange(m_Path, scannedSize, batchEnd, batch.lineOffsets,
+                    [this, &batch](uint64_t offset, const char* data, size_t size) {
+                        if (m_HistoryParser) m_HistoryParser->FeedChunk(offset, data, size, batch.history);
+                    });
+            }
+            const bool progressed = batch.end > batch.begin;
+            if (!progressed && !statusChanged) break;
+            scannedSize = batch.end;
+
+            LogLineBatch next;
+            next.fileSize = batch.fileSize;
+            next.lastModified = batch.lastModified;
+            next.fileAvailable = batch.fileAvailable;
+            next.begin = next.end = scannedSize;
+
+            if (!m_Batches.Push(std::move(batch))) {
+                pending = std::move(batch);
+                hasPending = true;
+                break;
+            }
+            if (m_OnBatch) m_OnBatch();
+            statusChanged = false;
+            batch = std::move(next);
+            if (!progressed || m_StopRequested.load()) break;
+        }
+    }
+}
+
+#if defined(_WIN32)
+
+bool LogTailer::OpenWatcher() {
+    m_StopEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+    HANDLE change = FindFirstChangeNotificationW(ToWidePath(GetDirectory(m_Path)).c_str(), FALSE,
+        FILE_NOTIFY_CHANGE_SIZE | FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_FILE_NAME);
+    m_ChangeHandle = (change == INVALID_HANDLE_VALUE) ? nullptr : change;
+    return m_ChangeHandle != nullptr;
+}
+
+void LogTailer::CloseWatcher() {
+    if (m_ChangeHandle) { FindCloseChangeNotification(m_ChangeHandle); m_ChangeHandle = nullptr; }
+    if (m_StopEvent) { CloseHandle(m_StopEvent); m_StopEvent = nullptr; }
+}
+
+void LogTailer::WaitForChange(int timeoutMs) {
+    if (m_StopEvent == nullptr) {
+        Sleep(static_cast<DWORD>(timeoutMs));
+        return;
+    }
+    HANDLE handles[2] = { m_StopEvent, m_ChangeHandle };
+    DWORD handleCount = m_ChangeHandle ? 2 : 1;
+    DWORD result = WaitForMultipleObjects(handleCount, handles, FALSE, static_cast<DWORD>(timeoutMs));
+    if (result == WAIT_OBJECT_0 + 1) {
+        FindNextChangeNotification(m_ChangeHandle);
+    }
+}
+
+void LogTailer::Wake() {
+    if (m_StopEvent) SetEvent(m_StopEvent);
+}
+
+#elif defined(__linux__)
+
+bool LogTailer::OpenWatcher() {
+    m_WakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    m_InotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    // 监视所在目录而不是文件本身，日志被删除重建或轮转后仍能收到通知
+    if (m_InotifyFd >= 0 && inotify_add_watch(m_InotifyFd, GetDirectory(m_Path).c_str(),
+            IN_MODIFY | IN_CLOSE_WRITE | IN_CREATE | IN_MOVED_TO | IN_DELETE) < 0) {
+        close(m_InotifyFd);
+        m_InotifyFd = -1;
+    }
+    return m_InotifyFd >= 0;
+}
+
+void LogTailer::CloseWatcher() {
+    if (m_InotifyFd >= 0) { close(m_InotifyFd); m_InotifyFd = -1; }
+    if (m_WakeFd >= 0) { close(m_WakeFd); m_WakeFd = -1; }
+}
+
+void LogTailer::WaitForChange(int timeoutMs) {
+    pollfd fds[2];
+    int fdCount = 0;
+    if (m_WakeFd >= 0) fds[fdCount++] = { m_WakeFd, POLLIN, 0 };
+    if (m_InotifyFd >= 0) fds[fdCount++] = { m_InotifyFd, POLLIN, 0 };
+    poll(fds, fdCount, timeoutMs);
+
+    // 只关心是否发生了变化，清空事件队列即可
+    if (m_InotifyFd >= 0) {
+        char buffer[4096];
+        while (read(m_InotifyFd, buffer, sizeof(buffer)) > 0) {}
+    }
+}
+
+void LogTailer::Wake() {
+    if (m_WakeFd >= 0) {
+        uint64_t value = 1;
+        ssize_t written = write(m_WakeFd, &value, sizeof(value));
+        (void)written;
+    }
+}
+
+#else
+
+bool LogTailer::OpenWatcher() {
+    return false;
+}
+
+void LogTailer::CloseWatcher() {
+}
+
+void LogTailer::WaitForChange(int timeoutMs) {
+    std::unique_lock<std::mutex> lock(m_WaitMutex);
+    m_WaitCondition.wait_for(lock, std::chrono::milliseconds(timeoutMs), [this] { return m_StopRequested.load(); });
+}
+
+void LogTailer::Wake() {
+    std::lock_guard<std::mutex> lock(m_WaitMutex);
+    m_WaitCondition.notify_all();
+}
+
+#endif
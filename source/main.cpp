@@ -23,6 +23,7 @@ SOFTWARE.
 *********************************************************************/
 
 #include "../include/imgui_app.h"
+#include "../include/frame_profiler.h"
 #include "imgui.h"
 #include "imgui_internal.h"  // 添加这个头文件以使用ImGuiWindow和FindWindowByName
 #include "imgui_impl_win32.h"
@@ -46,6 +47,25 @@ bool g_SwapChainOccluded = false;
 UINT g_ResizeWidth = 0, g_ResizeHeight = 0;
 ID3D11RenderTargetView* g_mainRenderTargetView = nullptr;
 
+// 界面在没有新消息时是否仍需连续绘制：后台任务的进度条、搜索进度、拖动中的鼠标、演示窗口里的动画，
+// 以及本帧通过 g_AppState.animationRequested 请求连续绘制的窗口
+static bool IsUiAnimating(bool showDemoWindow)
+{
+    if (showDemoWindow || g_AppState.animationRequested || g_AppState.jobs.HasJobs() || g_AppState.logSearcher.IsSearching())
+        return true;
+    return ImGui::IsAnyMouseDown();
+}
+
+// 空闲等待的超时：输入框的光标需要闪烁，悬停的提示需要延时出现，其余情况一直等到下一条消息
+static DWORD GetIdleWaitTimeout()
+{
+    if (ImGui::GetIO().WantTextInput)
+        return 250;
+    if (ImGui::IsAnyItemHovered())
+        return 100;
+    return INFINITE;
+}
+
 // Main code
 int main(int, char**)
 {
@@ -176,8 +196,14 @@ int main(int, char**)
     ImVec2 last_main_window_pos(0, 0);
     ImVec2 last_main_window_size(0, 0);
 
+    // 后台跟踪线程交出新的日志数据时唤醒空闲等待中的主循环
+    g_AppState.logTailer.SetWakeCallback([hwnd]() { ::PostMessageW(hwnd, WM_NULL, 0, 0); });
+
     // Main loop
     bool done = false;
+    // 收到消息或等待超时后至少再绘制的帧数，让悬停、弹出窗口和自动调整大小等需要多帧的状态稳定下来
+    const int frames_after_wake = 3;
+    int frames_to_render = frames_after_wake;
     
     // 添加用于追踪分辨率变化的变量
     static float last_display_width = 0.0f;
@@ -187,6 +213,13 @@ int main(int, char**)
     
     while (!done && !g_AppState.wantToQuit)
     {
+        // 空闲时阻塞在消息队列上，直到有输入、后台线程投递的唤醒消息或界面需要的定时刷新
+        if (g_AppState.powerSaving && frames_to_render <= 0)
+        {
+            ::MsgWaitForMultipleObjectsEx(0, nullptr, GetIdleWaitTimeout(), QS_ALLINPUT, MWMO_INPUTAVAILABLE);
+            frames_to_render = frames_after_wake;
+        }
+
         // Poll and handle messages
         MSG msg;
         while (::PeekMessage(&msg, nullptr, 0U, 0U, PM_REMOVE))
@@ -195,6 +228,7 @@ int main(int, char**)
             ::DispatchMessage(&msg);
             if (msg.message == WM_QUIT)
                 done = true;
+            frames_to_render = frames_after_wake;
         }
         if (done)
             break;
@@ -202,7 +236,10 @@ int main(int, char**)
         // Handle window being minimized or screen locked
         if (g_SwapChainOccluded && g_pSwapChain->Present(0, DXGI_PRESENT_TEST) == DXGI_STATUS_OCCLUDED)
         {
-            ::Sleep(10);
+            if (g_AppState.powerSaving)
+                ::MsgWaitForMultipleObjectsEx(0, nullptr, 100, QS_ALLINPUT, MWMO_INPUTAVAILABLE);
+            else
+                ::Sleep(10);
             continue;
         }
         g_SwapChainOccluded = false;
@@ -216,10 +253,26 @@ int main(int, char**)
             CreateRenderTarget();
         }
 
+        // 帧耗时分析从这里开始计时，不包括上面的空闲等待
+        FrameProfiler& profiler = GetFrameProfiler();
+        profiler.BeginFrame();
+        g_AppState.animationRequested = false;
+
         // Start the Dear ImGui frame
-        ImGui_ImplDX11_NewFrame();
-        ImGui_ImplWin32_NewFrame();
-        ImGui::NewFrame();
+        {
+            PROFILE_SCOPE("NewFrame");
+            ImGui_ImplDX11_NewFrame();
+            ImGui_ImplWin32_NewFrame();
+            ImGui::NewFrame();
+        }
+
+        {
+            PROFILE_SCOPE("PollBackground");
+            // 接收后台日志跟踪线程建立好的行索引和收敛历史
+            PollLogTailer();
+            // 已完成的后台任务在帧开始时把结果交回界面状态
+            g_AppState.jobs.Poll();
+        }
         
         // 检测窗口是否最大化，并计算合适的UI缩放比例
         bool is_maximized = IsZoomed(hwnd);
@@ -288,30 +341,46 @@ int main(int, char**)
         }
 
         // 显示导航栏
-        ShowNavigationBar();
+        {
+            PROFILE_SCOPE("ShowNavigationBar");
+            ShowNavigationBar();
+        }
 
         // 显示各种弹窗
-        if (g_AppState.showAboutWindow)
+        if (g_AppState.showAboutWindow) {
+            PROFILE_SCOPE("ShowAboutWindow");
             ShowAboutWindow(&g_AppState.showAboutWindow);
+        }
 
-        if (g_AppState.showPrefsWindow)
+        if (g_AppState.showPrefsWindow) {
+            PROFILE_SCOPE("ShowPreferencesWindow");
             ShowPreferencesWindow(&g_AppState.showPrefsWindow);
+        }
 
-        if (g_AppState.showThemeWindow)
+        if (g_AppState.showThemeWindow) {
+            PROFILE_SCOPE("ShowThemeWindow");
             ShowThemeWindow(&g_AppState.showThemeWindow);
+        }
 
-        if (g_AppState.showHelpWindow)
+        if (g_AppState.showHelpWindow) {
+            PROFILE_SCOPE("ShowHelpWindow");
             ShowHelpWindow(&g_AppState.showHelpWindow);
+        }
 
-        if (g_AppState.showUpdateWindow)
+        if (g_AppState.showUpdateWindow) {
+            PROFILE_SCOPE("ShowUpdateCheckWindow");
             ShowUpdateCheckWindow(&g_AppState.showUpdateWindow);
+        }
 
         // 显示Demo窗口
-        if (show_demo_window)
+        if (show_demo_window) {
+            PROFILE_SCOPE("ShowDemoWindow");
             ImGui::ShowDemoWindow(&show_demo_window);
+        }
 
         // 主菜单窗口 - 使用默认设置
         {
+            PROFILE_SCOPE("ShowMainPanel");
             // 获取菜单栏高度
             float menu_bar_height = ImGui::GetFrameHeight();
             
@@ -391,6 +460,7 @@ int main(int, char**)
                                                ImGuiWindowFlags_AlwaysVerticalScrollbar;
             
             if (ImGui::Begin(u8"日志窗口", &show_log_window, log_window_flags)) {
+                PROFILE_SCOPE("ShowLogWindow");
                 ShowLogWindow(nullptr);
             }
             ImGui::End();
@@ -412,6 +482,7 @@ int main(int, char**)
                 ImGui::SetNextWindowSize(ImVec2(plot_width, plot_height), ImGuiCond_Appearing);
             }
             
+            PROFILE_SCOPE("ShowPlotWindow");
             ShowPlotWindow(&g_AppState.showPlotWindow);
         }
 
@@ -431,22 +502,70 @@ int main(int, char**)
                 ImGui::SetNextWindowSize(ImVec2(plot3d_width, plot3d_height), ImGuiCond_Appearing);
             }
             
+            PROFILE_SCOPE("DemoMeshPlots");
             DemoMeshPlots(&g_AppState.show3DPlotWindow);
         }
 
+        // 后台任务进度
+        {
+            PROFILE_SCOPE("ShowJobProgressWindow");
+            ShowJobProgressWindow();
+        }
+
+        if (g_AppState.showProfilerWindow) {
+            PROFILE_SCOPE("ShowProfilerWindow");
+            ShowProfilerWindow(&g_AppState.showProfilerWindow);
+        }
+
+        if (g_AppState.showDrawStatsWindow) {
+            PROFILE_SCOPE("ShowDrawStatsWindow");
+            ShowDrawStatsWindow(&g_AppState.showDrawStatsWindow);
+        }
+
         // Rendering
-        ImGui::Render();
-        const float clear_color_with_alpha[4] = { clear_color.x * clear_color.w, clear_color.y * clear_color.w, clear_color.z * clear_color.w, clear_color.w };
-        g_pd3dDeviceContext->OMSetRenderTargets(1, &g_mainRenderTargetView, nullptr);
-        g_pd3dDeviceContext->ClearRenderTargetView(g_mainRenderTargetView, clear_color_with_alpha);
-        ImGui_ImplDX11_RenderDrawData(ImGui::GetDrawData());
+        {
+            PROFILE_SCOPE("ImGui::Render");
+            ImGui::Render();
+        }
+        {
+            PROFILE_SCOPE("ImGui_ImplDX11_RenderDrawData");
+            const float clear_color_with_alpha[4] = { clear_color.x * clear_color.w, clear_color.y * clear_color.w, clear_color.z * clear_color.w, clear_color.w };
+            g_pd3dDeviceContext->OMSetRenderTargets(1, &g_mainRenderTargetView, nullptr);
+            g_pd3dDeviceContext->ClearRenderTargetView(g_mainRenderTargetView, clear_color_with_alpha);
+            ImGui_ImplDX11_RenderDrawData(ImGui::GetDrawData());
+        }
+        {
+            ImGui_ImplDX11_BufferStats buffer_stats;
+            ImGui_ImplDX11_GetBufferStats(&buffer_stats);
+            DrawBackendStats backend_stats;
+            backend_stats.vertexCapacity = buffer_stats.VertexBufferSize;
+            backend_stats.indexCapacity = buffer_stats.IndexBufferSize;
+            backend_stats.vertexReallocs = buffer_stats.VertexBufferReallocs;
+            backend_stats.indexReallocs = buffer_stats.IndexBufferReallocs;
+            backend_stats.retainedLists = buffer_stats.RetainedListCount;
+            backend_stats.uploadedVertices = buffer_stats.UploadedVtxCount;
+            backend_stats.reusedVertices = buffer_stats.ReusedVtxCount;
+            g_AppState.drawStats.Update(ImGui::GetDrawData(), backend_stats);
+        }
 
         // Present
-        HRESULT hr = g_pSwapChain->Present(1, 0);   // Present with vsync
+        HRESULT hr;
+        {
+            // 开启垂直同步时这里包含等待下一次刷新的时间
+            PROFILE_SCOPE("Present");
+            hr = g_pSwapChain->Present(1, 0);   // Present with vsync
+        }
         g_SwapChainOccluded = (hr == DXGI_STATUS_OCCLUDED);
+        profiler.EndFrame();
+
+        frames_to_render--;
+        if (IsUiAnimating(show_demo_window))
+            frames_to_render = frames_after_wake;
     }
     
     // Cleanup
+    // 取消未完成的后台任务，未写完的保存不会替换原文件
+    g_AppState.jobs.Stop();
     CleanupImPlot();
     ImGui_ImplDX11_Shutdown();
     ImGui_ImplWin32_Shutdown();
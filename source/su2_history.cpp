@@ -0,0 +1,236 @@
+/********************************************************************
+MIT License
+
+Copyright (c) 2025 loong22
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*********************************************************************/
+
+
+#include "../include/su2_history.h"
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+
+// 超过这个长度仍没有换行的内容不可能是收敛历史，直接丢弃
+constexpr size_t kMaxPartialLine = 64 * 1024;
+
+std::string_view Trim(std::string_view text) {
+    size_t begin = 0;
+    size_t end = text.size();
+    while (begin < end && (text[begin] == ' ' || text[begin] == '\t' || text[begin] == '"')) begin++;
+    while (end > begin && (text[end - 1] == ' ' || text[end - 1] == '\t' || text[end - 1] == '"' || text[end - 1] == '\r')) end--;
+    return text.substr(begin, end - begin);
+}
+
+bool ParseNumber(std::string_view text, double& value) {
+    char buffer[64];
+    if (text.empty() || text.size() >= sizeof(buffer)) return false;
+    memcpy(buffer, text.data(), text.size());
+    buffer[text.size()] = 0;
+    char* parseEnd = nullptr;
+    value = strtod(buffer, &parseEnd);
+    return parseEnd == buffer + text.size();
+}
+
+bool ContainsIgnoreCase(const std::string& text, const char* pattern) {
+    const size_t patternLength = strlen(pattern);
+    for (size_t i = 0; i + patternLength <= text.size(); i++) {
+        size_t j = 0;
+        while (j < patternLength && tolower(static_cast<unsigned char>(text[i + j])) == pattern[j]) j++;
+        if (j == patternLength) return true;
+    }
+    return false;
+}
+
+} // namespace
+
+void Su2HistoryUpdate::MarkReset() {
+    reset = true;
+    columnNames.clear();
+    values.clear();
+    columnCount = 0;
+}
+
+// ===== 解析器 =====
+
+void Su2HistoryParser::Reset() {
+    m_PartialLine.clear();
+    m_ColumnNames.clear();
+}
+
+void Su2HistoryParser::FeedChunk(uint64_t offset, const char* data, size_t size, Su2HistoryUpdate& update) {
+    if (offset == 0) {
+        Reset();
+        update.MarkReset();
+    }
+    update.columnCount = static_cast<int>(m_ColumnNames.size());
+
+    const char* cursor = data;
+    const char* end = data + size;
+    while (cursor < end) {
+        const char* newline = static_cast<const char*>(memchr(cursor, '\n', end - cursor));
+        if (newline == nullptr) {
+            if (m_PartialLine.size() + (end - cursor) <= kMaxPartialLine) {
+                m_PartialLine.append(cursor, end - cursor);
+            } else {
+                m_PartialLine.clear();
+            }
+            break;
+        }
+
+        if (!m_PartialLine.empty()) {
+            m_PartialLine.append(cursor, newline - cursor);
+            ParseLine(m_PartialLine, update);
+            m_PartialLine.clear();
+        } else {
+            ParseLine(std::string_view(cursor, newline - cursor), update);
+        }
+        cursor = newline + 1;
+    }
+}
+
+void Su2HistoryParser::ParseLine(std::string_view line, Su2HistoryUpdate& update) {
+    line = Trim(line);
+    if (line.empty()) return;
+
+    // 屏幕输出以 '|' 分隔并带首尾边框，history.csv 以 ',' 分隔
+    char separator;
+    if (line.front() == '|') {
+        separator = '|';
+        line = line.substr(1);
+        if (!line.empty() && line.back() == '|') line = line.substr(0, line.size() - 1);
+    } else if (line.find(',') != std::string_view::npos) {
+        separator = ',';
+    } else {
+        return;
+    }
+
+    m_Cells.clear();
+    size_t cellBegin = 0;
+    while (cellBegin <= line.size()) {
+        size_t cellEnd = line.find(separator, cellBegin);
+        if (cellEnd == std::string_view::npos) cellEnd = line.size();
+        m_Cells.push_back(Trim(line.substr(cellBegin, cellEnd - cellBegin)));
+        cellBegin = cellEnd + 1;
+    }
+    if (m_Cells.empty() || m_Cells[0].empty()) return;
+
+    double value = 0.0;
+    if (ParseNumber(m_Cells[0], value)) {
+        // 数据行：列数必须与当前表头一致，且每一列都是数字
+        if (m_ColumnNames.empty() || m_Cells.size() != m_ColumnNames.size()) return;
+        m_RowValues.clear();
+        for (std::string_view cell : m_Cells) {
+            if (!ParseNumber(cell, value)) return;
+            m_RowValues.push_back(value);
+        }
+        update.values.insert(update.values.end(), m_RowValues.begin(), m_RowValues.end());
+        return;
+    }
+
+    // 表头行：第一列必须是迭代步（Inner_Iter、Time_Iter 等），以排除 SU2 启动时打印的其他表格。
+    // SU2 每隔若干步会重复打印相同的表头，列名不变时忽略
+    if (!Su2History::IsIterationName(std::string(m_Cells[0]))) return;
+    bool sameColumns = m_Cells.size() == m_ColumnNames.size();
+    for (size_t i = 0; sameColumns && i < m_Cells.size(); i++) {
+        sameColumns = m_Cells[i] == m_ColumnNames[i];
+    }
+    if (sameColumns) return;
+
+    m_ColumnNames.assign(m_Cells.begin(), m_Cells.end());
+    update.MarkReset();
+    update.columnNames = m_ColumnNames;
+    update.columnCount = static_cast<int>(m_ColumnNames.size());
+}
+
+// ===== 收敛历史数据 =====
+
+void Su2History::Clear() {
+    m_ColumnNames.clear();
+    m_Columns.clear();
+    m_Series.clear();
+}
+
+void Su2History::Apply(const Su2HistoryUpdate& update) {
+    if (update.reset) {
+        m_ColumnNames = update.columnNames;
+        m_Columns.assign(m_ColumnNames.size(), std::vector<double>());
+        m_Series.clear();
+        for (size_t column = 0; column < m_ColumnNames.size(); column++) {
+            m_Series.push_back(std::make_unique<ImPlotSeriesBuffer>());
+        }
+    }
+
+    const int columnCount = GetColumnCount();
+    if (columnCount == 0 || update.columnCount != columnCount || update.values.empty()) return;
+
+    const size_t firstRow = m_Columns[0].size();
+    const size_t rowCount = update.values.size() / columnCount;
+    for (int column = 0; column < columnCount; column++) {
+        std::vector<double>& columnData = m_Columns[column];
+        columnData.reserve(columnData.size() + rowCount);
+        for (size_t row = 0; row < rowCount; row++) {
+            columnData.push_back(update.values[row * columnCount + column]);
+        }
+    }
+
+    // 曲线只追加新行，ImPlot 按块维护包围盒，自动缩放不必每帧遍历全部历史
+    const int iterColumn = FindIterationColumn();
+    if (iterColumn >= 0) {
+        m_SeriesXs.assign(m_Columns[iterColumn].begin() + firstRow, m_Columns[iterColumn].end());
+    } else {
+        m_SeriesXs.resize(rowCount);
+        for (size_t row = 0; row < rowCount; row++) {
+            m_SeriesXs[row] = static_cast<double>(firstRow + row);
+        }
+    }
+    for (int column = 0; column < columnCount; column++) {
+        const double* ys = m_Columns[column].data() + firstRow;
+        if (IsResidualName(m_ColumnNames[column])) {
+            m_SeriesYs.resize(rowCount);
+            for (size_t row = 0; row < rowCount; row++) {
+                m_SeriesYs[row] = pow(10.0, ys[row]);
+            }
+            ys = m_SeriesYs.data();
+        }
+        m_Series[column]->AddPoints(m_SeriesXs.data(), ys, static_cast<int>(rowCount));
+    }
+}
+
+int Su2History::FindIterationColumn() const {
+    int found = -1;
+    for (int column = 0; column < GetColumnCount(); column++) {
+        if (m_ColumnNames[column] == "Inner_Iter") return column;
+        if (found < 0 && IsIterationName(m_ColumnNames[column])) found = column;
+    }
+    return found;
+}
+
+bool Su2History::IsIterationName(const std::string& name) {
+    return ContainsIgnoreCase(name, "iter");
+}
+
+bool Su2History::IsResidualName(const std::string& name) {
+    return ContainsIgnoreCase(name, "rms[") || ContainsIgnoreCase(name, "max[") ||
+        ContainsIgnoreCase(name, "bgs[") || ContainsIgnoreCase(name, "res[");
+}
@@ -0,0 +1,599 @@
+/********************************************************************
+MIT License
+
+Copyright (c) 2025 loong22
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*********************************************************************/
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#endif
+
+#include "../include/su2_mesh.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string_view>
+
+namespace {
+
+// 每次从文件读取的字节数，单行超过这个长度时缓冲区自动加倍
+constexpr size_t kReadChunkSize = 4 * 1024 * 1024;
+
+FILE* OpenFileForRead(const std::string& filePath) {
+#ifdef _WIN32
+    int size_needed = MultiByteToWideChar(CP_UTF8, 0, filePath.c_str(), -1, NULL, 0);
+    std::wstring widePath(size_needed, 0);
+    MultiByteToWideChar(CP_UTF8, 0, filePath.c_str(), -1, &widePath[0], size_needed);
+    return _wfopen(widePath.c_str(), L"rb");
+#else
+    return fopen(filePath.c_str(), "rb");
+#endif
+}
+
+// 按块读取文件，把完整的行交给回调。行直接指向读缓冲区，不做任何复制；
+// 跨块的半行移动到缓冲区开头，和下一块拼接后再交出
+class ChunkedLineReader {
+public:
+    ~ChunkedLineReader() {
+        if (m_File) fclose(m_File);
+    }
+
+    bool Open(const std::string& filePath) {
+        m_File = OpenFileForRead(filePath);
+        if (m_File == nullptr) return false;
+#ifdef _WIN32
+        if (_fseeki64(m_File, 0, SEEK_END) == 0) m_FileSize = static_cast<uint64_t>(_ftelli64(m_File));
+        _fseeki64(m_File, 0, SEEK_SET);
+#else
+        if (fseeko(m_File, 0, SEEK_END) == 0) m_FileSize = static_cast<uint64_t>(ftello(m_File));
+        fseeko(m_File, 0, SEEK_SET);
+#endif
+        return true;
+    }
+
+    void SetProgressCallback(const FileProgressCallback* onProgress) { m_OnProgress = onProgress; }
+    uint64_t GetBytesRead() const { return m_BytesRead; }
+    bool IsCancelled() const { return m_Cancelled; }
+
+    // callback(lineBegin, lineEnd) 返回 false 时提前结束；读取出错时返回 false
+    template<typename Callback>
+    bool ForEachLine(Callback&& callback) {
+        m_Buffer.resize(kReadChunkSize);
+        size_t carry = 0;
+        for (;;) {
+            if (carry == m_Buffer.size()) m_Buffer.resize(m_Buffer.size() * 2);
+            const size_t readSize = fread(m_Buffer.data() + carry, 1, m_Buffer.size() - carry, m_File);
+            m_BytesRead += readSize;
+            if (m_OnProgress && *m_OnProgress && !(*m_OnProgress)(m_BytesRead, m_FileSize)) {
+                m_Cancelled = true;
+                return false;
+            }
+
+            const char* lineBegin = m_Buffer.data();
+            const char* end = lineBegin + carry + readSize;
+            for (;;) {
+                const char* newline = static_cast<const char*>(memchr(lineBegin, '\n', end - lineBegin));
+                if (newline == nullptr) break;
+                if (!callback(lineBegin, newline)) return true;
+                lineBegin = newline + 1;
+            }
+
+            carry = end - lineBegin;
+            if (readSize == 0) {
+                if (carry > 0) callback(lineBegin, end);
+                return ferror(m_File) == 0;
+            }
+            memmove(m_Buffer.data(), lineBegin, carry);
+        }
+    }
+
+private:
+    FILE* m_File = nullptr;
+    std::vector<char> m_Buffer;
+    uint64_t m_BytesRead = 0;
+    uint64_t m_FileSize = 0;
+    const FileProgressCallback* m_OnProgress = nullptr;
+    bool m_Cancelled = false;
+};
+
+inline bool IsBlank(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+inline void SkipBlanks(const char*& p, const char* end) {
+    while (p < end && IsBlank(*p)) p++;
+}
+
+bool ParseUInt(const char*& p, const char* end, uint64_t& value) {
+    SkipBlanks(p, end);
+    const char* start = p;
+    value = 0;
+    while (p < end && *p >= '0' && *p <= '9') {
+        value = value * 10 + static_cast<uint64_t>(*p - '0');
+        p++;
+    }
+    return p != start;
+}
+
+// 十进制浮点数：尾数最多取 19 位有效数字，再乘以 10 的幂。对 float 坐标和解变量足够精确，
+// 比 strtod 快得多；inf、nan 等特殊写法交给 strtod
+bool ParseFloat(const char*& p, const char* end, double& value) {
+    static const double kPowersOfTen[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+
+    SkipBlanks(p, end);
+    const char* s = p;
+    bool negative = false;
+    if (s < end && (*s == '-' || *s == '+')) {
+        negative = *s == '-';
+        s++;
+    }
+
+    uint64_t mantissa = 0;
+    int digits = 0;
+    int exponent = 0;
+    bool anyDigit = false;
+    while (s < end && *s >= '0' && *s <= '9') {
+        if (digits < 19) {
+            mantissa = mantissa * 10 + static_cast<uint64_t>(*s - '0');
+            if (mantissa != 0) digits++;
+        } else {
+            exponent++;
+        }
+        anyDigit = true;
+        s++;
+    }
+    if (s < end && *s == '.') {
+        s++;
+        while (s < end && *s >= '0' && *s <= '9') {
+            if (digits < 19) {
+                mantissa = mantissa * 10 + static_cast<uint64_t>(*s - '0');
+                if (mantissa != 0) digits++;
+                exponent--;
+            }
+            anyDigit = true;
+            s++;
+        }
+    }
+
+    if (!anyDigit) {
+        // inf / nan 之类的写法很少出现，复制到栈上交给 strtod
+        char buffer[64];
+        size_t length = 0;
+        while (p + length < end && length + 1 < sizeof(buffer) && !IsBlank(p[length]) && p[length] != ',') length++;
+        memcpy(buffer, p, length);
+        buffer[length] = 0;
+        char* parseEnd = nullptr;
+        value = strtod(buffer, &parseEnd);
+        if (parseEnd == buffer) return false;
+        p += parseEnd - buffer;
+        return true;
+    }
+
+    if (s < end && (*s == 'e' || *s == 'E')) {
+        const char* e = s + 1;
+        bool negativeExponent = false;
+        if (e < end && (*e == '-' || *e == '+')) {
+            negativeExponent = *e == '-';
+            e++;
+        }
+        int exponentValue = 0;
+        const char* exponentStart = e;
+        while (e < end && *e >= '0' && *e <= '9') {
+            if (exponentValue < 10000) exponentValue = exponentValue * 10 + (*e - '0');
+            e++;
+        }
+        if (e != exponentStart) {
+            exponent += negativeExponent ? -exponentValue : exponentValue;
+            s = e;
+        }
+    }
+
+    double result = static_cast<double>(mantissa);
+    if (mantissa != 0 && exponent != 0) {
+        if (exponent > 0 && exponent <= 22) result *= kPowersOfTen[exponent];
+        else if (exponent < 0 && exponent >= -22) result /= kPowersOfTen[-exponent];
+        else result *= pow(10.0, exponent);
+    }
+    value = negative ? -result : result;
+    p = s;
+    return true;
+}
+
+// 关键字行形如 "NPOIN= 1234"，匹配成功时 p 指向等号之后
+bool MatchKeyword(const char*& p, const char* end, const char* keyword) {
+    const size_t length = strlen(keyword);
+    if (static_cast<size_t>(end - p) < length || memcmp(p, keyword, length) != 0) return false;
+    p += length;
+    return true;
+}
+
+std::string_view TrimCell(const char* begin, const char* end) {
+    while (begin < end && (IsBlank(*begin) || *begin == '"')) begin++;
+    while (end > begin && (IsBlank(end[-1]) || end[-1] == '"')) end--;
+    return std::string_view(begin, end - begin);
+}
+
+bool EqualsIgnoreCase(std::string_view text, const char* pattern) {
+    const size_t length = strlen(pattern);
+    if (text.size() != length) return false;
+    for (size_t i = 0; i < length; i++) {
+        if (tolower(static_cast<unsigned char>(text[i])) != tolower(static_cast<unsigned char>(pattern[i]))) return false;
+    }
+    return true;
+}
+
+// VTK 单元类型对应的节点数，不认识的类型返回 0
+int GetElementNodeCount(uint64_t type) {
+    switch (type) {
+    case 3:  return 2;   // 线段
+    case 5:  return 3;   // 三角形
+    case 9:  return 4;   // 四边形
+    case 10: return 4;   // 四面体
+    case 12: return 8;   // 六面体
+    case 13: return 6;   // 三棱柱
+    case 14: return 5;   // 金字塔
+    default: return 0;
+    }
+}
+
+class Su2MeshParser {
+public:
+    explicit Su2MeshParser(Su2Mesh& mesh) : m_Mesh(mesh) {}
+
+    // 返回 false 表示停止读取：出错，或者第一个区域已经读完
+    bool ParseLine(const char* p, const char* end) {
+        m_LineNumber++;
+        SkipBlanks(p, end);
+        if (p == end || *p == '%') return true;
+
+        if (m_Remaining > 0) {
+            m_Remaining--;
+            switch (m_Section) {
+            case Section::Elements:
+                // 三维网格的体单元不显示，整行跳过，不必解析
+                return m_Mesh.dimension == 3 ? true : ParseElement(p, end);
+            case Section::Points:
+                return ParsePoint(p, end);
+            case Section::MarkerElements:
+                return m_Mesh.dimension == 3 ? ParseElement(p, end) : true;
+            default:
+                break;
+            }
+        }
+        return ParseKeyword(p, end);
+    }
+
+    bool Finish(std::string& error) {
+        CloseMarker();
+        if (!m_Error.empty()) {
+            error = m_Error;
+            return false;
+        }
+        if (m_Mesh.dimension == 0) {
+            error = u8"不是 SU2 网格文件：缺少 NDIME";
+            return false;
+        }
+        if (m_Mesh.points.size() != m_ExpectedPoints) {
+            error = u8"文件不完整：NPOIN 为 " + std::to_string(m_ExpectedPoints) + u8"，实际读到 " + std::to_string(m_Mesh.points.size()) + u8" 个点";
+            return false;
+        }
+        const size_t pointCount = m_Mesh.points.size();
+        for (unsigned int index : m_Mesh.triangles) {
+            if (index >= pointCount) {
+                error = u8"单元引用了不存在的点 " + std::to_string(index);
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    enum class Section { None, Elements, Points, MarkerElements };
+
+    bool Fail(const char* message) {
+        m_Error = std::string(message) + u8"（第 " + std::to_string(m_LineNumber) + u8" 行）";
+        return false;
+    }
+
+    bool ParseKeyword(const char* p, const char* end) {
+        uint64_t value = 0;
+        if (MatchKeyword(p, end, "NDIME=")) {
+            if (!ParseUInt(p, end, value) || (value != 2 && value != 3)) return Fail(u8"NDIME 只能是 2 或 3");
+            m_Mesh.dimension = static_cast<int>(value);
+        } else if (MatchKeyword(p, end, "NELEM=")) {
+            if (m_Mesh.dimension == 0) return Fail(u8"NELEM 出现在 NDIME 之前");
+            if (!ParseUInt(p, end, value)) return Fail(u8"NELEM 后缺少单元数");
+            m_Mesh.elementCount = value;
+            if (m_Mesh.dimension == 2) m_Mesh.triangles.reserve(static_cast<size_t>(value) * 3);
+            BeginSection(Section::Elements, value);
+        } else if (MatchKeyword(p, end, "NPOIN=")) {
+            if (m_Mesh.dimension == 0) return Fail(u8"NPOIN 出现在 NDIME 之前");
+            // 并行分区网格在总点数后还有本分区点数，只需要第一个
+            if (!ParseUInt(p, end, value)) return Fail(u8"NPOIN 后缺少点数");
+            m_ExpectedPoints = value;
+            m_Mesh.points.reserve(static_cast<size_t>(value));
+            BeginSection(Section::Points, value);
+        } else if (MatchKeyword(p, end, "MARKER_TAG=")) {
+            CloseMarker();
+            std::string_view tag = TrimCell(p, end);
+            Su2Marker marker;
+            marker.tag.assign(tag.data(), tag.size());
+            marker.firstIndex = m_Mesh.triangles.size();
+            m_Mesh.markers.push_back(marker);
+            m_MarkerOpen = true;
+        } else if (MatchKeyword(p, end, "MARKER_ELEMS=")) {
+            if (!ParseUInt(p, end, value)) return Fail(u8"MARKER_ELEMS 后缺少单元数");
+            BeginSection(Section::MarkerElements, value);
+        } else if (MatchKeyword(p, end, "IZONE=")) {
+            // 多区域网格：第二个区域开始时停止，只显示第一个区域
+            if (ParseUInt(p, end, value) && value > 1) return false;
+        }
+        // NMARK、NZONE 等其他关键字不影响读取
+        return true;
+    }
+
+    void BeginSection(Section section, uint64_t count) {
+        m_Section = section;
+        m_Remaining = count;
+    }
+
+    void CloseMarker() {
+        if (!m_MarkerOpen) return;
+        Su2Marker& marker = m_Mesh.markers.back();
+        marker.indexCount = m_Mesh.triangles.size() - marker.firstIndex;
+        m_MarkerOpen = false;
+    }
+
+    bool ParseElement(const char* p, const char* end) {
+        uint64_t type = 0;
+        if (!ParseUInt(p, end, type)) return Fail(u8"单元行格式错误");
+        const int nodeCount = GetElementNodeCount(type);
+        if (nodeCount == 0) return Fail(u8"不支持的单元类型");
+        if (type != 5 && type != 9) return true;   // 只有三角形和四边形需要显示
+
+        uint64_t nodes[4];
+        for (int i = 0; i < nodeCount; i++) {
+            if (!ParseUInt(p, end, nodes[i]) || nodes[i] > 0xFFFFFFFFull) return Fail(u8"单元节点编号错误");
+        }
+        std::vector<unsigned int>& triangles = m_Mesh.triangles;
+        triangles.push_back(static_cast<unsigned int>(nodes[0]));
+        triangles.push_back(static_cast<unsigned int>(nodes[1]));
+        triangles.push_back(static_cast<unsigned int>(nodes[2]));
+        if (type == 9) {
+            triangles.push_back(static_cast<unsigned int>(nodes[0]));
+            triangles.push_back(static_cast<unsigned int>(nodes[2]));
+            triangles.push_back(static_cast<unsigned int>(nodes[3]));
+        }
+        return true;
+    }
+
+    bool ParsePoint(const char* p, const char* end) {
+        double coords[3] = { 0.0, 0.0, 0.0 };
+        for (int i = 0; i < m_Mesh.dimension; i++) {
+            if (!ParseFloat(p, end, coords[i])) return Fail(u8"点坐标格式错误");
+        }
+        m_Mesh.points.push_back(ImPlot3DPoint(static_cast<float>(coords[0]), static_cast<float>(coords[1]), static_cast<float>(coords[2])));
+        return true;
+    }
+
+    Su2Mesh& m_Mesh;
+    Section m_Section = Section::None;
+    uint64_t m_Remaining = 0;
+    uint64_t m_ExpectedPoints = 0;
+    uint64_t m_LineNumber = 0;
+    bool m_MarkerOpen = false;
+    std::string m_Error;
+};
+
+double SecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+void Su2Mesh::Clear() {
+    dimension = 0;
+    elementCount = 0;
+    points.clear();
+    triangles.clear();
+    markers.clear();
+    boundsMin = boundsMax = ImPlot3DPoint();
+}
+
+void Su2SurfaceSolution::Clear() {
+    fieldNames.clear();
+    pointIds.clear();
+    points.clear();
+    fields.clear();
+}
+
+int Su2SurfaceSolution::FindField(const char* name) const {
+    for (size_t i = 0; i < fieldNames.size(); i++) {
+        if (EqualsIgnoreCase(fieldNames[i], name)) return static_cast<int>(i);
+    }
+    return -1;
+}
+
+bool LoadSu2Mesh(const std::string& filePath, Su2Mesh& mesh, Su2LoadStats& stats, std::string& error,
+    const FileProgressCallback& onProgress) {
+    const auto start = std::chrono::steady_clock::now();
+    mesh.Clear();
+    stats = Su2LoadStats();
+
+    ChunkedLineReader reader;
+    if (!reader.Open(filePath)) {
+        error = u8"无法打开文件: " + filePath;
+        return false;
+    }
+    reader.SetProgressCallback(&onProgress);
+
+    Su2MeshParser parser(mesh);
+    const bool readOk = reader.ForEachLine([&parser](const char* begin, const char* end) {
+        return parser.ParseLine(begin, end);
+    });
+    stats.bytes = reader.GetBytesRead();
+    if (!readOk) {
+        error = reader.IsCancelled() ? u8"已取消读取: " + filePath : u8"读取文件出错: " + filePath;
+        mesh.Clear();
+        return false;
+    }
+    if (!parser.Finish(error)) {
+        mesh.Clear();
+        return false;
+    }
+
+    if (!mesh.points.empty()) {
+        mesh.boundsMin = mesh.boundsMax = mesh.points[0];
+        for (const ImPlot3DPoint& point : mesh.points) {
+            mesh.boundsMin.x = std::min(mesh.boundsMin.x, point.x);
+            mesh.boundsMin.y = std::min(mesh.boundsMin.y, point.y);
+            mesh.boundsMin.z = std::min(mesh.boundsMin.z, point.z);
+            mesh.boundsMax.x = std::max(mesh.boundsMax.x, point.x);
+            mesh.boundsMax.y = std::max(mesh.boundsMax.y, point.y);
+            mesh.boundsMax.z = std::max(mesh.boundsMax.z, point.z);
+        }
+    }
+    stats.seconds = SecondsSince(start);
+    return true;
+}
+
+bool LoadSu2SurfaceSolution(const std::string& filePath, Su2SurfaceSolution& solution, Su2LoadStats& stats, std::string& error,
+    const FileProgressCallback& onProgress) {
+    const auto start = std::chrono::steady_clock::now();
+    solution.Clear();
+    stats = Su2LoadStats();
+
+    ChunkedLineReader reader;
+    if (!reader.Open(filePath)) {
+        error = u8"无法打开文件: " + filePath;
+        return false;
+    }
+    reader.SetProgressCallback(&onProgress);
+
+    // 列的用途：-1 为 PointID，-2/-3/-4 为 x/y/z，非负数为 fields 下标
+    std::vector<int> columnRoles;
+    bool hasPointId = false;
+    std::vector<double> row;
+    const bool readOk = reader.ForEachLine([&](const char* begin, const char* end) {
+        const char* p = begin;
+        SkipBlanks(p, end);
+        if (p == end) return true;
+
+        if (columnRoles.empty()) {
+            // 表头：只在这里为列名分配字符串
+            const char* cell = p;
+            for (;;) {
+                const char* comma = static_cast<const char*>(memchr(cell, ',', end - cell));
+                const char* cellEnd = comma ? comma : end;
+                std::string_view name = TrimCell(cell, cellEnd);
+                if (EqualsIgnoreCase(name, "pointid") || EqualsIgnoreCase(name, "global_index")) {
+                    columnRoles.push_back(-1);
+                    hasPointId = true;
+                } else if (EqualsIgnoreCase(name, "x")) {
+                    columnRoles.push_back(-2);
+                } else if (EqualsIgnoreCase(name, "y")) {
+                    columnRoles.push_back(-3);
+                } else if (EqualsIgnoreCase(name, "z")) {
+                    columnRoles.push_back(-4);
+                } else {
+                    columnRoles.push_back(static_cast<int>(solution.fieldNames.size()));
+                    solution.fieldNames.emplace_back(name);
+                }
+                if (comma == nullptr) break;
+                cell = comma + 1;
+            }
+            solution.fields.resize(solution.fieldNames.size());
+            row.resize(columnRoles.size());
+            return true;
+        }
+
+        // 数据行：列数不符或有无法解析的数字时整行跳过
+        for (size_t column = 0; column < columnRoles.size(); column++) {
+            while (p < end && (IsBlank(*p) || *p == '"')) p++;
+            if (!ParseFloat(p, end, row[column])) return true;
+            while (p < end && (IsBlank(*p) || *p == '"')) p++;
+            if (column + 1 < columnRoles.size()) {
+                if (p == end || *p != ',') return true;
+                p++;
+            }
+        }
+
+        ImPlot3DPoint point;
+        for (size_t column = 0; column < columnRoles.size(); column++) {
+            const int role = columnRoles[column];
+            if (role >= 0) solution.fields[role].push_back(static_cast<float>(row[column]));
+            else if (role == -1) solution.pointIds.push_back(static_cast<unsigned int>(row[column]));
+            else if (role == -2) point.x = static_cast<float>(row[column]);
+            else if (role == -3) point.y = static_cast<float>(row[column]);
+            else point.z = static_cast<float>(row[column]);
+        }
+        solution.points.push_back(point);
+        return true;
+    });
+    stats.bytes = reader.GetBytesRead();
+    if (!readOk) {
+        error = reader.IsCancelled() ? u8"已取消读取: " + filePath : u8"读取文件出错: " + filePath;
+        solution.Clear();
+        return false;
+    }
+    if (columnRoles.empty() || solution.points.empty()) {
+        error = u8"没有读到表面解数据: " + filePath;
+        solution.Clear();
+        return false;
+    }
+    if (!hasPointId) solution.pointIds.clear();
+    stats.seconds = SecondsSince(start);
+    return true;
+}
+
+bool MapSurfaceField(const Su2Mesh& mesh, const Su2SurfaceSolution& solution, int field, std::vector<float>& values) {
+    values.assign(mesh.points.size(), std::numeric_limits<float>::quiet_NaN());
+    if (field < 0 || field >= static_cast<int>(solution.fields.size())) {
+        return false;
+    }
+
+    const std::vector<float>& column = solution.fields[field];
+    if (solution.pointIds.empty()) {
+        if (column.size() != values.size()) return false;
+        std::copy(column.begin(), column.end(), values.begin());
+        return true;
+    }
+
+    bool mapped = false;
+    for (size_t row = 0; row < column.size(); row++) {
+        const unsigned int pointId = solution.pointIds[row];
+        if (pointId < values.size()) {
+            values[pointId] = column[row];
+            mapped = true;
+        }
+    }
+    return mapped;
+}
@@ -0,0 +1,114 @@
+/********************************************************************
+MIT License
+
+Copyright (c) 2025 loong22
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*********************************************************************/
+
+#include "../include/worker_pool.h"
+#include <algorithm>
+
+WorkerPool::~WorkerPool() {
+    Stop();
+}
+
+void WorkerPool::Start(int threadCount) {
+    Stop();
+    if (threadCount <= 0) {
+        threadCount = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_StopRequested = false;
+    for (int i = 1; i < threadCount; i++) {
+        m_Threads.emplace_back(&WorkerPool::ThreadMain, this);
+    }
+}
+
+void WorkerPool::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (m_Threads.empty()) return;
+        m_StopRequested = true;
+    }
+    m_WakeCondition.notify_all();
+    for (std::thread& thread : m_Threads) {
+        thread.join();
+    }
+    m_Threads.clear();
+}
+
+void WorkerPool::ParallelFor(int count, Task task, void* taskData) {
+    if (count <= 0) return;
+    if (m_Threads.empty() || count == 1) {
+        for (int i = 0; i < count; i++) {
+            task(i, taskData);
+        }
+        return;
+    }
+
+    {
+        // 上一轮晚醒的工作线程可能仍在领取任务，等它们退出后才能重置 m_Next
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_DoneCondition.wait(lock, [this] { return m_Active == 0; });
+        m_Task = task;
+        m_TaskData = taskData;
+        m_Count = count;
+        m_Next.store(0, std::memory_order_relaxed);
+        m_Generation++;
+    }
+    m_WakeCondition.notify_all();
+    RunTasks(task, taskData, count);
+
+    // 调用线程领完任务时，其余任务都已被正在执行的工作线程领走
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    m_DoneCondition.wait(lock, [this] { return m_Active == 0; });
+}
+
+void WorkerPool::ParallelForCallback(int count, Task task, void* taskData, void* userData) {
+    static_cast<WorkerPool*>(userData)->ParallelFor(count, task, taskData);
+}
+
+void WorkerPool::RunTasks(Task task, void* taskData, int count) {
+    for (int i = m_Next.fetch_add(1, std::memory_order_relaxed); i < count; i = m_Next.fetch_add(1, std::memory_order_relaxed)) {
+        task(i, taskData);
+    }
+}
+
+void WorkerPool::ThreadMain() {
+    uint64_t generation = 0;
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    while (true) {
+        m_WakeCondition.wait(lock, [&] { return m_StopRequested || m_Generation != generation; });
+        if (m_StopRequested) break;
+        generation = m_Generation;
+        const Task task = m_Task;
+        void* const taskData = m_TaskData;
+        const int count = m_Count;
+        m_Active++;
+        lock.unlock();
+
+        RunTasks(task, taskData, count);
+
+        lock.lock();
+        if (--m_Active == 0) {
+            m_DoneCondition.notify_all();
+        }
+    }
+}